@@ -0,0 +1,96 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <sys/wait.h>
+
+#include <iostream>
+#include <string>
+
+#include "floyd/include/floyd.h"
+
+using namespace floyd;
+
+Options FileLogOptions() {
+  Options op("127.0.0.1:8901", "127.0.0.1", 8901, "./data1/");
+  op.single_mode = true;
+  op.use_file_log = true;
+  op.file_log_segment_size = 1024 * 1024;
+  op.log_sync_mode = kSyncPerAppend;
+  return op;
+}
+
+/*
+ * the child writes until it is killed, every acknowledged write is reported
+ * through the pipe. After restart all of them are read back from the log
+ * recovered by FileLog
+ */
+int main()
+{
+  printf("testing FileLog crash recovery, a node is killed while writing and restarted\n");
+  int fds[2];
+  if (pipe(fds) != 0) {
+    printf("pipe failed\n");
+    return -1;
+  }
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    Floyd *f1;
+    slash::Status s = Floyd::Open(FileLogOptions(), &f1);
+    if (!s.ok()) {
+      printf("open floyd failed, %s\n", s.ToString().c_str());
+      _exit(-1);
+    }
+    for (int i = 0; ; i++) {
+      std::string key = "key" + std::to_string(i);
+      if (f1->Write(key, key).ok()) {
+        write(fds[1], &i, sizeof(i));
+      }
+    }
+  }
+  close(fds[1]);
+
+  sleep(5);
+  kill(pid, SIGKILL);
+  waitpid(pid, NULL, 0);
+  int acked = -1;
+  int i;
+  while (read(fds[0], &i, sizeof(i)) == sizeof(i)) {
+    acked = i;
+  }
+  close(fds[0]);
+  printf("killed the writer after %d acknowledged writes\n", acked + 1);
+
+  Floyd *f1;
+  Options op = FileLogOptions();
+  op.Dump();
+  slash::Status s = Floyd::Open(op, &f1);
+  printf("reopen floyd, %s\n", s.ToString().c_str());
+  if (!s.ok()) {
+    return -1;
+  }
+  sleep(2);
+
+  int lost = 0;
+  std::string value;
+  for (int j = 0; j <= acked; j++) {
+    std::string key = "key" + std::to_string(j);
+    if (!f1->Read(key, &value).ok() || value != key) {
+      lost++;
+    }
+  }
+  printf("%d of %d acknowledged writes are lost\n", lost, acked + 1);
+
+  std::string msg;
+  f1->GetServerStatus(&msg);
+  printf("%s\n", msg.c_str());
+  delete f1;
+  printf("%s\n", lost == 0 ? "PASSED" : "FAILED");
+  return lost == 0 ? 0 : -1;
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <iostream>
+#include <string>
+
+#include "floyd/include/floyd.h"
+#include "slash/include/env.h"
+#include "slash/include/testutil.h"
+
+using namespace floyd;
+uint64_t NowMicros() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast<uint64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+/*
+ * node 3 joins after the log it misses has been compacted by snapshots,
+ * so it catches up by InstallSnapshot and then by AppendEntries
+ */
+int main()
+{
+  printf("testing snapshot, a new node catches up by InstallSnapshot\n");
+  std::string members = "127.0.0.1:8901,127.0.0.1:8902,127.0.0.1:8903";
+  Options op(members, "127.0.0.1", 8901, "./data1/");
+  op.snapshot_interval_count = 10000;
+  op.install_snapshot_chunk_size = 64 * 1024;
+  op.Dump();
+
+  Floyd *f1, *f2, *f3;
+
+  slash::Status s;
+  s = Floyd::Open(op, &f1);
+  printf("%s\n", s.ToString().c_str());
+
+  Options op2(members, "127.0.0.1", 8902, "./data2/");
+  op2.snapshot_interval_count = 10000;
+  op2.install_snapshot_chunk_size = 64 * 1024;
+  s = Floyd::Open(op2, &f2);
+  printf("%s\n", s.ToString().c_str());
+
+  while (1) {
+    if (f1->HasLeader()) {
+      break;
+    }
+    printf("electing leader... sleep 2s\n");
+    sleep(2);
+  }
+
+  // several snapshots are taken, the log before the previous one is deleted
+  int item_num = 50000;
+  uint64_t st = NowMicros(), ed;
+  for (int i = 0; i < item_num; i++) {
+    std::string key = "key" + std::to_string(i);
+    s = f1->Write(key, key);
+    if (!s.ok()) {
+      printf("write %s failed, %s\n", key.c_str(), s.ToString().c_str());
+    }
+  }
+  ed = NowMicros();
+  printf("write %d cost time microsecond(us) %ld, qps %llu\n",
+      item_num, ed - st, item_num * 1000000LL / (ed - st));
+
+  Options op3(members, "127.0.0.1", 8903, "./data3/");
+  op3.snapshot_interval_count = 10000;
+  op3.install_snapshot_chunk_size = 64 * 1024;
+  s = Floyd::Open(op3, &f3);
+  printf("%s\n", s.ToString().c_str());
+
+  // the first key comes from snapshot, the last one from log
+  std::string first_key = "key0";
+  std::string last_key = "key" + std::to_string(item_num - 1);
+  std::string value;
+  int cnt = 30;
+  while (cnt--) {
+    if (f3->DirtyRead(first_key, &value).ok() && f3->DirtyRead(last_key, &value).ok()) {
+      break;
+    }
+    printf("node 3 catching up... sleep 1s\n");
+    sleep(1);
+  }
+  int failed = 0;
+  if (!slash::FileExists("./data1/snapshot/FLOYD_SNAPSHOT")
+      || !slash::FileExists("./data3/snapshot/FLOYD_SNAPSHOT")) {
+    printf("FAILED: snapshot is not kept by node 1 or node 3\n");
+    failed++;
+  }
+  for (int i = 0; i < item_num; i++) {
+    std::string key = "key" + std::to_string(i);
+    if (!f3->DirtyRead(key, &value).ok() || value != key) {
+      failed++;
+    }
+  }
+  printf("node 3 misses %d of %d keys\n", failed, item_num);
+
+  std::string msg;
+  f3->GetServerStatus(&msg);
+  printf("%s\n", msg.c_str());
+
+  delete f3;
+  delete f2;
+  delete f1;
+  printf("%s\n", failed == 0 ? "PASSED" : "FAILED");
+  return failed == 0 ? 0 : -1;
+}
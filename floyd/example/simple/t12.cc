@@ -0,0 +1,153 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "floyd/include/floyd.h"
+#include "slash/include/env.h"
+
+using namespace floyd;
+uint64_t NowMicros() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast<uint64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+/*
+ * a volatile counter, the command is the number to add. It is restored
+ * from the latest snapshot on restart
+ */
+class CounterStateMachine : public StateMachine {
+ public:
+  CounterStateMachine() : counter_(0) { }
+
+  virtual Status ApplyBatch(uint64_t last_index,
+                            const std::vector<const std::string*>& commands) {
+    for (auto command : commands) {
+      counter_ += strtoull(command->c_str(), NULL, 10);
+    }
+    return Status::OK();
+  }
+
+  virtual Status Snapshot(const std::string& path) {
+    if (slash::CreatePath(path) != 0) {
+      return Status::IOError("create " + path + " failed");
+    }
+    std::ofstream out(path + "/counter");
+    out << counter_.load();
+    out.close();
+    if (!out) {
+      return Status::IOError("write " + path + "/counter failed");
+    }
+    return Status::OK();
+  }
+
+  virtual Status Restore(const std::string& path) {
+    std::ifstream in(path + "/counter");
+    uint64_t counter;
+    if (!(in >> counter)) {
+      return Status::Corruption("read " + path + "/counter failed");
+    }
+    counter_ = counter;
+    return Status::OK();
+  }
+
+  uint64_t counter() {
+    return counter_;
+  }
+
+ private:
+  std::atomic<uint64_t> counter_;
+};
+
+int main()
+{
+  printf("testing user defined state machine, every node counts the same sum\n");
+  std::string members = "127.0.0.1:8901,127.0.0.1:8902,127.0.0.1:8903";
+  CounterStateMachine sm1, sm2, sm3;
+  Floyd *f1, *f2, *f3;
+
+  Options op(members, "127.0.0.1", 8901, "./data1/");
+  op.state_machine = &sm1;
+  op.snapshot_interval_count = 1000;
+  op.Dump();
+  slash::Status s;
+  s = Floyd::Open(op, &f1);
+  printf("%s\n", s.ToString().c_str());
+
+  Options op2(members, "127.0.0.1", 8902, "./data2/");
+  op2.state_machine = &sm2;
+  op2.snapshot_interval_count = 1000;
+  s = Floyd::Open(op2, &f2);
+  printf("%s\n", s.ToString().c_str());
+
+  Options op3(members, "127.0.0.1", 8903, "./data3/");
+  op3.state_machine = &sm3;
+  op3.snapshot_interval_count = 1000;
+  s = Floyd::Open(op3, &f3);
+  printf("%s\n", s.ToString().c_str());
+
+  while (1) {
+    if (f1->HasLeader()) {
+      break;
+    }
+    printf("electing leader... sleep 2s\n");
+    sleep(2);
+  }
+
+  int item_num = 10000;
+  uint64_t st = NowMicros(), ed;
+  for (int i = 1; i <= item_num; i++) {
+    s = f1->Execute(std::to_string(i));
+    if (!s.ok()) {
+      printf("execute %d failed, %s\n", i, s.ToString().c_str());
+    }
+  }
+  ed = NowMicros();
+  printf("execute %d cost time microsecond(us) %ld, qps %llu\n",
+      item_num, ed - st, item_num * 1000000LL / (ed - st));
+
+  // the key value interface is not served with a user state machine
+  s = f1->Write("key", "value");
+  printf("write key value with state machine, %s\n", s.ToString().c_str());
+
+  sleep(1);
+  uint64_t expect = item_num * (item_num + 1ULL) / 2;
+  printf("expect %lu, node 1 %lu, node 2 %lu, node 3 %lu\n",
+      expect, sm1.counter(), sm2.counter(), sm3.counter());
+  int failed = 0;
+  if (sm1.counter() != expect || sm2.counter() != expect || sm3.counter() != expect) {
+    failed++;
+  }
+
+  // restarted node 3 is restored from its snapshot and applies the rest
+  delete f3;
+  CounterStateMachine sm3_restarted;
+  op3.state_machine = &sm3_restarted;
+  s = Floyd::Open(op3, &f3);
+  printf("reopen node 3, %s\n", s.ToString().c_str());
+  int cnt = 10;
+  while (cnt-- && sm3_restarted.counter() != expect) {
+    sleep(1);
+  }
+  printf("node 3 restarted %lu\n", sm3_restarted.counter());
+  if (sm3_restarted.counter() != expect) {
+    failed++;
+  }
+
+  delete f3;
+  delete f2;
+  delete f1;
+  printf("%s\n", failed == 0 ? "PASSED" : "FAILED");
+  return failed == 0 ? 0 : -1;
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <atomic>
+#include <iostream>
+#include <string>
+
+#include "floyd/include/floyd.h"
+#include "slash/include/testutil.h"
+
+using namespace floyd;
+uint64_t NowMicros() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast<uint64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+std::atomic<int> done(0);
+std::atomic<int> failed(0);
+
+void WaitDone(int n) {
+  while (done < n) {
+    usleep(1000);
+  }
+}
+
+int main()
+{
+  printf("testing AsyncWrite and AsyncRead, the writes are replicated by group commit\n");
+  Options op("127.0.0.1:8901,127.0.0.1:8902,127.0.0.1:8903", "127.0.0.1", 8901, "./data1/");
+  op.Dump();
+
+  Floyd *f1, *f2, *f3;
+
+  slash::Status s;
+  s = Floyd::Open(op, &f1);
+  printf("%s\n", s.ToString().c_str());
+
+  Options op2("127.0.0.1:8901,127.0.0.1:8902,127.0.0.1:8903", "127.0.0.1", 8902, "./data2/");
+  s = Floyd::Open(op2, &f2);
+  printf("%s\n", s.ToString().c_str());
+
+  Options op3("127.0.0.1:8901,127.0.0.1:8902,127.0.0.1:8903", "127.0.0.1", 8903, "./data3/");
+  s = Floyd::Open(op3, &f3);
+  printf("%s\n", s.ToString().c_str());
+
+  while (1) {
+    if (f1->HasLeader()) {
+      break;
+    }
+    printf("electing leader... sleep 2s\n");
+    sleep(2);
+  }
+
+  int item_num = 100000;
+  std::string mystr[100100];
+  for (int i = 0; i < item_num; i++) {
+    mystr[i] = slash::RandomString(10);
+  }
+
+  // all the writes are issued without waiting, from a follower or leader
+  uint64_t st = NowMicros(), ed;
+  for (int i = 0; i < item_num; i++) {
+    f1->AsyncWrite(mystr[i], mystr[i], [](const Status& ws) {
+      if (!ws.ok()) {
+        failed++;
+      }
+      done++;
+    });
+  }
+  WaitDone(item_num);
+  ed = NowMicros();
+  printf("async write %d cost time microsecond(us) %ld, qps %llu, failed %d\n",
+      item_num, ed - st, item_num * 1000000LL / (ed - st), failed.load());
+
+  done = 0;
+  failed = 0;
+  st = NowMicros();
+  for (int i = 0; i < item_num; i++) {
+    std::string key = mystr[i];
+    f2->AsyncRead(key, [key](const Status& rs, const std::string& value) {
+      if (!rs.ok() || value != key) {
+        failed++;
+      }
+      done++;
+    });
+  }
+  WaitDone(item_num);
+  ed = NowMicros();
+  printf("async read %d cost time microsecond(us) %ld, qps %llu, failed %d\n",
+      item_num, ed - st, item_num * 1000000LL / (ed - st), failed.load());
+
+  std::string msg;
+  f1->GetServerStatus(&msg);
+  printf("%s\n", msg.c_str());
+
+  getchar();
+  delete f3;
+  delete f2;
+  delete f1;
+  return 0;
+}
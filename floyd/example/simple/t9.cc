@@ -0,0 +1,90 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <iostream>
+#include <string>
+
+#include "floyd/include/floyd.h"
+#include "slash/include/testutil.h"
+
+using namespace floyd;
+uint64_t NowMicros() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast<uint64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+int main()
+{
+  printf("testing WriteBatch, the updates of a batch are applied atomically in one log entry\n");
+  Options op("127.0.0.1:8901,127.0.0.1:8902,127.0.0.1:8903", "127.0.0.1", 8901, "./data1/");
+  op.Dump();
+
+  Floyd *f1, *f2, *f3;
+
+  slash::Status s;
+  s = Floyd::Open(op, &f1);
+  printf("%s\n", s.ToString().c_str());
+
+  Options op2("127.0.0.1:8901,127.0.0.1:8902,127.0.0.1:8903", "127.0.0.1", 8902, "./data2/");
+  s = Floyd::Open(op2, &f2);
+  printf("%s\n", s.ToString().c_str());
+
+  Options op3("127.0.0.1:8901,127.0.0.1:8902,127.0.0.1:8903", "127.0.0.1", 8903, "./data3/");
+  s = Floyd::Open(op3, &f3);
+  printf("%s\n", s.ToString().c_str());
+
+  while (1) {
+    if (f1->HasLeader()) {
+      break;
+    }
+    printf("electing leader... sleep 2s\n");
+    sleep(2);
+  }
+
+  // batches of 100 puts
+  int batch_num = 1000;
+  int batch_count = 100;
+  uint64_t st = NowMicros(), ed;
+  for (int i = 0; i < batch_num; i++) {
+    WriteBatch batch;
+    for (int j = 0; j < batch_count; j++) {
+      std::string key = "batch" + std::to_string(i) + "_" + std::to_string(j);
+      batch.Put(key, key);
+    }
+    s = f1->Write(batch);
+    if (!s.ok()) {
+      printf("write batch %d failed, %s\n", i, s.ToString().c_str());
+    }
+  }
+  ed = NowMicros();
+  printf("write %d batches of %d cost time microsecond(us) %ld, qps %llu\n",
+      batch_num, batch_count, ed - st, batch_num * batch_count * 1000000LL / (ed - st));
+
+  // put and delete in one batch, a reader never sees only one of them
+  WriteBatch batch;
+  batch.Put("moved_to", "value");
+  batch.Delete("batch0_0");
+  s = f1->Write(batch);
+  printf("move batch0_0 to moved_to, %s\n", s.ToString().c_str());
+
+  std::string value;
+  s = f2->Read("batch0_0", &value);
+  printf("read batch0_0 from %s, %s\n", "f2", s.ToString().c_str());
+  s = f2->Read("moved_to", &value);
+  printf("read moved_to from %s, %s value %s\n", "f2", s.ToString().c_str(), value.c_str());
+  s = f3->Read("batch999_99", &value);
+  printf("read batch999_99 from %s, %s value %s\n", "f3", s.ToString().c_str(), value.c_str());
+
+  getchar();
+  delete f3;
+  delete f2;
+  delete f1;
+  return 0;
+}
@@ -8,14 +8,22 @@
 
 #include <string>
 #include <vector>
+#include <functional>
 
 #include "floyd/include/floyd_options.h"
+#include "floyd/include/floyd_state_machine.h"
+#include "floyd/include/floyd_write_batch.h"
 #include "slash/include/slash_status.h"
 
 namespace floyd {
 
 using slash::Status;
 
+// callbacks of the async interface, invoked by floyd's internal thread once
+// the command has been applied to the state machine, or has failed
+typedef std::function<void(const Status& s)> WriteCallback;
+typedef std::function<void(const Status& s, const std::string& value)> ReadCallback;
+
 class Floyd  {
  public:
   static Status Open(const Options& options, Floyd** floyd);
@@ -23,12 +31,28 @@ class Floyd  {
   Floyd() { }
   virtual ~Floyd();
 
+  // Incomplete and Timeout mean the result is unknown, the update may
+  // have been replicated and still be applied
   virtual Status Write(const std::string& key, const std::string& value) = 0;
+  // all updates in batch are replicated in one log entry and applied atomically
+  virtual Status Write(const WriteBatch& batch) = 0;
   virtual Status DirtyWrite(const std::string& key, const std::string& value) = 0;
   virtual Status Delete(const std::string& key) = 0;
   virtual Status Read(const std::string& key, std::string* value) = 0;
   virtual Status DirtyRead(const std::string& key, std::string* value) = 0;
 
+  // async version of Write, Delete and Read, which return immediately
+  virtual void AsyncWrite(const std::string& key, const std::string& value,
+                          const WriteCallback& callback) = 0;
+  virtual void AsyncWrite(const WriteBatch& batch, const WriteCallback& callback) = 0;
+  virtual void AsyncDelete(const std::string& key, const WriteCallback& callback) = 0;
+  virtual void AsyncRead(const std::string& key, const ReadCallback& callback) = 0;
+
+  // replicate an opaque command, which is applied to Options::state_machine.
+  // The key value interfaces above are only served without state_machine
+  virtual Status Execute(const std::string& command) = 0;
+  virtual void AsyncExecute(const std::string& command, const WriteCallback& callback) = 0;
+
   // return true if leader has been elected
   virtual bool GetLeader(std::string* ip_port) = 0;
   virtual bool GetLeader(std::string* ip, int* port) = 0;
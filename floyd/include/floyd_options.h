@@ -11,6 +11,8 @@
 
 namespace floyd {
 
+class StateMachine;
+
 // Logger Level
 enum {
   DEBUG_LEVEL = 0x01,
@@ -21,6 +23,17 @@ enum {
   NONE_LEVEL  = 0x06
 };
 
+// when the appended log entries are synced to disk
+enum LogSyncMode {
+  // left to the os, entries may be lost on machine crash
+  kSyncNone = 0,
+  // every append is synced before return
+  kSyncPerAppend = 1,
+  // a background thread syncs the entries written meanwhile in one fsync,
+  // appending returns after that
+  kSyncGroup = 2
+};
+
 struct Options {
   // cluster members
   // parsed from comma separated ip1:port1,ip2:port2...
@@ -32,6 +45,65 @@ struct Options {
   uint64_t heartbeat_us;
   uint64_t append_entries_size_once;
   uint64_t append_entries_count_once;
+  // max outstanding AppendEntries per peer, larger than 1 enables
+  // pipelined replication
+  uint64_t append_entries_window;
+  // bytes of recently appended log entries cached in memory
+  uint64_t log_cache_size;
+  // store raft log in segment files under path/filelog/ instead of rocksdb,
+  // each segment preallocates file_log_segment_size bytes
+  bool use_file_log;
+  uint64_t file_log_segment_size;
+  // an entry counts for commit and is acknowledged to leader only after it
+  // is durable under log_sync_mode
+  LogSyncMode log_sync_mode;
+  // leader side group commit: client commands arriving within
+  // group_commit_window_us are appended to the log as one batch, bounded by
+  // group_commit_size_once bytes and group_commit_count_once entries
+  uint64_t group_commit_window_us;
+  uint64_t group_commit_size_once;
+  uint64_t group_commit_count_once;
+  // leader serves Read locally while a quorum acknowledged its heartbeat
+  // within check_leader_us - lease_drift_us, the margin should cover the
+  // clock drift and the difference of check_leader_us between members
+  bool lease_read;
+  uint64_t lease_drift_us;
+  // take a snapshot of state machine under path/snapshot/ after
+  // snapshot_interval_count entries or snapshot_interval_size bytes of
+  // entries are applied, 0 disables the trigger and both are 0 by default.
+  // The log before the previous snapshot is deleted
+  uint64_t snapshot_interval_count;
+  uint64_t snapshot_interval_size;
+  // a follower lagging behind leader's log is sent the snapshot in chunks
+  // of install_snapshot_chunk_size bytes
+  uint64_t install_snapshot_chunk_size;
+  // commands passed to Floyd::Execute are applied to state_machine, which
+  // is not owned by floyd. NULL for the built-in rocksdb key value store
+  StateMachine* state_machine;
+  // the built-in key value store writes without its own WAL, the raft log
+  // after its flushed applied index is replayed on restart instead
+  bool disable_kv_wal;
+  // connections on local_port are accepted by a dispatch thread and spread
+  // over worker_thread_num threads, a connection stays on one of them, so a
+  // client command blocking until applied only delays the connections
+  // sharing its thread. worker_queue_limit bounds the connections waiting
+  // to be taken by each worker
+  int worker_thread_num;
+  int worker_queue_limit;
+  // larger than 0 to serve RequestVote, AppendEntries and InstallSnapshot
+  // in separate threads on local_port + consensus_port_offset, every
+  // member should use the same offset. With the default 0 they share the
+  // worker threads above, so a worker busy with client commands delays
+  // heartbeats of the connections on it and may cause spurious elections
+  // under heavy client load; it stays 0 to keep talking to members that
+  // only listen on local_port
+  int consensus_port_offset;
+  // connections kept to each member for forwarding commands and for the
+  // RPCs to peers, requests to the same member beyond it wait
+  int max_conns_per_member;
+  // a command forwarded to leader or waiting to be applied fails with
+  // Timeout after command_timeout_us, its result is unknown then
+  uint64_t command_timeout_us;
   bool single_mode;
 
   void SetMembers(const std::string& cluster_string);
@@ -0,0 +1,60 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#ifndef FLOYD_INCLUDE_FLOYD_STATE_MACHINE_H_
+#define FLOYD_INCLUDE_FLOYD_STATE_MACHINE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "slash/include/slash_status.h"
+
+namespace floyd {
+
+using slash::Status;
+
+/*
+ * StateMachine receives the commands passed to Floyd::Execute once they are
+ * committed, every member applies the same commands in the same order.
+ * All the methods are called in floyd's apply thread.
+ *
+ * When floyd starts, it continues applying after GetAppliedIndex. A state
+ * machine not supporting it is regarded as volatile, it is restored from the
+ * latest snapshot and the committed commands after the snapshot are applied
+ * again. Without a state machine in Options, floyd keeps a rocksdb key value
+ * store under path/db/ serving Write, Delete and Read.
+ */
+class StateMachine {
+ public:
+  StateMachine() { }
+  virtual ~StateMachine() { }
+
+  // apply the commands of consecutive committed log entries in order,
+  // last_index is the index of the last entry. floyd retries the whole
+  // batch if it fails
+  virtual Status ApplyBatch(uint64_t last_index,
+                            const std::vector<const std::string*>& commands) = 0;
+  // write the current state as regular files directly under directory
+  // path, which doesn't exist yet. floyd adds a file named FLOYD_SNAPSHOT
+  virtual Status Snapshot(const std::string& path) = 0;
+  // replace the current state with the snapshot under path, which has been
+  // written by Snapshot of some member. The files are only read
+  virtual Status Restore(const std::string& path) = 0;
+  // the last_index of the latest batch which survives a crash, NotFound if
+  // it is unknown, NotSupported if the state is lost on restart
+  virtual Status GetAppliedIndex(uint64_t* index) {
+    return Status::NotSupported("volatile state machine");
+  }
+
+ private:
+  // No copying allowed
+  StateMachine(const StateMachine&);
+  void operator=(const StateMachine&);
+};
+
+}  // namespace floyd
+#endif  // FLOYD_INCLUDE_FLOYD_STATE_MACHINE_H_
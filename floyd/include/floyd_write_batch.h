@@ -0,0 +1,63 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#ifndef FLOYD_INCLUDE_FLOYD_WRITE_BATCH_H_
+#define FLOYD_INCLUDE_FLOYD_WRITE_BATCH_H_
+
+#include <string>
+#include <vector>
+
+namespace floyd {
+
+// WriteBatch holds a collection of updates which are replicated as one
+// raft log entry and applied to the state machine atomically
+class WriteBatch {
+ public:
+  enum OpType {
+    kPut = 0,
+    kDelete = 1
+  };
+
+  struct Operation {
+    OpType type;
+    std::string key;
+    std::string value;
+  };
+
+  WriteBatch() { }
+
+  void Put(const std::string& key, const std::string& value) {
+    Operation op;
+    op.type = kPut;
+    op.key = key;
+    op.value = value;
+    ops_.push_back(op);
+  }
+
+  void Delete(const std::string& key) {
+    Operation op;
+    op.type = kDelete;
+    op.key = key;
+    ops_.push_back(op);
+  }
+
+  void Clear() {
+    ops_.clear();
+  }
+
+  size_t Count() const {
+    return ops_.size();
+  }
+
+  const std::vector<Operation>& ops() const {
+    return ops_;
+  }
+
+ private:
+  std::vector<Operation> ops_;
+};
+
+}  // namespace floyd
+#endif  // FLOYD_INCLUDE_FLOYD_WRITE_BATCH_H_
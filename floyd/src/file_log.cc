@@ -0,0 +1,587 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#include "floyd/src/file_log.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "slash/include/env.h"
+
+#include "floyd/src/logger.h"
+#include "floyd/include/floyd_options.h"
+
+namespace floyd {
+
+static const char* kDataSuffix = ".data";
+static const char* kIndexSuffix = ".index";
+static const size_t kLengthSize = sizeof(uint32_t);
+static const size_t kCrcSize = sizeof(uint32_t);
+static const size_t kHeaderSize = kLengthSize + kCrcSize;
+static const size_t kOffsetSize = sizeof(uint64_t);
+
+// crc32c, the Castagnoli polynomial in reversed form
+struct Crc32cTable {
+  uint32_t table[256];
+  Crc32cTable() {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? (c >> 1) ^ 0x82f63b78 : c >> 1;
+      }
+      table[i] = c;
+    }
+  }
+};
+
+static uint32_t Crc32c(uint32_t crc, const char* buf, size_t len) {
+  static const Crc32cTable crc_table;
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc = crc_table.table[(crc ^ static_cast<uint8_t>(buf[i])) & 0xff] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+static Status WriteAll(int fd, const char* buf, size_t len, uint64_t offset) {
+  while (len > 0) {
+    ssize_t n = pwrite(fd, buf, len, offset);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return Status::IOError("pwrite failed", strerror(errno));
+    }
+    buf += n;
+    len -= n;
+    offset += n;
+  }
+  return Status::OK();
+}
+
+static Status ReadAll(int fd, char* buf, size_t len, uint64_t offset) {
+  while (len > 0) {
+    ssize_t n = pread(fd, buf, len, offset);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return Status::IOError("pread failed", strerror(errno));
+    } else if (n == 0) {
+      return Status::Corruption("unexpected end of file");
+    }
+    buf += n;
+    len -= n;
+    offset += n;
+  }
+  return Status::OK();
+}
+
+FileLog::FileLog(const std::string& path, uint64_t segment_size, Logger* info_log)
+  : path_(path),
+    segment_size_(segment_size),
+    info_log_(info_log) {
+}
+
+FileLog::~FileLog() {
+  for (auto& iter : segments_) {
+    CloseSegment(iter.second, false);
+  }
+}
+
+std::string FileLog::DataFileName(uint64_t first_index) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%020lu", first_index);
+  return path_ + "/" + buf + kDataSuffix;
+}
+
+std::string FileLog::IndexFileName(uint64_t first_index) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%020lu", first_index);
+  return path_ + "/" + buf + kIndexSuffix;
+}
+
+Status FileLog::Open() {
+  slash::MutexLock l(&mu_);
+  slash::CreatePath(path_);
+  std::vector<std::string> children;
+  if (slash::GetChildren(path_, children) != 0) {
+    return Status::IOError("FileLog::Open list " + path_ + " failed");
+  }
+  std::vector<uint64_t> first_indexes;
+  size_t suffix_len = strlen(kIndexSuffix);
+  for (auto& name : children) {
+    if (name.size() > suffix_len
+        && name.compare(name.size() - suffix_len, suffix_len, kIndexSuffix) == 0) {
+      first_indexes.push_back(strtoull(name.c_str(), NULL, 10));
+    }
+  }
+  std::sort(first_indexes.begin(), first_indexes.end());
+
+  for (size_t i = 0; i < first_indexes.size(); i++) {
+    uint64_t first_index = first_indexes[i];
+    Segment* segment;
+    // without sync the index of the last segment may be written back before
+    // any of its data, check all of its entries
+    Status s = RecoverSegment(first_index, i + 1 == first_indexes.size(), &segment);
+    if (!s.ok()) {
+      LOGV(ERROR_LEVEL, info_log_, "FileLog::Open recover segment %lu failed, %s",
+           first_index, s.ToString().c_str());
+      return s;
+    }
+    segments_[first_index] = segment;
+  }
+  LOGV(INFO_LEVEL, info_log_, "FileLog::Open recover %lu segments from %s",
+       segments_.size(), path_.c_str());
+  return Status::OK();
+}
+
+Status FileLog::NewSegment(uint64_t first_index, Segment** segment) {
+  int data_fd = open(DataFileName(first_index).c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (data_fd < 0) {
+    return Status::IOError("FileLog open " + DataFileName(first_index) + " failed", strerror(errno));
+  }
+  int index_fd = open(IndexFileName(first_index).c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (index_fd < 0) {
+    close(data_fd);
+    return Status::IOError("FileLog open " + IndexFileName(first_index) + " failed", strerror(errno));
+  }
+  // preallocate the whole segment, so that appending doesn't change the file size
+  int ret = posix_fallocate(data_fd, 0, segment_size_);
+  if (ret != 0) {
+    LOGV(WARN_LEVEL, info_log_, "FileLog::NewSegment preallocate %s failed, %s",
+         DataFileName(first_index).c_str(), strerror(ret));
+  }
+
+  // an entry acknowledged in this segment must not vanish with its files
+  Status s = SyncDir();
+  if (!s.ok()) {
+    close(data_fd);
+    close(index_fd);
+    return s;
+  }
+
+  Segment* seg = new Segment();
+  seg->first_index = first_index;
+  seg->data_fd = data_fd;
+  seg->index_fd = index_fd;
+  seg->file_size = ret == 0 ? segment_size_ : 0;
+  seg->write_offset = 0;
+  seg->dirty = false;
+  *segment = seg;
+  LOGV(INFO_LEVEL, info_log_, "FileLog::NewSegment create segment %lu", first_index);
+  return Status::OK();
+}
+
+bool FileLog::VerifyRecord(const Segment* segment, uint64_t offset, uint64_t* end) {
+  char header[kHeaderSize];
+  if (offset + kHeaderSize > segment->file_size
+      || !ReadAll(segment->data_fd, header, kHeaderSize, offset).ok()) {
+    return false;
+  }
+  uint32_t length, crc;
+  memcpy(&length, header, kLengthSize);
+  memcpy(&crc, header + kLengthSize, kCrcSize);
+  length = be32toh(length);
+  if (offset + kHeaderSize + length > segment->file_size) {
+    return false;
+  }
+  std::string buf(length, '\0');
+  if (length > 0 && !ReadAll(segment->data_fd, &buf[0], length, offset + kHeaderSize).ok()) {
+    return false;
+  }
+  uint32_t actual = Crc32c(0, header, kLengthSize);
+  actual = Crc32c(actual, buf.data(), buf.size());
+  if (actual != be32toh(crc)) {
+    return false;
+  }
+  *end = offset + kHeaderSize + length;
+  return true;
+}
+
+Status FileLog::RecoverSegment(uint64_t first_index, bool verify_all, Segment** segment) {
+  int data_fd = open(DataFileName(first_index).c_str(), O_RDWR);
+  if (data_fd < 0) {
+    return Status::IOError("FileLog open " + DataFileName(first_index) + " failed", strerror(errno));
+  }
+  int index_fd = open(IndexFileName(first_index).c_str(), O_RDWR);
+  if (index_fd < 0) {
+    close(data_fd);
+    return Status::IOError("FileLog open " + IndexFileName(first_index) + " failed", strerror(errno));
+  }
+  Segment* seg = new Segment();
+  seg->first_index = first_index;
+  seg->data_fd = data_fd;
+  seg->index_fd = index_fd;
+  seg->write_offset = 0;
+  seg->dirty = false;
+
+  struct stat data_stat, index_stat;
+  if (fstat(data_fd, &data_stat) != 0 || fstat(index_fd, &index_stat) != 0) {
+    CloseSegment(seg, false);
+    return Status::IOError("FileLog stat segment failed", strerror(errno));
+  }
+  seg->file_size = data_stat.st_size;
+
+  size_t count = index_stat.st_size / kOffsetSize;
+  std::string index_buf(count * kOffsetSize, '\0');
+  Status s = ReadAll(index_fd, &index_buf[0], index_buf.size(), 0);
+  if (!s.ok()) {
+    CloseSegment(seg, false);
+    return s;
+  }
+  for (size_t i = 0; i < count; i++) {
+    uint64_t offset;
+    memcpy(&offset, index_buf.data() + i * kOffsetSize, kOffsetSize);
+    seg->offsets.push_back(be64toh(offset));
+  }
+
+  // drop the entries whose data is not completely written, and those after
+  uint64_t end;
+  if (verify_all) {
+    size_t valid = 0;
+    while (valid < seg->offsets.size()
+        && seg->offsets[valid] == seg->write_offset
+        && VerifyRecord(seg, seg->offsets[valid], &end)) {
+      seg->write_offset = end;
+      valid++;
+    }
+    seg->offsets.resize(valid);
+  } else {
+    while (!seg->offsets.empty()) {
+      if (VerifyRecord(seg, seg->offsets.back(), &end)) {
+        seg->write_offset = end;
+        break;
+      }
+      seg->offsets.pop_back();
+    }
+  }
+  if (seg->offsets.size() != count) {
+    LOGV(WARN_LEVEL, info_log_, "FileLog::RecoverSegment segment %lu drop %lu broken entries",
+         first_index, count - seg->offsets.size());
+    if (ftruncate(index_fd, seg->offsets.size() * kOffsetSize) != 0) {
+      CloseSegment(seg, false);
+      return Status::IOError("FileLog truncate index failed", strerror(errno));
+    }
+  }
+  *segment = seg;
+  return Status::OK();
+}
+
+Status FileLog::WriteSegment(Segment* segment, const std::string& data,
+                             const std::vector<uint64_t>& offsets, bool sync) {
+  if (offsets.empty()) {
+    return Status::OK();
+  }
+  // data is written before index, an entry exists only if its offset is recorded
+  Status s = WriteAll(segment->data_fd, data.data(), data.size(), segment->write_offset);
+  if (!s.ok()) {
+    return s;
+  }
+  if (sync && fdatasync(segment->data_fd) != 0) {
+    return Status::IOError("FileLog sync data failed", strerror(errno));
+  }
+  std::string index_buf;
+  for (auto offset : offsets) {
+    uint64_t num = htobe64(offset);
+    index_buf.append(reinterpret_cast<char*>(&num), kOffsetSize);
+  }
+  s = WriteAll(segment->index_fd, index_buf.data(), index_buf.size(),
+               segment->offsets.size() * kOffsetSize);
+  if (!s.ok()) {
+    return s;
+  }
+  segment->offsets.insert(segment->offsets.end(), offsets.begin(), offsets.end());
+  segment->write_offset += data.size();
+  segment->file_size = std::max(segment->file_size, segment->write_offset);
+  segment->dirty = true;
+  return Status::OK();
+}
+
+// data is synced before index, as it is written
+Status FileLog::SyncFiles(int data_fd, int index_fd) {
+  if (fdatasync(data_fd) != 0) {
+    return Status::IOError("FileLog sync data failed", strerror(errno));
+  }
+  if (fdatasync(index_fd) != 0) {
+    return Status::IOError("FileLog sync index failed", strerror(errno));
+  }
+  return Status::OK();
+}
+
+Status FileLog::SyncDir() {
+  int fd = open(path_.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return Status::IOError("FileLog open " + path_ + " failed", strerror(errno));
+  }
+  int ret = fsync(fd);
+  close(fd);
+  if (ret != 0) {
+    return Status::IOError("FileLog sync " + path_ + " failed", strerror(errno));
+  }
+  return Status::OK();
+}
+
+// the index file is removed first, a segment without it is ignored on recovery
+void FileLog::CloseSegment(Segment* segment, bool remove) {
+  close(segment->data_fd);
+  close(segment->index_fd);
+  if (remove) {
+    slash::DeleteFile(IndexFileName(segment->first_index));
+    slash::DeleteFile(DataFileName(segment->first_index));
+  }
+  delete segment;
+}
+
+uint64_t FileLog::GetLastIndex() {
+  slash::MutexLock l(&mu_);
+  if (segments_.empty()) {
+    return 0;
+  }
+  return segments_.rbegin()->second->last_index();
+}
+
+Status FileLog::Append(uint64_t first_index,
+                       const std::vector<const std::string *> &bufs,
+                       bool sync) {
+  slash::MutexLock l(&mu_);
+  Segment* segment = NULL;
+  if (!segments_.empty()) {
+    segment = segments_.rbegin()->second;
+    if (first_index != segment->last_index() + 1) {
+      return Status::Corruption("FileLog::Append entries are not continuous");
+    }
+  }
+
+  // entries of the same segment are written together
+  Status s;
+  std::string data;
+  std::vector<uint64_t> offsets;
+  uint64_t offset = segment == NULL ? 0 : segment->write_offset;
+  for (size_t i = 0; i < bufs.size(); i++) {
+    uint64_t record_size = kHeaderSize + bufs[i]->size();
+    bool empty = segment == NULL || (segment->offsets.empty() && offsets.empty());
+    // a segment holds at least one entry, even if it is larger than segment size
+    if (segment == NULL || (!empty && offset + record_size > segment->file_size)) {
+      if (segment != NULL) {
+        s = WriteSegment(segment, data, offsets, sync);
+        if (!s.ok()) {
+          return s;
+        }
+      }
+      data.clear();
+      offsets.clear();
+      s = NewSegment(first_index + i, &segment);
+      if (!s.ok()) {
+        return s;
+      }
+      segments_[first_index + i] = segment;
+      offset = 0;
+    }
+    offsets.push_back(offset);
+    uint32_t length = htobe32(bufs[i]->size());
+    uint32_t crc = Crc32c(0, reinterpret_cast<char*>(&length), kLengthSize);
+    crc = htobe32(Crc32c(crc, bufs[i]->data(), bufs[i]->size()));
+    data.append(reinterpret_cast<char*>(&length), kLengthSize);
+    data.append(reinterpret_cast<char*>(&crc), kCrcSize);
+    data.append(*bufs[i]);
+    offset += record_size;
+  }
+  if (segment == NULL) {
+    return Status::OK();
+  }
+  s = WriteSegment(segment, data, offsets, sync);
+  if (!s.ok() || !sync) {
+    return s;
+  }
+  for (auto& iter : segments_) {
+    if (iter.second->dirty) {
+      s = SyncFiles(iter.second->data_fd, iter.second->index_fd);
+      if (!s.ok()) {
+        return s;
+      }
+      iter.second->dirty = false;
+    }
+  }
+  return Status::OK();
+}
+
+/*
+ * the dirty segments are synced through duplicated fds without holding mu_,
+ * so that Append goes on during the sync and the segments may be closed
+ */
+Status FileLog::Sync() {
+  std::vector<std::pair<uint64_t, std::pair<int, int> > > fds;
+  {
+  slash::MutexLock l(&mu_);
+  for (auto& iter : segments_) {
+    Segment* segment = iter.second;
+    if (!segment->dirty) {
+      continue;
+    }
+    int data_fd = dup(segment->data_fd);
+    int index_fd = data_fd < 0 ? -1 : dup(segment->index_fd);
+    if (index_fd < 0) {
+      Status s = Status::IOError("FileLog::Sync dup failed", strerror(errno));
+      if (data_fd >= 0) {
+        close(data_fd);
+      }
+      for (auto& fd : fds) {
+        close(fd.second.first);
+        close(fd.second.second);
+      }
+      return s;
+    }
+    segment->dirty = false;
+    fds.push_back(std::make_pair(iter.first, std::make_pair(data_fd, index_fd)));
+  }
+  }
+
+  Status s;
+  std::vector<uint64_t> failed;
+  for (auto& fd : fds) {
+    Status ss = SyncFiles(fd.second.first, fd.second.second);
+    if (!ss.ok()) {
+      s = ss;
+      failed.push_back(fd.first);
+    }
+    close(fd.second.first);
+    close(fd.second.second);
+  }
+  if (!failed.empty()) {
+    // keep them dirty for the next sync
+    slash::MutexLock l(&mu_);
+    for (auto first_index : failed) {
+      auto iter = segments_.find(first_index);
+      if (iter != segments_.end()) {
+        iter->second->dirty = true;
+      }
+    }
+  }
+  return s;
+}
+
+Status FileLog::Get(uint64_t index, std::string *buf) {
+  slash::MutexLock l(&mu_);
+  auto iter = segments_.upper_bound(index);
+  if (iter == segments_.begin()) {
+    return Status::NotFound("entry not found");
+  }
+  Segment* segment = (--iter)->second;
+  if (segment->offsets.empty() || index > segment->last_index()) {
+    return Status::NotFound("entry not found");
+  }
+  size_t i = index - segment->first_index;
+  uint64_t begin = segment->offsets[i] + kHeaderSize;
+  uint64_t end = i + 1 < segment->offsets.size() ? segment->offsets[i + 1] : segment->write_offset;
+  buf->resize(end - begin);
+  if (buf->empty()) {
+    return Status::OK();
+  }
+  return ReadAll(segment->data_fd, &(*buf)[0], buf->size(), begin);
+}
+
+// the entries of a segment are contiguous in data file, read them at once
+Status FileLog::Scan(uint64_t first_index, uint64_t last_index,
+                     std::vector<std::string> *bufs) {
+  slash::MutexLock l(&mu_);
+  uint64_t index = first_index;
+  while (index <= last_index) {
+    auto iter = segments_.upper_bound(index);
+    if (iter == segments_.begin()) {
+      return Status::NotFound("entry not found");
+    }
+    Segment* segment = (--iter)->second;
+    if (segment->offsets.empty() || index > segment->last_index()) {
+      return Status::NotFound("entry not found");
+    }
+    uint64_t last = std::min(last_index, segment->last_index());
+    size_t first_i = index - segment->first_index;
+    size_t last_i = last - segment->first_index;
+    uint64_t begin = segment->offsets[first_i];
+    uint64_t end = last_i + 1 < segment->offsets.size() ?
+      segment->offsets[last_i + 1] : segment->write_offset;
+    std::string data(end - begin, '\0');
+    Status s = ReadAll(segment->data_fd, &data[0], data.size(), begin);
+    if (!s.ok()) {
+      return s;
+    }
+    for (size_t i = first_i; i <= last_i; i++) {
+      uint64_t entry_begin = segment->offsets[i] - begin + kHeaderSize;
+      uint64_t entry_end = (i + 1 < segment->offsets.size() ?
+        segment->offsets[i + 1] : segment->write_offset) - begin;
+      bufs->push_back(data.substr(entry_begin, entry_end - entry_begin));
+    }
+    index = last + 1;
+  }
+  return Status::OK();
+}
+
+Status FileLog::TruncateSuffix(uint64_t index) {
+  slash::MutexLock l(&mu_);
+  bool removed = false;
+  while (!segments_.empty() && segments_.rbegin()->first >= index) {
+    CloseSegment(segments_.rbegin()->second, true);
+    segments_.erase(segments_.rbegin()->first);
+    removed = true;
+  }
+  // the truncated entries must not come back after a crash
+  if (removed) {
+    Status s = SyncDir();
+    if (!s.ok()) {
+      return s;
+    }
+  }
+  if (segments_.empty()) {
+    return Status::OK();
+  }
+  Segment* segment = segments_.rbegin()->second;
+  if (segment->offsets.empty() || index > segment->last_index()) {
+    return Status::OK();
+  }
+  // only rewrite the index, the data behind write_offset will be overwritten
+  size_t count = index - segment->first_index;
+  segment->write_offset = segment->offsets[count];
+  segment->offsets.resize(count);
+  if (ftruncate(segment->index_fd, count * kOffsetSize) != 0) {
+    return Status::IOError("FileLog::TruncateSuffix truncate index failed", strerror(errno));
+  }
+  if (fdatasync(segment->index_fd) != 0) {
+    return Status::IOError("FileLog::TruncateSuffix sync index failed", strerror(errno));
+  }
+  segment->dirty = true;
+  return Status::OK();
+}
+
+Status FileLog::TruncatePrefix(uint64_t index) {
+  slash::MutexLock l(&mu_);
+  // remove a segment when the next one begins no later than index,
+  // so the last segment is always kept
+  bool removed = false;
+  while (segments_.size() > 1) {
+    auto next = segments_.begin();
+    next++;
+    if (next->first > index) {
+      break;
+    }
+    LOGV(INFO_LEVEL, info_log_, "FileLog::TruncatePrefix remove segment %lu", segments_.begin()->first);
+    CloseSegment(segments_.begin()->second, true);
+    segments_.erase(segments_.begin());
+    removed = true;
+  }
+  return removed ? SyncDir() : Status::OK();
+}
+
+}  // namespace floyd
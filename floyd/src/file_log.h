@@ -0,0 +1,105 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#ifndef FLOYD_SRC_FILE_LOG_H_
+#define FLOYD_SRC_FILE_LOG_H_
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "slash/include/slash_mutex.h"
+#include "slash/include/slash_status.h"
+
+#include "floyd/src/log_storage.h"
+
+namespace floyd {
+
+using slash::Status;
+
+class Logger;
+
+/*
+ * FileLog stores entries in preallocated segment files, a segment is named
+ * by the index of its first entry and consists of two files
+ *   data file  : | length(uint32) | crc(uint32) | entry | length(uint32) | ...
+ *   index file : | offset(uint64) | offset(uint64) | ...
+ * the index file records where each entry begins and decides which entries
+ * exist, so truncating the tail only rewrites the index, and truncating the
+ * prefix deletes whole segments. crc covers length and entry, it tells the
+ * zeroed preallocated space from the entries written before a crash.
+ */
+class FileLog : public LogStorage {
+ public:
+  FileLog(const std::string& path, uint64_t segment_size, Logger* info_log);
+  virtual ~FileLog();
+
+  // recover segments from path
+  Status Open();
+
+  virtual uint64_t GetLastIndex();
+  virtual Status Append(uint64_t first_index,
+                        const std::vector<const std::string *> &bufs,
+                        bool sync);
+  virtual Status Sync();
+  virtual Status Get(uint64_t index, std::string *buf);
+  virtual Status Scan(uint64_t first_index, uint64_t last_index,
+                      std::vector<std::string> *bufs);
+  virtual Status TruncateSuffix(uint64_t index);
+  virtual Status TruncatePrefix(uint64_t index);
+
+ private:
+  struct Segment {
+    uint64_t first_index;
+    int data_fd;
+    int index_fd;
+    // preallocated size of data file
+    uint64_t file_size;
+    // end of the last entry in data file
+    uint64_t write_offset;
+    // begin of each entry in data file
+    std::vector<uint64_t> offsets;
+    // written since last sync
+    bool dirty;
+
+    uint64_t last_index() const {
+      return first_index + offsets.size() - 1;
+    }
+  };
+
+  std::string path_;
+  uint64_t segment_size_;
+  Logger* info_log_;
+
+  // protect segments_
+  slash::Mutex mu_;
+  // segments ordered by their first index
+  std::map<uint64_t, Segment*> segments_;
+
+  std::string DataFileName(uint64_t first_index);
+  std::string IndexFileName(uint64_t first_index);
+  Status NewSegment(uint64_t first_index, Segment** segment);
+  // check every entry if verify_all, otherwise only the tail entries
+  // until a valid one
+  Status RecoverSegment(uint64_t first_index, bool verify_all, Segment** segment);
+  // return true if a valid record begins at offset, set its end
+  bool VerifyRecord(const Segment* segment, uint64_t offset, uint64_t* end);
+  // write the buffered entries at the tail of segment, the data is synced
+  // before the index is written if sync
+  Status WriteSegment(Segment* segment, const std::string& data,
+                      const std::vector<uint64_t>& offsets, bool sync);
+  void CloseSegment(Segment* segment, bool remove);
+  Status SyncFiles(int data_fd, int index_fd);
+  // make the creation and removal of segment files durable
+  Status SyncDir();
+
+  FileLog(const FileLog&);
+  void operator=(const FileLog&);
+};
+
+}  // namespace floyd
+#endif  // FLOYD_SRC_FILE_LOG_H_
@@ -1,1609 +1,4458 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: floyd.proto
 
-#ifndef PROTOBUF_floyd_2eproto__INCLUDED
-#define PROTOBUF_floyd_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_floyd_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_floyd_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_floyd_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_floyd_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_floyd_2eproto;
 namespace floyd {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_floyd_2eproto();
-void protobuf_AssignDesc_floyd_2eproto();
-void protobuf_ShutdownFile_floyd_2eproto();
-
-class Entry;
 class CmdRequest;
+struct CmdRequestDefaultTypeInternal;
+extern CmdRequestDefaultTypeInternal _CmdRequest_default_instance_;
+class CmdRequest_AppendEntries;
+struct CmdRequest_AppendEntriesDefaultTypeInternal;
+extern CmdRequest_AppendEntriesDefaultTypeInternal _CmdRequest_AppendEntries_default_instance_;
+class CmdRequest_InstallSnapshot;
+struct CmdRequest_InstallSnapshotDefaultTypeInternal;
+extern CmdRequest_InstallSnapshotDefaultTypeInternal _CmdRequest_InstallSnapshot_default_instance_;
 class CmdRequest_Kv;
-class CmdRequest_User;
+struct CmdRequest_KvDefaultTypeInternal;
+extern CmdRequest_KvDefaultTypeInternal _CmdRequest_Kv_default_instance_;
 class CmdRequest_RequestVote;
-class CmdRequest_AppendEntries;
+struct CmdRequest_RequestVoteDefaultTypeInternal;
+extern CmdRequest_RequestVoteDefaultTypeInternal _CmdRequest_RequestVote_default_instance_;
 class CmdRequest_ServerStatus;
+struct CmdRequest_ServerStatusDefaultTypeInternal;
+extern CmdRequest_ServerStatusDefaultTypeInternal _CmdRequest_ServerStatus_default_instance_;
+class CmdRequest_User;
+struct CmdRequest_UserDefaultTypeInternal;
+extern CmdRequest_UserDefaultTypeInternal _CmdRequest_User_default_instance_;
+class CmdRequest_WriteBatch;
+struct CmdRequest_WriteBatchDefaultTypeInternal;
+extern CmdRequest_WriteBatchDefaultTypeInternal _CmdRequest_WriteBatch_default_instance_;
 class CmdResponse;
+struct CmdResponseDefaultTypeInternal;
+extern CmdResponseDefaultTypeInternal _CmdResponse_default_instance_;
+class CmdResponse_AppendEntriesResponse;
+struct CmdResponse_AppendEntriesResponseDefaultTypeInternal;
+extern CmdResponse_AppendEntriesResponseDefaultTypeInternal _CmdResponse_AppendEntriesResponse_default_instance_;
+class CmdResponse_InstallSnapshotResponse;
+struct CmdResponse_InstallSnapshotResponseDefaultTypeInternal;
+extern CmdResponse_InstallSnapshotResponseDefaultTypeInternal _CmdResponse_InstallSnapshotResponse_default_instance_;
 class CmdResponse_Kv;
+struct CmdResponse_KvDefaultTypeInternal;
+extern CmdResponse_KvDefaultTypeInternal _CmdResponse_Kv_default_instance_;
 class CmdResponse_Kvs;
+struct CmdResponse_KvsDefaultTypeInternal;
+extern CmdResponse_KvsDefaultTypeInternal _CmdResponse_Kvs_default_instance_;
+class CmdResponse_ReadIndexResponse;
+struct CmdResponse_ReadIndexResponseDefaultTypeInternal;
+extern CmdResponse_ReadIndexResponseDefaultTypeInternal _CmdResponse_ReadIndexResponse_default_instance_;
 class CmdResponse_RequestVoteResponse;
-class CmdResponse_AppendEntriesResponse;
+struct CmdResponse_RequestVoteResponseDefaultTypeInternal;
+extern CmdResponse_RequestVoteResponseDefaultTypeInternal _CmdResponse_RequestVoteResponse_default_instance_;
 class CmdResponse_ServerStatus;
+struct CmdResponse_ServerStatusDefaultTypeInternal;
+extern CmdResponse_ServerStatusDefaultTypeInternal _CmdResponse_ServerStatus_default_instance_;
+class Entry;
+struct EntryDefaultTypeInternal;
+extern EntryDefaultTypeInternal _Entry_default_instance_;
+class Entry_Operation;
+struct Entry_OperationDefaultTypeInternal;
+extern Entry_OperationDefaultTypeInternal _Entry_Operation_default_instance_;
+class HardState;
+struct HardStateDefaultTypeInternal;
+extern HardStateDefaultTypeInternal _HardState_default_instance_;
+class KvCommand;
+struct KvCommandDefaultTypeInternal;
+extern KvCommandDefaultTypeInternal _KvCommand_default_instance_;
+}  // namespace floyd
+PROTOBUF_NAMESPACE_OPEN
+template<> ::floyd::CmdRequest* Arena::CreateMaybeMessage<::floyd::CmdRequest>(Arena*);
+template<> ::floyd::CmdRequest_AppendEntries* Arena::CreateMaybeMessage<::floyd::CmdRequest_AppendEntries>(Arena*);
+template<> ::floyd::CmdRequest_InstallSnapshot* Arena::CreateMaybeMessage<::floyd::CmdRequest_InstallSnapshot>(Arena*);
+template<> ::floyd::CmdRequest_Kv* Arena::CreateMaybeMessage<::floyd::CmdRequest_Kv>(Arena*);
+template<> ::floyd::CmdRequest_RequestVote* Arena::CreateMaybeMessage<::floyd::CmdRequest_RequestVote>(Arena*);
+template<> ::floyd::CmdRequest_ServerStatus* Arena::CreateMaybeMessage<::floyd::CmdRequest_ServerStatus>(Arena*);
+template<> ::floyd::CmdRequest_User* Arena::CreateMaybeMessage<::floyd::CmdRequest_User>(Arena*);
+template<> ::floyd::CmdRequest_WriteBatch* Arena::CreateMaybeMessage<::floyd::CmdRequest_WriteBatch>(Arena*);
+template<> ::floyd::CmdResponse* Arena::CreateMaybeMessage<::floyd::CmdResponse>(Arena*);
+template<> ::floyd::CmdResponse_AppendEntriesResponse* Arena::CreateMaybeMessage<::floyd::CmdResponse_AppendEntriesResponse>(Arena*);
+template<> ::floyd::CmdResponse_InstallSnapshotResponse* Arena::CreateMaybeMessage<::floyd::CmdResponse_InstallSnapshotResponse>(Arena*);
+template<> ::floyd::CmdResponse_Kv* Arena::CreateMaybeMessage<::floyd::CmdResponse_Kv>(Arena*);
+template<> ::floyd::CmdResponse_Kvs* Arena::CreateMaybeMessage<::floyd::CmdResponse_Kvs>(Arena*);
+template<> ::floyd::CmdResponse_ReadIndexResponse* Arena::CreateMaybeMessage<::floyd::CmdResponse_ReadIndexResponse>(Arena*);
+template<> ::floyd::CmdResponse_RequestVoteResponse* Arena::CreateMaybeMessage<::floyd::CmdResponse_RequestVoteResponse>(Arena*);
+template<> ::floyd::CmdResponse_ServerStatus* Arena::CreateMaybeMessage<::floyd::CmdResponse_ServerStatus>(Arena*);
+template<> ::floyd::Entry* Arena::CreateMaybeMessage<::floyd::Entry>(Arena*);
+template<> ::floyd::Entry_Operation* Arena::CreateMaybeMessage<::floyd::Entry_Operation>(Arena*);
+template<> ::floyd::HardState* Arena::CreateMaybeMessage<::floyd::HardState>(Arena*);
+template<> ::floyd::KvCommand* Arena::CreateMaybeMessage<::floyd::KvCommand>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace floyd {
 
-enum Entry_OpType {
+enum Entry_OpType : int {
   Entry_OpType_kRead = 0,
   Entry_OpType_kWrite = 1,
-  Entry_OpType_kDelete = 2
+  Entry_OpType_kDelete = 2,
+  Entry_OpType_kWriteBatch = 3,
+  Entry_OpType_kCommand = 4,
+  Entry_OpType_kNoOp = 5
 };
 bool Entry_OpType_IsValid(int value);
-const Entry_OpType Entry_OpType_OpType_MIN = Entry_OpType_kRead;
-const Entry_OpType Entry_OpType_OpType_MAX = Entry_OpType_kDelete;
-const int Entry_OpType_OpType_ARRAYSIZE = Entry_OpType_OpType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Entry_OpType_descriptor();
-inline const ::std::string& Entry_OpType_Name(Entry_OpType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Entry_OpType_descriptor(), value);
+constexpr Entry_OpType Entry_OpType_OpType_MIN = Entry_OpType_kRead;
+constexpr Entry_OpType Entry_OpType_OpType_MAX = Entry_OpType_kNoOp;
+constexpr int Entry_OpType_OpType_ARRAYSIZE = Entry_OpType_OpType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Entry_OpType_descriptor();
+template<typename T>
+inline const std::string& Entry_OpType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Entry_OpType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Entry_OpType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Entry_OpType_descriptor(), enum_t_value);
 }
 inline bool Entry_OpType_Parse(
-    const ::std::string& name, Entry_OpType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Entry_OpType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Entry_OpType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Entry_OpType>(
     Entry_OpType_descriptor(), name, value);
 }
-enum Type {
+enum Type : int {
   kRead = 0,
   kWrite = 1,
   kDirtyWrite = 2,
   kDelete = 3,
+  kWriteBatch = 4,
   kRequestVote = 8,
   kAppendEntries = 9,
-  kServerStatus = 10
+  kServerStatus = 10,
+  kReadIndex = 11,
+  kInstallSnapshot = 12,
+  kCommand = 13,
+  kForwardBatch = 14
 };
 bool Type_IsValid(int value);
-const Type Type_MIN = kRead;
-const Type Type_MAX = kServerStatus;
-const int Type_ARRAYSIZE = Type_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Type_descriptor();
-inline const ::std::string& Type_Name(Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Type_descriptor(), value);
+constexpr Type Type_MIN = kRead;
+constexpr Type Type_MAX = kForwardBatch;
+constexpr int Type_ARRAYSIZE = Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Type_descriptor();
+template<typename T>
+inline const std::string& Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Type_descriptor(), enum_t_value);
 }
 inline bool Type_Parse(
-    const ::std::string& name, Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Type>(
     Type_descriptor(), name, value);
 }
-enum StatusCode {
+enum StatusCode : int {
   kOk = 0,
   kNotFound = 1,
   kError = 2
 };
 bool StatusCode_IsValid(int value);
-const StatusCode StatusCode_MIN = kOk;
-const StatusCode StatusCode_MAX = kError;
-const int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* StatusCode_descriptor();
-inline const ::std::string& StatusCode_Name(StatusCode value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    StatusCode_descriptor(), value);
+constexpr StatusCode StatusCode_MIN = kOk;
+constexpr StatusCode StatusCode_MAX = kError;
+constexpr int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor();
+template<typename T>
+inline const std::string& StatusCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StatusCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StatusCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StatusCode_descriptor(), enum_t_value);
 }
 inline bool StatusCode_Parse(
-    const ::std::string& name, StatusCode* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<StatusCode>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatusCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatusCode>(
     StatusCode_descriptor(), name, value);
 }
 // ===================================================================
 
-class Entry : public ::google::protobuf::Message {
+class Entry_Operation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.Entry.Operation) */ {
+ public:
+  inline Entry_Operation() : Entry_Operation(nullptr) {}
+  ~Entry_Operation() override;
+  explicit PROTOBUF_CONSTEXPR Entry_Operation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Entry_Operation(const Entry_Operation& from);
+  Entry_Operation(Entry_Operation&& from) noexcept
+    : Entry_Operation() {
+    *this = ::std::move(from);
+  }
+
+  inline Entry_Operation& operator=(const Entry_Operation& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Entry_Operation& operator=(Entry_Operation&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Entry_Operation& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Entry_Operation* internal_default_instance() {
+    return reinterpret_cast<const Entry_Operation*>(
+               &_Entry_Operation_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Entry_Operation& a, Entry_Operation& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Entry_Operation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Entry_Operation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Entry_Operation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Entry_Operation>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Entry_Operation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Entry_Operation& from) {
+    Entry_Operation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Entry_Operation* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.Entry.Operation";
+  }
+  protected:
+  explicit Entry_Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kOptypeFieldNumber = 1,
+  };
+  // required bytes key = 2;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // optional bytes value = 3;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // required .floyd.Entry.OpType optype = 1;
+  bool has_optype() const;
+  private:
+  bool _internal_has_optype() const;
+  public:
+  void clear_optype();
+  ::floyd::Entry_OpType optype() const;
+  void set_optype(::floyd::Entry_OpType value);
+  private:
+  ::floyd::Entry_OpType _internal_optype() const;
+  void _internal_set_optype(::floyd::Entry_OpType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:floyd.Entry.Operation)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int optype_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.Entry) */ {
  public:
-  Entry();
-  virtual ~Entry();
+  inline Entry() : Entry(nullptr) {}
+  ~Entry() override;
+  explicit PROTOBUF_CONSTEXPR Entry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Entry(const Entry& from);
+  Entry(Entry&& from) noexcept
+    : Entry() {
+    *this = ::std::move(from);
+  }
 
   inline Entry& operator=(const Entry& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Entry& operator=(Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Entry& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Entry* internal_default_instance() {
+    return reinterpret_cast<const Entry*>(
+               &_Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(Entry* other);
+  friend void swap(Entry& a, Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Entry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Entry* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Entry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Entry& from);
-  void MergeFrom(const Entry& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Entry& from) {
+    Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Entry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.Entry";
+  }
+  protected:
+  explicit Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef Entry_Operation Operation;
+
   typedef Entry_OpType OpType;
-  static const OpType kRead = Entry_OpType_kRead;
-  static const OpType kWrite = Entry_OpType_kWrite;
-  static const OpType kDelete = Entry_OpType_kDelete;
+  static constexpr OpType kRead =
+    Entry_OpType_kRead;
+  static constexpr OpType kWrite =
+    Entry_OpType_kWrite;
+  static constexpr OpType kDelete =
+    Entry_OpType_kDelete;
+  static constexpr OpType kWriteBatch =
+    Entry_OpType_kWriteBatch;
+  static constexpr OpType kCommand =
+    Entry_OpType_kCommand;
+  static constexpr OpType kNoOp =
+    Entry_OpType_kNoOp;
   static inline bool OpType_IsValid(int value) {
     return Entry_OpType_IsValid(value);
   }
-  static const OpType OpType_MIN =
+  static constexpr OpType OpType_MIN =
     Entry_OpType_OpType_MIN;
-  static const OpType OpType_MAX =
+  static constexpr OpType OpType_MAX =
     Entry_OpType_OpType_MAX;
-  static const int OpType_ARRAYSIZE =
+  static constexpr int OpType_ARRAYSIZE =
     Entry_OpType_OpType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   OpType_descriptor() {
     return Entry_OpType_descriptor();
   }
-  static inline const ::std::string& OpType_Name(OpType value) {
-    return Entry_OpType_Name(value);
+  template<typename T>
+  static inline const std::string& OpType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, OpType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function OpType_Name.");
+    return Entry_OpType_Name(enum_t_value);
   }
-  static inline bool OpType_Parse(const ::std::string& name,
+  static inline bool OpType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       OpType* value) {
     return Entry_OpType_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
-  // required uint64 term = 1;
-  inline bool has_term() const;
-  inline void clear_term();
-  static const int kTermFieldNumber = 1;
-  inline ::google::protobuf::uint64 term() const;
-  inline void set_term(::google::protobuf::uint64 value);
+  enum : int {
+    kOpsFieldNumber = 5,
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kCommandFieldNumber = 6,
+    kTermFieldNumber = 1,
+    kOptypeFieldNumber = 4,
+  };
+  // repeated .floyd.Entry.Operation ops = 5;
+  int ops_size() const;
+  private:
+  int _internal_ops_size() const;
+  public:
+  void clear_ops();
+  ::floyd::Entry_Operation* mutable_ops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >*
+      mutable_ops();
+  private:
+  const ::floyd::Entry_Operation& _internal_ops(int index) const;
+  ::floyd::Entry_Operation* _internal_add_ops();
+  public:
+  const ::floyd::Entry_Operation& ops(int index) const;
+  ::floyd::Entry_Operation* add_ops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >&
+      ops() const;
 
   // required string key = 2;
-  inline bool has_key() const;
-  inline void clear_key();
-  static const int kKeyFieldNumber = 2;
-  inline const ::std::string& key() const;
-  inline void set_key(const ::std::string& value);
-  inline void set_key(const char* value);
-  inline void set_key(const char* value, size_t size);
-  inline ::std::string* mutable_key();
-  inline ::std::string* release_key();
-  inline void set_allocated_key(::std::string* key);
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
   // optional bytes value = 3;
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 3;
-  inline const ::std::string& value() const;
-  inline void set_value(const ::std::string& value);
-  inline void set_value(const char* value);
-  inline void set_value(const void* value, size_t size);
-  inline ::std::string* mutable_value();
-  inline ::std::string* release_value();
-  inline void set_allocated_value(::std::string* value);
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // optional bytes command = 6;
+  bool has_command() const;
+  private:
+  bool _internal_has_command() const;
+  public:
+  void clear_command();
+  const std::string& command() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_command();
+  PROTOBUF_NODISCARD std::string* release_command();
+  void set_allocated_command(std::string* command);
+  private:
+  const std::string& _internal_command() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
+  std::string* _internal_mutable_command();
+  public:
+
+  // required uint64 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
 
   // required .floyd.Entry.OpType optype = 4;
-  inline bool has_optype() const;
-  inline void clear_optype();
-  static const int kOptypeFieldNumber = 4;
-  inline ::floyd::Entry_OpType optype() const;
-  inline void set_optype(::floyd::Entry_OpType value);
+  bool has_optype() const;
+  private:
+  bool _internal_has_optype() const;
+  public:
+  void clear_optype();
+  ::floyd::Entry_OpType optype() const;
+  void set_optype(::floyd::Entry_OpType value);
+  private:
+  ::floyd::Entry_OpType _internal_optype() const;
+  void _internal_set_optype(::floyd::Entry_OpType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:floyd.Entry)
  private:
-  inline void set_has_term();
-  inline void clear_has_term();
-  inline void set_has_key();
-  inline void clear_has_key();
-  inline void set_has_value();
-  inline void clear_has_value();
-  inline void set_has_optype();
-  inline void clear_has_optype();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint64 term_;
-  ::std::string* key_;
-  ::std::string* value_;
-  int optype_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
-
-  void InitAsDefaultInstance();
-  static Entry* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation > ops_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    uint64_t term_;
+    int optype_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_Kv : public ::google::protobuf::Message {
+class KvCommand final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.KvCommand) */ {
  public:
-  CmdRequest_Kv();
-  virtual ~CmdRequest_Kv();
+  inline KvCommand() : KvCommand(nullptr) {}
+  ~KvCommand() override;
+  explicit PROTOBUF_CONSTEXPR KvCommand(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_Kv(const CmdRequest_Kv& from);
+  KvCommand(const KvCommand& from);
+  KvCommand(KvCommand&& from) noexcept
+    : KvCommand() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_Kv& operator=(const CmdRequest_Kv& from) {
+  inline KvCommand& operator=(const KvCommand& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline KvCommand& operator=(KvCommand&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_Kv& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KvCommand& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KvCommand* internal_default_instance() {
+    return reinterpret_cast<const KvCommand*>(
+               &_KvCommand_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(CmdRequest_Kv* other);
+  friend void swap(KvCommand& a, KvCommand& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KvCommand* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KvCommand* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_Kv* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_Kv& from);
-  void MergeFrom(const CmdRequest_Kv& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  KvCommand* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KvCommand>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const KvCommand& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KvCommand& from) {
+    KvCommand::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // required bytes key = 1;
-  inline bool has_key() const;
-  inline void clear_key();
-  static const int kKeyFieldNumber = 1;
-  inline const ::std::string& key() const;
-  inline void set_key(const ::std::string& value);
-  inline void set_key(const char* value);
-  inline void set_key(const void* value, size_t size);
-  inline ::std::string* mutable_key();
-  inline ::std::string* release_key();
-  inline void set_allocated_key(::std::string* key);
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KvCommand* other);
 
-  // optional bytes value = 2;
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 2;
-  inline const ::std::string& value() const;
-  inline void set_value(const ::std::string& value);
-  inline void set_value(const char* value);
-  inline void set_value(const void* value, size_t size);
-  inline ::std::string* mutable_value();
-  inline ::std::string* release_value();
-  inline void set_allocated_value(::std::string* value);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.KvCommand";
+  }
+  protected:
+  explicit KvCommand(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.Kv)
- private:
-  inline void set_has_key();
-  inline void clear_has_key();
-  inline void set_has_value();
-  inline void clear_has_value();
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::std::string* key_;
-  ::std::string* value_;
+  // nested types ----------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // accessors -------------------------------------------------------
 
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
+  enum : int {
+    kOpsFieldNumber = 1,
+  };
+  // repeated .floyd.Entry.Operation ops = 1;
+  int ops_size() const;
+  private:
+  int _internal_ops_size() const;
+  public:
+  void clear_ops();
+  ::floyd::Entry_Operation* mutable_ops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >*
+      mutable_ops();
+  private:
+  const ::floyd::Entry_Operation& _internal_ops(int index) const;
+  ::floyd::Entry_Operation* _internal_add_ops();
+  public:
+  const ::floyd::Entry_Operation& ops(int index) const;
+  ::floyd::Entry_Operation* add_ops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >&
+      ops() const;
 
-  void InitAsDefaultInstance();
-  static CmdRequest_Kv* default_instance_;
+  // @@protoc_insertion_point(class_scope:floyd.KvCommand)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation > ops_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_User : public ::google::protobuf::Message {
+class HardState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.HardState) */ {
  public:
-  CmdRequest_User();
-  virtual ~CmdRequest_User();
+  inline HardState() : HardState(nullptr) {}
+  ~HardState() override;
+  explicit PROTOBUF_CONSTEXPR HardState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_User(const CmdRequest_User& from);
+  HardState(const HardState& from);
+  HardState(HardState&& from) noexcept
+    : HardState() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_User& operator=(const CmdRequest_User& from) {
+  inline HardState& operator=(const HardState& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline HardState& operator=(HardState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_User& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HardState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HardState* internal_default_instance() {
+    return reinterpret_cast<const HardState*>(
+               &_HardState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(CmdRequest_User* other);
+  friend void swap(HardState& a, HardState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HardState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HardState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_User* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_User& from);
-  void MergeFrom(const CmdRequest_User& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  HardState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HardState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HardState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HardState& from) {
+    HardState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HardState* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.HardState";
+  }
+  protected:
+  explicit HardState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required bytes ip = 1;
-  inline bool has_ip() const;
-  inline void clear_ip();
-  static const int kIpFieldNumber = 1;
-  inline const ::std::string& ip() const;
-  inline void set_ip(const ::std::string& value);
-  inline void set_ip(const char* value);
-  inline void set_ip(const void* value, size_t size);
-  inline ::std::string* mutable_ip();
-  inline ::std::string* release_ip();
-  inline void set_allocated_ip(::std::string* ip);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // required int32 port = 2;
-  inline bool has_port() const;
-  inline void clear_port();
-  static const int kPortFieldNumber = 2;
-  inline ::google::protobuf::int32 port() const;
-  inline void set_port(::google::protobuf::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.User)
- private:
-  inline void set_has_ip();
-  inline void clear_has_ip();
-  inline void set_has_port();
-  inline void clear_has_port();
+  // nested types ----------------------------------------------------
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVotedForIpFieldNumber = 2,
+    kCurrentTermFieldNumber = 1,
+    kCommitIndexFieldNumber = 4,
+    kVotedForPortFieldNumber = 3,
+  };
+  // optional bytes voted_for_ip = 2;
+  bool has_voted_for_ip() const;
+  private:
+  bool _internal_has_voted_for_ip() const;
+  public:
+  void clear_voted_for_ip();
+  const std::string& voted_for_ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_voted_for_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_voted_for_ip();
+  PROTOBUF_NODISCARD std::string* release_voted_for_ip();
+  void set_allocated_voted_for_ip(std::string* voted_for_ip);
+  private:
+  const std::string& _internal_voted_for_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_voted_for_ip(const std::string& value);
+  std::string* _internal_mutable_voted_for_ip();
+  public:
 
-  ::std::string* ip_;
-  ::google::protobuf::int32 port_;
+  // required uint64 current_term = 1;
+  bool has_current_term() const;
+  private:
+  bool _internal_has_current_term() const;
+  public:
+  void clear_current_term();
+  uint64_t current_term() const;
+  void set_current_term(uint64_t value);
+  private:
+  uint64_t _internal_current_term() const;
+  void _internal_set_current_term(uint64_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // optional uint64 commit_index = 4;
+  bool has_commit_index() const;
+  private:
+  bool _internal_has_commit_index() const;
+  public:
+  void clear_commit_index();
+  uint64_t commit_index() const;
+  void set_commit_index(uint64_t value);
+  private:
+  uint64_t _internal_commit_index() const;
+  void _internal_set_commit_index(uint64_t value);
+  public:
 
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
+  // optional int32 voted_for_port = 3;
+  bool has_voted_for_port() const;
+  private:
+  bool _internal_has_voted_for_port() const;
+  public:
+  void clear_voted_for_port();
+  int32_t voted_for_port() const;
+  void set_voted_for_port(int32_t value);
+  private:
+  int32_t _internal_voted_for_port() const;
+  void _internal_set_voted_for_port(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdRequest_User* default_instance_;
+  // @@protoc_insertion_point(class_scope:floyd.HardState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr voted_for_ip_;
+    uint64_t current_term_;
+    uint64_t commit_index_;
+    int32_t voted_for_port_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_RequestVote : public ::google::protobuf::Message {
+class CmdRequest_Kv final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdRequest.Kv) */ {
  public:
-  CmdRequest_RequestVote();
-  virtual ~CmdRequest_RequestVote();
+  inline CmdRequest_Kv() : CmdRequest_Kv(nullptr) {}
+  ~CmdRequest_Kv() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_Kv(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_RequestVote(const CmdRequest_RequestVote& from);
+  CmdRequest_Kv(const CmdRequest_Kv& from);
+  CmdRequest_Kv(CmdRequest_Kv&& from) noexcept
+    : CmdRequest_Kv() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_RequestVote& operator=(const CmdRequest_RequestVote& from) {
+  inline CmdRequest_Kv& operator=(const CmdRequest_Kv& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_Kv& operator=(CmdRequest_Kv&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_RequestVote& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_Kv& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_Kv* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_Kv*>(
+               &_CmdRequest_Kv_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(CmdRequest_RequestVote* other);
+  friend void swap(CmdRequest_Kv& a, CmdRequest_Kv& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_Kv* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_Kv* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_RequestVote* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_RequestVote& from);
-  void MergeFrom(const CmdRequest_RequestVote& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_Kv* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_Kv>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_Kv& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_Kv& from) {
+    CmdRequest_Kv::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // nested types ----------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_Kv* other);
 
-  // accessors -------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdRequest.Kv";
+  }
+  protected:
+  explicit CmdRequest_Kv(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // required uint64 term = 1;
-  inline bool has_term() const;
-  inline void clear_term();
-  static const int kTermFieldNumber = 1;
-  inline ::google::protobuf::uint64 term() const;
-  inline void set_term(::google::protobuf::uint64 value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // required bytes ip = 2;
-  inline bool has_ip() const;
-  inline void clear_ip();
-  static const int kIpFieldNumber = 2;
-  inline const ::std::string& ip() const;
-  inline void set_ip(const ::std::string& value);
-  inline void set_ip(const char* value);
-  inline void set_ip(const void* value, size_t size);
-  inline ::std::string* mutable_ip();
-  inline ::std::string* release_ip();
-  inline void set_allocated_ip(::std::string* ip);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // required int32 port = 3;
-  inline bool has_port() const;
-  inline void clear_port();
-  static const int kPortFieldNumber = 3;
-  inline ::google::protobuf::int32 port() const;
-  inline void set_port(::google::protobuf::int32 value);
+  // nested types ----------------------------------------------------
 
-  // required uint64 last_log_index = 4;
-  inline bool has_last_log_index() const;
-  inline void clear_last_log_index();
-  static const int kLastLogIndexFieldNumber = 4;
-  inline ::google::protobuf::uint64 last_log_index() const;
-  inline void set_last_log_index(::google::protobuf::uint64 value);
+  // accessors -------------------------------------------------------
 
-  // required uint64 last_log_term = 5;
-  inline bool has_last_log_term() const;
-  inline void clear_last_log_term();
-  static const int kLastLogTermFieldNumber = 5;
-  inline ::google::protobuf::uint64 last_log_term() const;
-  inline void set_last_log_term(::google::protobuf::uint64 value);
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // required bytes key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.RequestVote)
+  // optional bytes value = 2;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.Kv)
  private:
-  inline void set_has_term();
-  inline void clear_has_term();
-  inline void set_has_ip();
-  inline void clear_has_ip();
-  inline void set_has_port();
-  inline void clear_has_port();
-  inline void set_has_last_log_index();
-  inline void clear_has_last_log_index();
-  inline void set_has_last_log_term();
-  inline void clear_has_last_log_term();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint64 term_;
-  ::std::string* ip_;
-  ::google::protobuf::uint64 last_log_index_;
-  ::google::protobuf::uint64 last_log_term_;
-  ::google::protobuf::int32 port_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
-
-  void InitAsDefaultInstance();
-  static CmdRequest_RequestVote* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_AppendEntries : public ::google::protobuf::Message {
+class CmdRequest_User final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdRequest.User) */ {
  public:
-  CmdRequest_AppendEntries();
-  virtual ~CmdRequest_AppendEntries();
+  inline CmdRequest_User() : CmdRequest_User(nullptr) {}
+  ~CmdRequest_User() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_User(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_AppendEntries(const CmdRequest_AppendEntries& from);
+  CmdRequest_User(const CmdRequest_User& from);
+  CmdRequest_User(CmdRequest_User&& from) noexcept
+    : CmdRequest_User() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_AppendEntries& operator=(const CmdRequest_AppendEntries& from) {
+  inline CmdRequest_User& operator=(const CmdRequest_User& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_User& operator=(CmdRequest_User&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_AppendEntries& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_User& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_User* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_User*>(
+               &_CmdRequest_User_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(CmdRequest_AppendEntries* other);
+  friend void swap(CmdRequest_User& a, CmdRequest_User& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_User* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_User* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_AppendEntries* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_AppendEntries& from);
-  void MergeFrom(const CmdRequest_AppendEntries& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest_User* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_User>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_User& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_User& from) {
+    CmdRequest_User::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_User* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdRequest.User";
+  }
+  protected:
+  explicit CmdRequest_User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIpFieldNumber = 1,
+    kPortFieldNumber = 2,
+  };
   // required bytes ip = 1;
-  inline bool has_ip() const;
-  inline void clear_ip();
-  static const int kIpFieldNumber = 1;
-  inline const ::std::string& ip() const;
-  inline void set_ip(const ::std::string& value);
-  inline void set_ip(const char* value);
-  inline void set_ip(const void* value, size_t size);
-  inline ::std::string* mutable_ip();
-  inline ::std::string* release_ip();
-  inline void set_allocated_ip(::std::string* ip);
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
 
   // required int32 port = 2;
-  inline bool has_port() const;
-  inline void clear_port();
-  static const int kPortFieldNumber = 2;
-  inline ::google::protobuf::int32 port() const;
-  inline void set_port(::google::protobuf::int32 value);
-
-  // required uint64 term = 3;
-  inline bool has_term() const;
-  inline void clear_term();
-  static const int kTermFieldNumber = 3;
-  inline ::google::protobuf::uint64 term() const;
-  inline void set_term(::google::protobuf::uint64 value);
-
-  // required uint64 prev_log_index = 4;
-  inline bool has_prev_log_index() const;
-  inline void clear_prev_log_index();
-  static const int kPrevLogIndexFieldNumber = 4;
-  inline ::google::protobuf::uint64 prev_log_index() const;
-  inline void set_prev_log_index(::google::protobuf::uint64 value);
-
-  // required uint64 prev_log_term = 5;
-  inline bool has_prev_log_term() const;
-  inline void clear_prev_log_term();
-  static const int kPrevLogTermFieldNumber = 5;
-  inline ::google::protobuf::uint64 prev_log_term() const;
-  inline void set_prev_log_term(::google::protobuf::uint64 value);
-
-  // required uint64 leader_commit = 6;
-  inline bool has_leader_commit() const;
-  inline void clear_leader_commit();
-  static const int kLeaderCommitFieldNumber = 6;
-  inline ::google::protobuf::uint64 leader_commit() const;
-  inline void set_leader_commit(::google::protobuf::uint64 value);
-
-  // repeated .floyd.Entry entries = 7;
-  inline int entries_size() const;
-  inline void clear_entries();
-  static const int kEntriesFieldNumber = 7;
-  inline const ::floyd::Entry& entries(int index) const;
-  inline ::floyd::Entry* mutable_entries(int index);
-  inline ::floyd::Entry* add_entries();
-  inline const ::google::protobuf::RepeatedPtrField< ::floyd::Entry >&
-      entries() const;
-  inline ::google::protobuf::RepeatedPtrField< ::floyd::Entry >*
-      mutable_entries();
+  bool has_port() const;
+  private:
+  bool _internal_has_port() const;
+  public:
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.AppendEntries)
+  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.User)
  private:
-  inline void set_has_ip();
-  inline void clear_has_ip();
-  inline void set_has_port();
-  inline void clear_has_port();
-  inline void set_has_term();
-  inline void clear_has_term();
-  inline void set_has_prev_log_index();
-  inline void clear_has_prev_log_index();
-  inline void set_has_prev_log_term();
-  inline void clear_has_prev_log_term();
-  inline void set_has_leader_commit();
-  inline void clear_has_leader_commit();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* ip_;
-  ::google::protobuf::uint64 term_;
-  ::google::protobuf::uint64 prev_log_index_;
-  ::google::protobuf::uint64 prev_log_term_;
-  ::google::protobuf::uint64 leader_commit_;
-  ::google::protobuf::RepeatedPtrField< ::floyd::Entry > entries_;
-  ::google::protobuf::int32 port_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(7 + 31) / 32];
-
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
-
-  void InitAsDefaultInstance();
-  static CmdRequest_AppendEntries* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t port_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest_ServerStatus : public ::google::protobuf::Message {
+class CmdRequest_RequestVote final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdRequest.RequestVote) */ {
  public:
-  CmdRequest_ServerStatus();
-  virtual ~CmdRequest_ServerStatus();
+  inline CmdRequest_RequestVote() : CmdRequest_RequestVote(nullptr) {}
+  ~CmdRequest_RequestVote() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_RequestVote(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest_ServerStatus(const CmdRequest_ServerStatus& from);
+  CmdRequest_RequestVote(const CmdRequest_RequestVote& from);
+  CmdRequest_RequestVote(CmdRequest_RequestVote&& from) noexcept
+    : CmdRequest_RequestVote() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest_ServerStatus& operator=(const CmdRequest_ServerStatus& from) {
+  inline CmdRequest_RequestVote& operator=(const CmdRequest_RequestVote& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_RequestVote& operator=(CmdRequest_RequestVote&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest_ServerStatus& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_RequestVote& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_RequestVote* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_RequestVote*>(
+               &_CmdRequest_RequestVote_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(CmdRequest_ServerStatus* other);
+  friend void swap(CmdRequest_RequestVote& a, CmdRequest_RequestVote& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_RequestVote* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_RequestVote* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest_ServerStatus* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest_ServerStatus& from);
-  void MergeFrom(const CmdRequest_ServerStatus& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest_RequestVote* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_RequestVote>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_RequestVote& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_RequestVote& from) {
+    CmdRequest_RequestVote::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_RequestVote* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdRequest.RequestVote";
+  }
+  protected:
+  explicit CmdRequest_RequestVote(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int64 term = 1;
-  inline bool has_term() const;
-  inline void clear_term();
-  static const int kTermFieldNumber = 1;
-  inline ::google::protobuf::int64 term() const;
-  inline void set_term(::google::protobuf::int64 value);
+  enum : int {
+    kIpFieldNumber = 2,
+    kTermFieldNumber = 1,
+    kLastLogIndexFieldNumber = 4,
+    kLastLogTermFieldNumber = 5,
+    kPortFieldNumber = 3,
+  };
+  // required bytes ip = 2;
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
 
-  // required int64 commit_index = 2;
-  inline bool has_commit_index() const;
-  inline void clear_commit_index();
-  static const int kCommitIndexFieldNumber = 2;
-  inline ::google::protobuf::int64 commit_index() const;
-  inline void set_commit_index(::google::protobuf::int64 value);
+  // required uint64 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
 
-  // optional bytes ip = 3;
-  inline bool has_ip() const;
-  inline void clear_ip();
-  static const int kIpFieldNumber = 3;
-  inline const ::std::string& ip() const;
-  inline void set_ip(const ::std::string& value);
-  inline void set_ip(const char* value);
-  inline void set_ip(const void* value, size_t size);
-  inline ::std::string* mutable_ip();
-  inline ::std::string* release_ip();
-  inline void set_allocated_ip(::std::string* ip);
+  // required uint64 last_log_index = 4;
+  bool has_last_log_index() const;
+  private:
+  bool _internal_has_last_log_index() const;
+  public:
+  void clear_last_log_index();
+  uint64_t last_log_index() const;
+  void set_last_log_index(uint64_t value);
+  private:
+  uint64_t _internal_last_log_index() const;
+  void _internal_set_last_log_index(uint64_t value);
+  public:
 
-  // optional int32 port = 4;
-  inline bool has_port() const;
-  inline void clear_port();
-  static const int kPortFieldNumber = 4;
-  inline ::google::protobuf::int32 port() const;
-  inline void set_port(::google::protobuf::int32 value);
+  // required uint64 last_log_term = 5;
+  bool has_last_log_term() const;
+  private:
+  bool _internal_has_last_log_term() const;
+  public:
+  void clear_last_log_term();
+  uint64_t last_log_term() const;
+  void set_last_log_term(uint64_t value);
+  private:
+  uint64_t _internal_last_log_term() const;
+  void _internal_set_last_log_term(uint64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.ServerStatus)
+  // required int32 port = 3;
+  bool has_port() const;
+  private:
+  bool _internal_has_port() const;
+  public:
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.RequestVote)
  private:
-  inline void set_has_term();
-  inline void clear_has_term();
-  inline void set_has_commit_index();
-  inline void clear_has_commit_index();
-  inline void set_has_ip();
-  inline void clear_has_ip();
-  inline void set_has_port();
-  inline void clear_has_port();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int64 term_;
-  ::google::protobuf::int64 commit_index_;
-  ::std::string* ip_;
-  ::google::protobuf::int32 port_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
-
-  void InitAsDefaultInstance();
-  static CmdRequest_ServerStatus* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    uint64_t term_;
+    uint64_t last_log_index_;
+    uint64_t last_log_term_;
+    int32_t port_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdRequest : public ::google::protobuf::Message {
+class CmdRequest_AppendEntries final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdRequest.AppendEntries) */ {
  public:
-  CmdRequest();
-  virtual ~CmdRequest();
+  inline CmdRequest_AppendEntries() : CmdRequest_AppendEntries(nullptr) {}
+  ~CmdRequest_AppendEntries() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_AppendEntries(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdRequest(const CmdRequest& from);
+  CmdRequest_AppendEntries(const CmdRequest_AppendEntries& from);
+  CmdRequest_AppendEntries(CmdRequest_AppendEntries&& from) noexcept
+    : CmdRequest_AppendEntries() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdRequest& operator=(const CmdRequest& from) {
+  inline CmdRequest_AppendEntries& operator=(const CmdRequest_AppendEntries& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_AppendEntries& operator=(CmdRequest_AppendEntries&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_AppendEntries& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_AppendEntries* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_AppendEntries*>(
+               &_CmdRequest_AppendEntries_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(CmdRequest* other);
+  friend void swap(CmdRequest_AppendEntries& a, CmdRequest_AppendEntries& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_AppendEntries* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_AppendEntries* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdRequest* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdRequest& from);
-  void MergeFrom(const CmdRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest_AppendEntries* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_AppendEntries>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_AppendEntries& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_AppendEntries& from) {
+    CmdRequest_AppendEntries::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_AppendEntries* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdRequest.AppendEntries";
+  }
+  protected:
+  explicit CmdRequest_AppendEntries(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // nested types ----------------------------------------------------
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  typedef CmdRequest_Kv Kv;
-  typedef CmdRequest_User User;
-  typedef CmdRequest_RequestVote RequestVote;
-  typedef CmdRequest_AppendEntries AppendEntries;
-  typedef CmdRequest_ServerStatus ServerStatus;
+  // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required .floyd.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::floyd::Type type() const;
-  inline void set_type(::floyd::Type value);
+  enum : int {
+    kEntriesFieldNumber = 7,
+    kIpFieldNumber = 2,
+    kTermFieldNumber = 1,
+    kPrevLogIndexFieldNumber = 4,
+    kPrevLogTermFieldNumber = 5,
+    kLeaderCommitFieldNumber = 6,
+    kPortFieldNumber = 3,
+  };
+  // repeated bytes entries = 7;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  const std::string& entries(int index) const;
+  std::string* mutable_entries(int index);
+  void set_entries(int index, const std::string& value);
+  void set_entries(int index, std::string&& value);
+  void set_entries(int index, const char* value);
+  void set_entries(int index, const void* value, size_t size);
+  std::string* add_entries();
+  void add_entries(const std::string& value);
+  void add_entries(std::string&& value);
+  void add_entries(const char* value);
+  void add_entries(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& entries() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_entries();
+  private:
+  const std::string& _internal_entries(int index) const;
+  std::string* _internal_add_entries();
+  public:
 
-  // optional .floyd.CmdRequest.Kv kv = 2;
-  inline bool has_kv() const;
-  inline void clear_kv();
-  static const int kKvFieldNumber = 2;
-  inline const ::floyd::CmdRequest_Kv& kv() const;
-  inline ::floyd::CmdRequest_Kv* mutable_kv();
-  inline ::floyd::CmdRequest_Kv* release_kv();
-  inline void set_allocated_kv(::floyd::CmdRequest_Kv* kv);
+  // required bytes ip = 2;
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
 
-  // optional .floyd.CmdRequest.User user = 3;
-  inline bool has_user() const;
-  inline void clear_user();
-  static const int kUserFieldNumber = 3;
-  inline const ::floyd::CmdRequest_User& user() const;
-  inline ::floyd::CmdRequest_User* mutable_user();
-  inline ::floyd::CmdRequest_User* release_user();
-  inline void set_allocated_user(::floyd::CmdRequest_User* user);
+  // required uint64 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
 
-  // optional .floyd.CmdRequest.RequestVote request_vote = 4;
-  inline bool has_request_vote() const;
-  inline void clear_request_vote();
-  static const int kRequestVoteFieldNumber = 4;
-  inline const ::floyd::CmdRequest_RequestVote& request_vote() const;
-  inline ::floyd::CmdRequest_RequestVote* mutable_request_vote();
-  inline ::floyd::CmdRequest_RequestVote* release_request_vote();
-  inline void set_allocated_request_vote(::floyd::CmdRequest_RequestVote* request_vote);
+  // required uint64 prev_log_index = 4;
+  bool has_prev_log_index() const;
+  private:
+  bool _internal_has_prev_log_index() const;
+  public:
+  void clear_prev_log_index();
+  uint64_t prev_log_index() const;
+  void set_prev_log_index(uint64_t value);
+  private:
+  uint64_t _internal_prev_log_index() const;
+  void _internal_set_prev_log_index(uint64_t value);
+  public:
 
-  // optional .floyd.CmdRequest.AppendEntries append_entries = 5;
-  inline bool has_append_entries() const;
-  inline void clear_append_entries();
-  static const int kAppendEntriesFieldNumber = 5;
-  inline const ::floyd::CmdRequest_AppendEntries& append_entries() const;
-  inline ::floyd::CmdRequest_AppendEntries* mutable_append_entries();
-  inline ::floyd::CmdRequest_AppendEntries* release_append_entries();
-  inline void set_allocated_append_entries(::floyd::CmdRequest_AppendEntries* append_entries);
+  // required uint64 prev_log_term = 5;
+  bool has_prev_log_term() const;
+  private:
+  bool _internal_has_prev_log_term() const;
+  public:
+  void clear_prev_log_term();
+  uint64_t prev_log_term() const;
+  void set_prev_log_term(uint64_t value);
+  private:
+  uint64_t _internal_prev_log_term() const;
+  void _internal_set_prev_log_term(uint64_t value);
+  public:
 
-  // optional .floyd.CmdRequest.ServerStatus server_status = 6;
-  inline bool has_server_status() const;
-  inline void clear_server_status();
-  static const int kServerStatusFieldNumber = 6;
-  inline const ::floyd::CmdRequest_ServerStatus& server_status() const;
-  inline ::floyd::CmdRequest_ServerStatus* mutable_server_status();
-  inline ::floyd::CmdRequest_ServerStatus* release_server_status();
-  inline void set_allocated_server_status(::floyd::CmdRequest_ServerStatus* server_status);
+  // required uint64 leader_commit = 6;
+  bool has_leader_commit() const;
+  private:
+  bool _internal_has_leader_commit() const;
+  public:
+  void clear_leader_commit();
+  uint64_t leader_commit() const;
+  void set_leader_commit(uint64_t value);
+  private:
+  uint64_t _internal_leader_commit() const;
+  void _internal_set_leader_commit(uint64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdRequest)
+  // required int32 port = 3;
+  bool has_port() const;
+  private:
+  bool _internal_has_port() const;
+  public:
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.AppendEntries)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_kv();
-  inline void clear_has_kv();
-  inline void set_has_user();
-  inline void clear_has_user();
-  inline void set_has_request_vote();
-  inline void clear_has_request_vote();
-  inline void set_has_append_entries();
-  inline void clear_has_append_entries();
-  inline void set_has_server_status();
-  inline void clear_has_server_status();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::floyd::CmdRequest_Kv* kv_;
-  ::floyd::CmdRequest_User* user_;
-  ::floyd::CmdRequest_RequestVote* request_vote_;
-  ::floyd::CmdRequest_AppendEntries* append_entries_;
-  ::floyd::CmdRequest_ServerStatus* server_status_;
-  int type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
-
-  void InitAsDefaultInstance();
-  static CmdRequest* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    uint64_t term_;
+    uint64_t prev_log_index_;
+    uint64_t prev_log_term_;
+    uint64_t leader_commit_;
+    int32_t port_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_Kv : public ::google::protobuf::Message {
+class CmdRequest_ServerStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdRequest.ServerStatus) */ {
  public:
-  CmdResponse_Kv();
-  virtual ~CmdResponse_Kv();
+  inline CmdRequest_ServerStatus() : CmdRequest_ServerStatus(nullptr) {}
+  ~CmdRequest_ServerStatus() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_ServerStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_Kv(const CmdResponse_Kv& from);
+  CmdRequest_ServerStatus(const CmdRequest_ServerStatus& from);
+  CmdRequest_ServerStatus(CmdRequest_ServerStatus&& from) noexcept
+    : CmdRequest_ServerStatus() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_Kv& operator=(const CmdResponse_Kv& from) {
+  inline CmdRequest_ServerStatus& operator=(const CmdRequest_ServerStatus& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_ServerStatus& operator=(CmdRequest_ServerStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_Kv& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_ServerStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_ServerStatus* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_ServerStatus*>(
+               &_CmdRequest_ServerStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(CmdResponse_Kv* other);
+  friend void swap(CmdRequest_ServerStatus& a, CmdRequest_ServerStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_ServerStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_ServerStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_Kv* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_Kv& from);
-  void MergeFrom(const CmdResponse_Kv& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest_ServerStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_ServerStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_ServerStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_ServerStatus& from) {
+    CmdRequest_ServerStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_ServerStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdRequest.ServerStatus";
+  }
+  protected:
+  explicit CmdRequest_ServerStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bytes value = 1;
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 1;
-  inline const ::std::string& value() const;
-  inline void set_value(const ::std::string& value);
-  inline void set_value(const char* value);
-  inline void set_value(const void* value, size_t size);
-  inline ::std::string* mutable_value();
-  inline ::std::string* release_value();
-  inline void set_allocated_value(::std::string* value);
-
-  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.Kv)
- private:
-  inline void set_has_value();
-  inline void clear_has_value();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  enum : int {
+    kIpFieldNumber = 3,
+    kTermFieldNumber = 1,
+    kCommitIndexFieldNumber = 2,
+    kPortFieldNumber = 4,
+  };
+  // optional bytes ip = 3;
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
 
-  ::std::string* value_;
+  // required int64 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  int64_t term() const;
+  void set_term(int64_t value);
+  private:
+  int64_t _internal_term() const;
+  void _internal_set_term(int64_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  // required int64 commit_index = 2;
+  bool has_commit_index() const;
+  private:
+  bool _internal_has_commit_index() const;
+  public:
+  void clear_commit_index();
+  int64_t commit_index() const;
+  void set_commit_index(int64_t value);
+  private:
+  int64_t _internal_commit_index() const;
+  void _internal_set_commit_index(int64_t value);
+  public:
 
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
+  // optional int32 port = 4;
+  bool has_port() const;
+  private:
+  bool _internal_has_port() const;
+  public:
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdResponse_Kv* default_instance_;
+  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.ServerStatus)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int64_t term_;
+    int64_t commit_index_;
+    int32_t port_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_Kvs : public ::google::protobuf::Message {
+class CmdRequest_WriteBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdRequest.WriteBatch) */ {
  public:
-  CmdResponse_Kvs();
-  virtual ~CmdResponse_Kvs();
+  inline CmdRequest_WriteBatch() : CmdRequest_WriteBatch(nullptr) {}
+  ~CmdRequest_WriteBatch() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_WriteBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_Kvs(const CmdResponse_Kvs& from);
+  CmdRequest_WriteBatch(const CmdRequest_WriteBatch& from);
+  CmdRequest_WriteBatch(CmdRequest_WriteBatch&& from) noexcept
+    : CmdRequest_WriteBatch() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_Kvs& operator=(const CmdResponse_Kvs& from) {
+  inline CmdRequest_WriteBatch& operator=(const CmdRequest_WriteBatch& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_WriteBatch& operator=(CmdRequest_WriteBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_Kvs& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_WriteBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_WriteBatch* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_WriteBatch*>(
+               &_CmdRequest_WriteBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void Swap(CmdResponse_Kvs* other);
+  friend void swap(CmdRequest_WriteBatch& a, CmdRequest_WriteBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_WriteBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_WriteBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_Kvs* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_Kvs& from);
-  void MergeFrom(const CmdResponse_Kvs& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdRequest_WriteBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_WriteBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_WriteBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_WriteBatch& from) {
+    CmdRequest_WriteBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // accessors -------------------------------------------------------
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_WriteBatch* other);
 
-  // repeated .floyd.CmdResponse.Kv kv = 1;
-  inline int kv_size() const;
-  inline void clear_kv();
-  static const int kKvFieldNumber = 1;
-  inline const ::floyd::CmdResponse_Kv& kv(int index) const;
-  inline ::floyd::CmdResponse_Kv* mutable_kv(int index);
-  inline ::floyd::CmdResponse_Kv* add_kv();
-  inline const ::google::protobuf::RepeatedPtrField< ::floyd::CmdResponse_Kv >&
-      kv() const;
-  inline ::google::protobuf::RepeatedPtrField< ::floyd::CmdResponse_Kv >*
-      mutable_kv();
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdRequest.WriteBatch";
+  }
+  protected:
+  explicit CmdRequest_WriteBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.Kvs)
- private:
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::RepeatedPtrField< ::floyd::CmdResponse_Kv > kv_;
+  // nested types ----------------------------------------------------
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+  // accessors -------------------------------------------------------
 
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
+  enum : int {
+    kOpsFieldNumber = 1,
+  };
+  // repeated .floyd.Entry.Operation ops = 1;
+  int ops_size() const;
+  private:
+  int _internal_ops_size() const;
+  public:
+  void clear_ops();
+  ::floyd::Entry_Operation* mutable_ops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >*
+      mutable_ops();
+  private:
+  const ::floyd::Entry_Operation& _internal_ops(int index) const;
+  ::floyd::Entry_Operation* _internal_add_ops();
+  public:
+  const ::floyd::Entry_Operation& ops(int index) const;
+  ::floyd::Entry_Operation* add_ops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >&
+      ops() const;
 
-  void InitAsDefaultInstance();
-  static CmdResponse_Kvs* default_instance_;
+  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.WriteBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation > ops_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_RequestVoteResponse : public ::google::protobuf::Message {
+class CmdRequest_InstallSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdRequest.InstallSnapshot) */ {
  public:
-  CmdResponse_RequestVoteResponse();
-  virtual ~CmdResponse_RequestVoteResponse();
+  inline CmdRequest_InstallSnapshot() : CmdRequest_InstallSnapshot(nullptr) {}
+  ~CmdRequest_InstallSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest_InstallSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_RequestVoteResponse(const CmdResponse_RequestVoteResponse& from);
+  CmdRequest_InstallSnapshot(const CmdRequest_InstallSnapshot& from);
+  CmdRequest_InstallSnapshot(CmdRequest_InstallSnapshot&& from) noexcept
+    : CmdRequest_InstallSnapshot() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_RequestVoteResponse& operator=(const CmdResponse_RequestVoteResponse& from) {
+  inline CmdRequest_InstallSnapshot& operator=(const CmdRequest_InstallSnapshot& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest_InstallSnapshot& operator=(CmdRequest_InstallSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_RequestVoteResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest_InstallSnapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest_InstallSnapshot* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest_InstallSnapshot*>(
+               &_CmdRequest_InstallSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
 
-  void Swap(CmdResponse_RequestVoteResponse* other);
+  friend void swap(CmdRequest_InstallSnapshot& a, CmdRequest_InstallSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest_InstallSnapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest_InstallSnapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_RequestVoteResponse* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_RequestVoteResponse& from);
-  void MergeFrom(const CmdResponse_RequestVoteResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest_InstallSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest_InstallSnapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest_InstallSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest_InstallSnapshot& from) {
+    CmdRequest_InstallSnapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest_InstallSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdRequest.InstallSnapshot";
+  }
+  protected:
+  explicit CmdRequest_InstallSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required uint64 term = 1;
-  inline bool has_term() const;
-  inline void clear_term();
-  static const int kTermFieldNumber = 1;
-  inline ::google::protobuf::uint64 term() const;
-  inline void set_term(::google::protobuf::uint64 value);
+  enum : int {
+    kIpFieldNumber = 2,
+    kFileNameFieldNumber = 9,
+    kDataFieldNumber = 10,
+    kTermFieldNumber = 1,
+    kLastIncludedIndexFieldNumber = 4,
+    kLastIncludedTermFieldNumber = 5,
+    kPortFieldNumber = 3,
+    kDoneFieldNumber = 7,
+    kOffsetFieldNumber = 6,
+  };
+  // required bytes ip = 2;
+  bool has_ip() const;
+  private:
+  bool _internal_has_ip() const;
+  public:
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
+  private:
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
+  public:
 
-  // required bool vote_granted = 2;
-  inline bool has_vote_granted() const;
-  inline void clear_vote_granted();
-  static const int kVoteGrantedFieldNumber = 2;
-  inline bool vote_granted() const;
-  inline void set_vote_granted(bool value);
+  // optional bytes file_name = 9;
+  bool has_file_name() const;
+  private:
+  bool _internal_has_file_name() const;
+  public:
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.RequestVoteResponse)
- private:
-  inline void set_has_term();
-  inline void clear_has_term();
-  inline void set_has_vote_granted();
-  inline void clear_has_vote_granted();
+  // optional bytes data = 10;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // required uint64 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // required uint64 last_included_index = 4;
+  bool has_last_included_index() const;
+  private:
+  bool _internal_has_last_included_index() const;
+  public:
+  void clear_last_included_index();
+  uint64_t last_included_index() const;
+  void set_last_included_index(uint64_t value);
+  private:
+  uint64_t _internal_last_included_index() const;
+  void _internal_set_last_included_index(uint64_t value);
+  public:
+
+  // required uint64 last_included_term = 5;
+  bool has_last_included_term() const;
+  private:
+  bool _internal_has_last_included_term() const;
+  public:
+  void clear_last_included_term();
+  uint64_t last_included_term() const;
+  void set_last_included_term(uint64_t value);
+  private:
+  uint64_t _internal_last_included_term() const;
+  void _internal_set_last_included_term(uint64_t value);
+  public:
 
-  ::google::protobuf::uint64 term_;
-  bool vote_granted_;
+  // required int32 port = 3;
+  bool has_port() const;
+  private:
+  bool _internal_has_port() const;
+  public:
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  // required bool done = 7;
+  bool has_done() const;
+  private:
+  bool _internal_has_done() const;
+  public:
+  void clear_done();
+  bool done() const;
+  void set_done(bool value);
+  private:
+  bool _internal_done() const;
+  void _internal_set_done(bool value);
+  public:
 
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
+  // required uint64 offset = 6;
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdResponse_RequestVoteResponse* default_instance_;
+  // @@protoc_insertion_point(class_scope:floyd.CmdRequest.InstallSnapshot)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t term_;
+    uint64_t last_included_index_;
+    uint64_t last_included_term_;
+    int32_t port_;
+    bool done_;
+    uint64_t offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_AppendEntriesResponse : public ::google::protobuf::Message {
+class CmdRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdRequest) */ {
  public:
-  CmdResponse_AppendEntriesResponse();
-  virtual ~CmdResponse_AppendEntriesResponse();
+  inline CmdRequest() : CmdRequest(nullptr) {}
+  ~CmdRequest() override;
+  explicit PROTOBUF_CONSTEXPR CmdRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_AppendEntriesResponse(const CmdResponse_AppendEntriesResponse& from);
+  CmdRequest(const CmdRequest& from);
+  CmdRequest(CmdRequest&& from) noexcept
+    : CmdRequest() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_AppendEntriesResponse& operator=(const CmdResponse_AppendEntriesResponse& from) {
+  inline CmdRequest& operator=(const CmdRequest& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdRequest& operator=(CmdRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_AppendEntriesResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdRequest* internal_default_instance() {
+    return reinterpret_cast<const CmdRequest*>(
+               &_CmdRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
 
-  void Swap(CmdResponse_AppendEntriesResponse* other);
+  friend void swap(CmdRequest& a, CmdRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_AppendEntriesResponse* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_AppendEntriesResponse& from);
-  void MergeFrom(const CmdResponse_AppendEntriesResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  CmdRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdRequest& from) {
+    CmdRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdRequest";
+  }
+  protected:
+  explicit CmdRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef CmdRequest_Kv Kv;
+  typedef CmdRequest_User User;
+  typedef CmdRequest_RequestVote RequestVote;
+  typedef CmdRequest_AppendEntries AppendEntries;
+  typedef CmdRequest_ServerStatus ServerStatus;
+  typedef CmdRequest_WriteBatch WriteBatch;
+  typedef CmdRequest_InstallSnapshot InstallSnapshot;
+
   // accessors -------------------------------------------------------
 
-  // required uint64 term = 1;
-  inline bool has_term() const;
-  inline void clear_term();
-  static const int kTermFieldNumber = 1;
-  inline ::google::protobuf::uint64 term() const;
-  inline void set_term(::google::protobuf::uint64 value);
+  enum : int {
+    kForwardCmdsFieldNumber = 10,
+    kCommandFieldNumber = 9,
+    kKvFieldNumber = 2,
+    kUserFieldNumber = 3,
+    kRequestVoteFieldNumber = 4,
+    kAppendEntriesFieldNumber = 5,
+    kServerStatusFieldNumber = 6,
+    kWriteBatchFieldNumber = 7,
+    kInstallSnapshotFieldNumber = 8,
+    kTypeFieldNumber = 1,
+  };
+  // repeated .floyd.CmdRequest forward_cmds = 10;
+  int forward_cmds_size() const;
+  private:
+  int _internal_forward_cmds_size() const;
+  public:
+  void clear_forward_cmds();
+  ::floyd::CmdRequest* mutable_forward_cmds(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdRequest >*
+      mutable_forward_cmds();
+  private:
+  const ::floyd::CmdRequest& _internal_forward_cmds(int index) const;
+  ::floyd::CmdRequest* _internal_add_forward_cmds();
+  public:
+  const ::floyd::CmdRequest& forward_cmds(int index) const;
+  ::floyd::CmdRequest* add_forward_cmds();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdRequest >&
+      forward_cmds() const;
 
-  // required bool success = 2;
-  inline bool has_success() const;
-  inline void clear_success();
-  static const int kSuccessFieldNumber = 2;
-  inline bool success() const;
-  inline void set_success(bool value);
+  // optional bytes command = 9;
+  bool has_command() const;
+  private:
+  bool _internal_has_command() const;
+  public:
+  void clear_command();
+  const std::string& command() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_command();
+  PROTOBUF_NODISCARD std::string* release_command();
+  void set_allocated_command(std::string* command);
+  private:
+  const std::string& _internal_command() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
+  std::string* _internal_mutable_command();
+  public:
 
-  // optional uint64 last_log_index = 3;
-  inline bool has_last_log_index() const;
-  inline void clear_last_log_index();
-  static const int kLastLogIndexFieldNumber = 3;
-  inline ::google::protobuf::uint64 last_log_index() const;
-  inline void set_last_log_index(::google::protobuf::uint64 value);
+  // optional .floyd.CmdRequest.Kv kv = 2;
+  bool has_kv() const;
+  private:
+  bool _internal_has_kv() const;
+  public:
+  void clear_kv();
+  const ::floyd::CmdRequest_Kv& kv() const;
+  PROTOBUF_NODISCARD ::floyd::CmdRequest_Kv* release_kv();
+  ::floyd::CmdRequest_Kv* mutable_kv();
+  void set_allocated_kv(::floyd::CmdRequest_Kv* kv);
+  private:
+  const ::floyd::CmdRequest_Kv& _internal_kv() const;
+  ::floyd::CmdRequest_Kv* _internal_mutable_kv();
+  public:
+  void unsafe_arena_set_allocated_kv(
+      ::floyd::CmdRequest_Kv* kv);
+  ::floyd::CmdRequest_Kv* unsafe_arena_release_kv();
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.AppendEntriesResponse)
- private:
-  inline void set_has_term();
-  inline void clear_has_term();
-  inline void set_has_success();
-  inline void clear_has_success();
-  inline void set_has_last_log_index();
-  inline void clear_has_last_log_index();
+  // optional .floyd.CmdRequest.User user = 3;
+  bool has_user() const;
+  private:
+  bool _internal_has_user() const;
+  public:
+  void clear_user();
+  const ::floyd::CmdRequest_User& user() const;
+  PROTOBUF_NODISCARD ::floyd::CmdRequest_User* release_user();
+  ::floyd::CmdRequest_User* mutable_user();
+  void set_allocated_user(::floyd::CmdRequest_User* user);
+  private:
+  const ::floyd::CmdRequest_User& _internal_user() const;
+  ::floyd::CmdRequest_User* _internal_mutable_user();
+  public:
+  void unsafe_arena_set_allocated_user(
+      ::floyd::CmdRequest_User* user);
+  ::floyd::CmdRequest_User* unsafe_arena_release_user();
+
+  // optional .floyd.CmdRequest.RequestVote request_vote = 4;
+  bool has_request_vote() const;
+  private:
+  bool _internal_has_request_vote() const;
+  public:
+  void clear_request_vote();
+  const ::floyd::CmdRequest_RequestVote& request_vote() const;
+  PROTOBUF_NODISCARD ::floyd::CmdRequest_RequestVote* release_request_vote();
+  ::floyd::CmdRequest_RequestVote* mutable_request_vote();
+  void set_allocated_request_vote(::floyd::CmdRequest_RequestVote* request_vote);
+  private:
+  const ::floyd::CmdRequest_RequestVote& _internal_request_vote() const;
+  ::floyd::CmdRequest_RequestVote* _internal_mutable_request_vote();
+  public:
+  void unsafe_arena_set_allocated_request_vote(
+      ::floyd::CmdRequest_RequestVote* request_vote);
+  ::floyd::CmdRequest_RequestVote* unsafe_arena_release_request_vote();
+
+  // optional .floyd.CmdRequest.AppendEntries append_entries = 5;
+  bool has_append_entries() const;
+  private:
+  bool _internal_has_append_entries() const;
+  public:
+  void clear_append_entries();
+  const ::floyd::CmdRequest_AppendEntries& append_entries() const;
+  PROTOBUF_NODISCARD ::floyd::CmdRequest_AppendEntries* release_append_entries();
+  ::floyd::CmdRequest_AppendEntries* mutable_append_entries();
+  void set_allocated_append_entries(::floyd::CmdRequest_AppendEntries* append_entries);
+  private:
+  const ::floyd::CmdRequest_AppendEntries& _internal_append_entries() const;
+  ::floyd::CmdRequest_AppendEntries* _internal_mutable_append_entries();
+  public:
+  void unsafe_arena_set_allocated_append_entries(
+      ::floyd::CmdRequest_AppendEntries* append_entries);
+  ::floyd::CmdRequest_AppendEntries* unsafe_arena_release_append_entries();
 
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  // optional .floyd.CmdRequest.ServerStatus server_status = 6;
+  bool has_server_status() const;
+  private:
+  bool _internal_has_server_status() const;
+  public:
+  void clear_server_status();
+  const ::floyd::CmdRequest_ServerStatus& server_status() const;
+  PROTOBUF_NODISCARD ::floyd::CmdRequest_ServerStatus* release_server_status();
+  ::floyd::CmdRequest_ServerStatus* mutable_server_status();
+  void set_allocated_server_status(::floyd::CmdRequest_ServerStatus* server_status);
+  private:
+  const ::floyd::CmdRequest_ServerStatus& _internal_server_status() const;
+  ::floyd::CmdRequest_ServerStatus* _internal_mutable_server_status();
+  public:
+  void unsafe_arena_set_allocated_server_status(
+      ::floyd::CmdRequest_ServerStatus* server_status);
+  ::floyd::CmdRequest_ServerStatus* unsafe_arena_release_server_status();
 
-  ::google::protobuf::uint64 term_;
-  ::google::protobuf::uint64 last_log_index_;
-  bool success_;
+  // optional .floyd.CmdRequest.WriteBatch write_batch = 7;
+  bool has_write_batch() const;
+  private:
+  bool _internal_has_write_batch() const;
+  public:
+  void clear_write_batch();
+  const ::floyd::CmdRequest_WriteBatch& write_batch() const;
+  PROTOBUF_NODISCARD ::floyd::CmdRequest_WriteBatch* release_write_batch();
+  ::floyd::CmdRequest_WriteBatch* mutable_write_batch();
+  void set_allocated_write_batch(::floyd::CmdRequest_WriteBatch* write_batch);
+  private:
+  const ::floyd::CmdRequest_WriteBatch& _internal_write_batch() const;
+  ::floyd::CmdRequest_WriteBatch* _internal_mutable_write_batch();
+  public:
+  void unsafe_arena_set_allocated_write_batch(
+      ::floyd::CmdRequest_WriteBatch* write_batch);
+  ::floyd::CmdRequest_WriteBatch* unsafe_arena_release_write_batch();
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
+  // optional .floyd.CmdRequest.InstallSnapshot install_snapshot = 8;
+  bool has_install_snapshot() const;
+  private:
+  bool _internal_has_install_snapshot() const;
+  public:
+  void clear_install_snapshot();
+  const ::floyd::CmdRequest_InstallSnapshot& install_snapshot() const;
+  PROTOBUF_NODISCARD ::floyd::CmdRequest_InstallSnapshot* release_install_snapshot();
+  ::floyd::CmdRequest_InstallSnapshot* mutable_install_snapshot();
+  void set_allocated_install_snapshot(::floyd::CmdRequest_InstallSnapshot* install_snapshot);
+  private:
+  const ::floyd::CmdRequest_InstallSnapshot& _internal_install_snapshot() const;
+  ::floyd::CmdRequest_InstallSnapshot* _internal_mutable_install_snapshot();
+  public:
+  void unsafe_arena_set_allocated_install_snapshot(
+      ::floyd::CmdRequest_InstallSnapshot* install_snapshot);
+  ::floyd::CmdRequest_InstallSnapshot* unsafe_arena_release_install_snapshot();
 
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
+  // required .floyd.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::floyd::Type type() const;
+  void set_type(::floyd::Type value);
+  private:
+  ::floyd::Type _internal_type() const;
+  void _internal_set_type(::floyd::Type value);
+  public:
 
-  void InitAsDefaultInstance();
-  static CmdResponse_AppendEntriesResponse* default_instance_;
+  // @@protoc_insertion_point(class_scope:floyd.CmdRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdRequest > forward_cmds_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    ::floyd::CmdRequest_Kv* kv_;
+    ::floyd::CmdRequest_User* user_;
+    ::floyd::CmdRequest_RequestVote* request_vote_;
+    ::floyd::CmdRequest_AppendEntries* append_entries_;
+    ::floyd::CmdRequest_ServerStatus* server_status_;
+    ::floyd::CmdRequest_WriteBatch* write_batch_;
+    ::floyd::CmdRequest_InstallSnapshot* install_snapshot_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse_ServerStatus : public ::google::protobuf::Message {
+class CmdResponse_Kv final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdResponse.Kv) */ {
  public:
-  CmdResponse_ServerStatus();
-  virtual ~CmdResponse_ServerStatus();
+  inline CmdResponse_Kv() : CmdResponse_Kv(nullptr) {}
+  ~CmdResponse_Kv() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_Kv(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CmdResponse_ServerStatus(const CmdResponse_ServerStatus& from);
+  CmdResponse_Kv(const CmdResponse_Kv& from);
+  CmdResponse_Kv(CmdResponse_Kv&& from) noexcept
+    : CmdResponse_Kv() {
+    *this = ::std::move(from);
+  }
 
-  inline CmdResponse_ServerStatus& operator=(const CmdResponse_ServerStatus& from) {
+  inline CmdResponse_Kv& operator=(const CmdResponse_Kv& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdResponse_Kv& operator=(CmdResponse_Kv&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse_ServerStatus& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_Kv& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_Kv* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_Kv*>(
+               &_CmdResponse_Kv_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
 
-  void Swap(CmdResponse_ServerStatus* other);
+  friend void swap(CmdResponse_Kv& a, CmdResponse_Kv& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_Kv* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_Kv* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse_ServerStatus* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const CmdResponse_ServerStatus& from);
-  void MergeFrom(const CmdResponse_ServerStatus& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  CmdResponse_Kv* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_Kv>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_Kv& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_Kv& from) {
+    CmdResponse_Kv::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // required uint64 term = 1;
-  inline bool has_term() const;
-  inline void clear_term();
-  static const int kTermFieldNumber = 1;
-  inline ::google::protobuf::uint64 term() const;
-  inline void set_term(::google::protobuf::uint64 value);
-
-  // required uint64 commit_index = 2;
-  inline bool has_commit_index() const;
-  inline void clear_commit_index();
-  static const int kCommitIndexFieldNumber = 2;
-  inline ::google::protobuf::uint64 commit_index() const;
-  inline void set_commit_index(::google::protobuf::uint64 value);
-
-  // required bytes role = 3;
-  inline bool has_role() const;
-  inline void clear_role();
-  static const int kRoleFieldNumber = 3;
-  inline const ::std::string& role() const;
-  inline void set_role(const ::std::string& value);
-  inline void set_role(const char* value);
-  inline void set_role(const void* value, size_t size);
-  inline ::std::string* mutable_role();
-  inline ::std::string* release_role();
-  inline void set_allocated_role(::std::string* role);
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  // optional bytes leader_ip = 4;
-  inline bool has_leader_ip() const;
-  inline void clear_leader_ip();
-  static const int kLeaderIpFieldNumber = 4;
-  inline const ::std::string& leader_ip() const;
-  inline void set_leader_ip(const ::std::string& value);
-  inline void set_leader_ip(const char* value);
-  inline void set_leader_ip(const void* value, size_t size);
-  inline ::std::string* mutable_leader_ip();
-  inline ::std::string* release_leader_ip();
-  inline void set_allocated_leader_ip(::std::string* leader_ip);
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_Kv* other);
 
-  // optional int32 leader_port = 5;
-  inline bool has_leader_port() const;
-  inline void clear_leader_port();
-  static const int kLeaderPortFieldNumber = 5;
-  inline ::google::protobuf::int32 leader_port() const;
-  inline void set_leader_port(::google::protobuf::int32 value);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdResponse.Kv";
+  }
+  protected:
+  explicit CmdResponse_Kv(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-  // optional bytes voted_for_ip = 6;
-  inline bool has_voted_for_ip() const;
-  inline void clear_voted_for_ip();
-  static const int kVotedForIpFieldNumber = 6;
-  inline const ::std::string& voted_for_ip() const;
-  inline void set_voted_for_ip(const ::std::string& value);
-  inline void set_voted_for_ip(const char* value);
-  inline void set_voted_for_ip(const void* value, size_t size);
-  inline ::std::string* mutable_voted_for_ip();
-  inline ::std::string* release_voted_for_ip();
-  inline void set_allocated_voted_for_ip(::std::string* voted_for_ip);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // optional int32 voted_for_port = 7;
-  inline bool has_voted_for_port() const;
-  inline void clear_voted_for_port();
-  static const int kVotedForPortFieldNumber = 7;
-  inline ::google::protobuf::int32 voted_for_port() const;
-  inline void set_voted_for_port(::google::protobuf::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  // optional uint64 last_log_term = 8;
-  inline bool has_last_log_term() const;
-  inline void clear_last_log_term();
-  static const int kLastLogTermFieldNumber = 8;
-  inline ::google::protobuf::uint64 last_log_term() const;
-  inline void set_last_log_term(::google::protobuf::uint64 value);
+  // nested types ----------------------------------------------------
 
-  // optional uint64 last_log_index = 9;
-  inline bool has_last_log_index() const;
-  inline void clear_last_log_index();
-  static const int kLastLogIndexFieldNumber = 9;
-  inline ::google::protobuf::uint64 last_log_index() const;
-  inline void set_last_log_index(::google::protobuf::uint64 value);
+  // accessors -------------------------------------------------------
 
-  // optional uint64 last_applied = 10;
-  inline bool has_last_applied() const;
-  inline void clear_last_applied();
-  static const int kLastAppliedFieldNumber = 10;
-  inline ::google::protobuf::uint64 last_applied() const;
-  inline void set_last_applied(::google::protobuf::uint64 value);
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // optional bytes value = 1;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
 
-  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.ServerStatus)
+  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.Kv)
  private:
-  inline void set_has_term();
-  inline void clear_has_term();
-  inline void set_has_commit_index();
-  inline void clear_has_commit_index();
-  inline void set_has_role();
-  inline void clear_has_role();
-  inline void set_has_leader_ip();
-  inline void clear_has_leader_ip();
-  inline void set_has_leader_port();
-  inline void clear_has_leader_port();
-  inline void set_has_voted_for_ip();
-  inline void clear_has_voted_for_ip();
-  inline void set_has_voted_for_port();
-  inline void clear_has_voted_for_port();
-  inline void set_has_last_log_term();
-  inline void clear_has_last_log_term();
-  inline void set_has_last_log_index();
-  inline void clear_has_last_log_index();
-  inline void set_has_last_applied();
-  inline void clear_has_last_applied();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint64 term_;
-  ::google::protobuf::uint64 commit_index_;
-  ::std::string* role_;
-  ::std::string* leader_ip_;
-  ::std::string* voted_for_ip_;
-  ::google::protobuf::int32 leader_port_;
-  ::google::protobuf::int32 voted_for_port_;
-  ::google::protobuf::uint64 last_log_term_;
-  ::google::protobuf::uint64 last_log_index_;
-  ::google::protobuf::uint64 last_applied_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(10 + 31) / 32];
-
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
-
-  void InitAsDefaultInstance();
-  static CmdResponse_ServerStatus* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CmdResponse : public ::google::protobuf::Message {
+class CmdResponse_Kvs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdResponse.Kvs) */ {
  public:
-  CmdResponse();
-  virtual ~CmdResponse();
-
-  CmdResponse(const CmdResponse& from);
+  inline CmdResponse_Kvs() : CmdResponse_Kvs(nullptr) {}
+  ~CmdResponse_Kvs() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_Kvs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_Kvs(const CmdResponse_Kvs& from);
+  CmdResponse_Kvs(CmdResponse_Kvs&& from) noexcept
+    : CmdResponse_Kvs() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_Kvs& operator=(const CmdResponse_Kvs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_Kvs& operator=(CmdResponse_Kvs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_Kvs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_Kvs* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_Kvs*>(
+               &_CmdResponse_Kvs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(CmdResponse_Kvs& a, CmdResponse_Kvs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_Kvs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_Kvs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_Kvs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_Kvs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_Kvs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_Kvs& from) {
+    CmdResponse_Kvs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_Kvs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdResponse.Kvs";
+  }
+  protected:
+  explicit CmdResponse_Kvs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKvFieldNumber = 1,
+  };
+  // repeated .floyd.CmdResponse.Kv kv = 1;
+  int kv_size() const;
+  private:
+  int _internal_kv_size() const;
+  public:
+  void clear_kv();
+  ::floyd::CmdResponse_Kv* mutable_kv(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse_Kv >*
+      mutable_kv();
+  private:
+  const ::floyd::CmdResponse_Kv& _internal_kv(int index) const;
+  ::floyd::CmdResponse_Kv* _internal_add_kv();
+  public:
+  const ::floyd::CmdResponse_Kv& kv(int index) const;
+  ::floyd::CmdResponse_Kv* add_kv();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse_Kv >&
+      kv() const;
+
+  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.Kvs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse_Kv > kv_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_RequestVoteResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdResponse.RequestVoteResponse) */ {
+ public:
+  inline CmdResponse_RequestVoteResponse() : CmdResponse_RequestVoteResponse(nullptr) {}
+  ~CmdResponse_RequestVoteResponse() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_RequestVoteResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_RequestVoteResponse(const CmdResponse_RequestVoteResponse& from);
+  CmdResponse_RequestVoteResponse(CmdResponse_RequestVoteResponse&& from) noexcept
+    : CmdResponse_RequestVoteResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_RequestVoteResponse& operator=(const CmdResponse_RequestVoteResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_RequestVoteResponse& operator=(CmdResponse_RequestVoteResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_RequestVoteResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_RequestVoteResponse* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_RequestVoteResponse*>(
+               &_CmdResponse_RequestVoteResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(CmdResponse_RequestVoteResponse& a, CmdResponse_RequestVoteResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_RequestVoteResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_RequestVoteResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_RequestVoteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_RequestVoteResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_RequestVoteResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_RequestVoteResponse& from) {
+    CmdResponse_RequestVoteResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_RequestVoteResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdResponse.RequestVoteResponse";
+  }
+  protected:
+  explicit CmdResponse_RequestVoteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kVoteGrantedFieldNumber = 2,
+  };
+  // required uint64 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
+
+  // required bool vote_granted = 2;
+  bool has_vote_granted() const;
+  private:
+  bool _internal_has_vote_granted() const;
+  public:
+  void clear_vote_granted();
+  bool vote_granted() const;
+  void set_vote_granted(bool value);
+  private:
+  bool _internal_vote_granted() const;
+  void _internal_set_vote_granted(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.RequestVoteResponse)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t term_;
+    bool vote_granted_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_AppendEntriesResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdResponse.AppendEntriesResponse) */ {
+ public:
+  inline CmdResponse_AppendEntriesResponse() : CmdResponse_AppendEntriesResponse(nullptr) {}
+  ~CmdResponse_AppendEntriesResponse() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_AppendEntriesResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_AppendEntriesResponse(const CmdResponse_AppendEntriesResponse& from);
+  CmdResponse_AppendEntriesResponse(CmdResponse_AppendEntriesResponse&& from) noexcept
+    : CmdResponse_AppendEntriesResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_AppendEntriesResponse& operator=(const CmdResponse_AppendEntriesResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_AppendEntriesResponse& operator=(CmdResponse_AppendEntriesResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_AppendEntriesResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_AppendEntriesResponse* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_AppendEntriesResponse*>(
+               &_CmdResponse_AppendEntriesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(CmdResponse_AppendEntriesResponse& a, CmdResponse_AppendEntriesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_AppendEntriesResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_AppendEntriesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_AppendEntriesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_AppendEntriesResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_AppendEntriesResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_AppendEntriesResponse& from) {
+    CmdResponse_AppendEntriesResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_AppendEntriesResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdResponse.AppendEntriesResponse";
+  }
+  protected:
+  explicit CmdResponse_AppendEntriesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kLastLogIndexFieldNumber = 3,
+    kSuccessFieldNumber = 2,
+  };
+  // required uint64 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
+
+  // optional uint64 last_log_index = 3;
+  bool has_last_log_index() const;
+  private:
+  bool _internal_has_last_log_index() const;
+  public:
+  void clear_last_log_index();
+  uint64_t last_log_index() const;
+  void set_last_log_index(uint64_t value);
+  private:
+  uint64_t _internal_last_log_index() const;
+  void _internal_set_last_log_index(uint64_t value);
+  public:
+
+  // required bool success = 2;
+  bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.AppendEntriesResponse)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t term_;
+    uint64_t last_log_index_;
+    bool success_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_ServerStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdResponse.ServerStatus) */ {
+ public:
+  inline CmdResponse_ServerStatus() : CmdResponse_ServerStatus(nullptr) {}
+  ~CmdResponse_ServerStatus() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_ServerStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_ServerStatus(const CmdResponse_ServerStatus& from);
+  CmdResponse_ServerStatus(CmdResponse_ServerStatus&& from) noexcept
+    : CmdResponse_ServerStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_ServerStatus& operator=(const CmdResponse_ServerStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_ServerStatus& operator=(CmdResponse_ServerStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_ServerStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_ServerStatus* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_ServerStatus*>(
+               &_CmdResponse_ServerStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(CmdResponse_ServerStatus& a, CmdResponse_ServerStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_ServerStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_ServerStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_ServerStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_ServerStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_ServerStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_ServerStatus& from) {
+    CmdResponse_ServerStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_ServerStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdResponse.ServerStatus";
+  }
+  protected:
+  explicit CmdResponse_ServerStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoleFieldNumber = 3,
+    kLeaderIpFieldNumber = 4,
+    kVotedForIpFieldNumber = 6,
+    kTermFieldNumber = 1,
+    kCommitIndexFieldNumber = 2,
+    kLeaderPortFieldNumber = 5,
+    kVotedForPortFieldNumber = 7,
+    kLastLogTermFieldNumber = 8,
+    kLastLogIndexFieldNumber = 9,
+    kLastAppliedFieldNumber = 10,
+  };
+  // required bytes role = 3;
+  bool has_role() const;
+  private:
+  bool _internal_has_role() const;
+  public:
+  void clear_role();
+  const std::string& role() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_role(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_role();
+  PROTOBUF_NODISCARD std::string* release_role();
+  void set_allocated_role(std::string* role);
+  private:
+  const std::string& _internal_role() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_role(const std::string& value);
+  std::string* _internal_mutable_role();
+  public:
+
+  // optional bytes leader_ip = 4;
+  bool has_leader_ip() const;
+  private:
+  bool _internal_has_leader_ip() const;
+  public:
+  void clear_leader_ip();
+  const std::string& leader_ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leader_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leader_ip();
+  PROTOBUF_NODISCARD std::string* release_leader_ip();
+  void set_allocated_leader_ip(std::string* leader_ip);
+  private:
+  const std::string& _internal_leader_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leader_ip(const std::string& value);
+  std::string* _internal_mutable_leader_ip();
+  public:
+
+  // optional bytes voted_for_ip = 6;
+  bool has_voted_for_ip() const;
+  private:
+  bool _internal_has_voted_for_ip() const;
+  public:
+  void clear_voted_for_ip();
+  const std::string& voted_for_ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_voted_for_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_voted_for_ip();
+  PROTOBUF_NODISCARD std::string* release_voted_for_ip();
+  void set_allocated_voted_for_ip(std::string* voted_for_ip);
+  private:
+  const std::string& _internal_voted_for_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_voted_for_ip(const std::string& value);
+  std::string* _internal_mutable_voted_for_ip();
+  public:
+
+  // required uint64 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
+
+  // required uint64 commit_index = 2;
+  bool has_commit_index() const;
+  private:
+  bool _internal_has_commit_index() const;
+  public:
+  void clear_commit_index();
+  uint64_t commit_index() const;
+  void set_commit_index(uint64_t value);
+  private:
+  uint64_t _internal_commit_index() const;
+  void _internal_set_commit_index(uint64_t value);
+  public:
+
+  // optional int32 leader_port = 5;
+  bool has_leader_port() const;
+  private:
+  bool _internal_has_leader_port() const;
+  public:
+  void clear_leader_port();
+  int32_t leader_port() const;
+  void set_leader_port(int32_t value);
+  private:
+  int32_t _internal_leader_port() const;
+  void _internal_set_leader_port(int32_t value);
+  public:
+
+  // optional int32 voted_for_port = 7;
+  bool has_voted_for_port() const;
+  private:
+  bool _internal_has_voted_for_port() const;
+  public:
+  void clear_voted_for_port();
+  int32_t voted_for_port() const;
+  void set_voted_for_port(int32_t value);
+  private:
+  int32_t _internal_voted_for_port() const;
+  void _internal_set_voted_for_port(int32_t value);
+  public:
+
+  // optional uint64 last_log_term = 8;
+  bool has_last_log_term() const;
+  private:
+  bool _internal_has_last_log_term() const;
+  public:
+  void clear_last_log_term();
+  uint64_t last_log_term() const;
+  void set_last_log_term(uint64_t value);
+  private:
+  uint64_t _internal_last_log_term() const;
+  void _internal_set_last_log_term(uint64_t value);
+  public:
+
+  // optional uint64 last_log_index = 9;
+  bool has_last_log_index() const;
+  private:
+  bool _internal_has_last_log_index() const;
+  public:
+  void clear_last_log_index();
+  uint64_t last_log_index() const;
+  void set_last_log_index(uint64_t value);
+  private:
+  uint64_t _internal_last_log_index() const;
+  void _internal_set_last_log_index(uint64_t value);
+  public:
+
+  // optional uint64 last_applied = 10;
+  bool has_last_applied() const;
+  private:
+  bool _internal_has_last_applied() const;
+  public:
+  void clear_last_applied();
+  uint64_t last_applied() const;
+  void set_last_applied(uint64_t value);
+  private:
+  uint64_t _internal_last_applied() const;
+  void _internal_set_last_applied(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.ServerStatus)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr role_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leader_ip_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr voted_for_ip_;
+    uint64_t term_;
+    uint64_t commit_index_;
+    int32_t leader_port_;
+    int32_t voted_for_port_;
+    uint64_t last_log_term_;
+    uint64_t last_log_index_;
+    uint64_t last_applied_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_ReadIndexResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdResponse.ReadIndexResponse) */ {
+ public:
+  inline CmdResponse_ReadIndexResponse() : CmdResponse_ReadIndexResponse(nullptr) {}
+  ~CmdResponse_ReadIndexResponse() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_ReadIndexResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_ReadIndexResponse(const CmdResponse_ReadIndexResponse& from);
+  CmdResponse_ReadIndexResponse(CmdResponse_ReadIndexResponse&& from) noexcept
+    : CmdResponse_ReadIndexResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_ReadIndexResponse& operator=(const CmdResponse_ReadIndexResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_ReadIndexResponse& operator=(CmdResponse_ReadIndexResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_ReadIndexResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_ReadIndexResponse* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_ReadIndexResponse*>(
+               &_CmdResponse_ReadIndexResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(CmdResponse_ReadIndexResponse& a, CmdResponse_ReadIndexResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_ReadIndexResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_ReadIndexResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_ReadIndexResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_ReadIndexResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_ReadIndexResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_ReadIndexResponse& from) {
+    CmdResponse_ReadIndexResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_ReadIndexResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdResponse.ReadIndexResponse";
+  }
+  protected:
+  explicit CmdResponse_ReadIndexResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReadIndexFieldNumber = 1,
+  };
+  // required uint64 read_index = 1;
+  bool has_read_index() const;
+  private:
+  bool _internal_has_read_index() const;
+  public:
+  void clear_read_index();
+  uint64_t read_index() const;
+  void set_read_index(uint64_t value);
+  private:
+  uint64_t _internal_read_index() const;
+  void _internal_set_read_index(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.ReadIndexResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t read_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse_InstallSnapshotResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdResponse.InstallSnapshotResponse) */ {
+ public:
+  inline CmdResponse_InstallSnapshotResponse() : CmdResponse_InstallSnapshotResponse(nullptr) {}
+  ~CmdResponse_InstallSnapshotResponse() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse_InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse_InstallSnapshotResponse(const CmdResponse_InstallSnapshotResponse& from);
+  CmdResponse_InstallSnapshotResponse(CmdResponse_InstallSnapshotResponse&& from) noexcept
+    : CmdResponse_InstallSnapshotResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline CmdResponse_InstallSnapshotResponse& operator=(const CmdResponse_InstallSnapshotResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CmdResponse_InstallSnapshotResponse& operator=(CmdResponse_InstallSnapshotResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse_InstallSnapshotResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse_InstallSnapshotResponse* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse_InstallSnapshotResponse*>(
+               &_CmdResponse_InstallSnapshotResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(CmdResponse_InstallSnapshotResponse& a, CmdResponse_InstallSnapshotResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse_InstallSnapshotResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse_InstallSnapshotResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CmdResponse_InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse_InstallSnapshotResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CmdResponse_InstallSnapshotResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse_InstallSnapshotResponse& from) {
+    CmdResponse_InstallSnapshotResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse_InstallSnapshotResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdResponse.InstallSnapshotResponse";
+  }
+  protected:
+  explicit CmdResponse_InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+  };
+  // required uint64 term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  uint64_t term() const;
+  void set_term(uint64_t value);
+  private:
+  uint64_t _internal_term() const;
+  void _internal_set_term(uint64_t value);
+  public:
+
+  // required bool success = 2;
+  bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:floyd.CmdResponse.InstallSnapshotResponse)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t term_;
+    bool success_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CmdResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:floyd.CmdResponse) */ {
+ public:
+  inline CmdResponse() : CmdResponse(nullptr) {}
+  ~CmdResponse() override;
+  explicit PROTOBUF_CONSTEXPR CmdResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CmdResponse(const CmdResponse& from);
+  CmdResponse(CmdResponse&& from) noexcept
+    : CmdResponse() {
+    *this = ::std::move(from);
+  }
 
   inline CmdResponse& operator=(const CmdResponse& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CmdResponse& operator=(CmdResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CmdResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CmdResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CmdResponse* internal_default_instance() {
+    return reinterpret_cast<const CmdResponse*>(
+               &_CmdResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
 
-  void Swap(CmdResponse* other);
+  friend void swap(CmdResponse& a, CmdResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CmdResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CmdResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  CmdResponse* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  CmdResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CmdResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CmdResponse& from);
-  void MergeFrom(const CmdResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CmdResponse& from) {
+    CmdResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CmdResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "floyd.CmdResponse";
+  }
+  protected:
+  explicit CmdResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1612,1061 +4461,2203 @@ class CmdResponse : public ::google::protobuf::Message {
   typedef CmdResponse_RequestVoteResponse RequestVoteResponse;
   typedef CmdResponse_AppendEntriesResponse AppendEntriesResponse;
   typedef CmdResponse_ServerStatus ServerStatus;
+  typedef CmdResponse_ReadIndexResponse ReadIndexResponse;
+  typedef CmdResponse_InstallSnapshotResponse InstallSnapshotResponse;
 
   // accessors -------------------------------------------------------
 
-  // required .floyd.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::floyd::Type type() const;
-  inline void set_type(::floyd::Type value);
-
-  // optional .floyd.StatusCode code = 2;
-  inline bool has_code() const;
-  inline void clear_code();
-  static const int kCodeFieldNumber = 2;
-  inline ::floyd::StatusCode code() const;
-  inline void set_code(::floyd::StatusCode value);
+  enum : int {
+    kForwardResFieldNumber = 11,
+    kMsgFieldNumber = 3,
+    kKvFieldNumber = 4,
+    kKvsFieldNumber = 5,
+    kRequestVoteResFieldNumber = 6,
+    kAppendEntriesResFieldNumber = 7,
+    kServerStatusFieldNumber = 8,
+    kReadIndexResFieldNumber = 9,
+    kInstallSnapshotResFieldNumber = 10,
+    kTypeFieldNumber = 1,
+    kCodeFieldNumber = 2,
+  };
+  // repeated .floyd.CmdResponse forward_res = 11;
+  int forward_res_size() const;
+  private:
+  int _internal_forward_res_size() const;
+  public:
+  void clear_forward_res();
+  ::floyd::CmdResponse* mutable_forward_res(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse >*
+      mutable_forward_res();
+  private:
+  const ::floyd::CmdResponse& _internal_forward_res(int index) const;
+  ::floyd::CmdResponse* _internal_add_forward_res();
+  public:
+  const ::floyd::CmdResponse& forward_res(int index) const;
+  ::floyd::CmdResponse* add_forward_res();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse >&
+      forward_res() const;
 
   // optional bytes msg = 3;
-  inline bool has_msg() const;
-  inline void clear_msg();
-  static const int kMsgFieldNumber = 3;
-  inline const ::std::string& msg() const;
-  inline void set_msg(const ::std::string& value);
-  inline void set_msg(const char* value);
-  inline void set_msg(const void* value, size_t size);
-  inline ::std::string* mutable_msg();
-  inline ::std::string* release_msg();
-  inline void set_allocated_msg(::std::string* msg);
+  bool has_msg() const;
+  private:
+  bool _internal_has_msg() const;
+  public:
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
 
   // optional .floyd.CmdResponse.Kv kv = 4;
-  inline bool has_kv() const;
-  inline void clear_kv();
-  static const int kKvFieldNumber = 4;
-  inline const ::floyd::CmdResponse_Kv& kv() const;
-  inline ::floyd::CmdResponse_Kv* mutable_kv();
-  inline ::floyd::CmdResponse_Kv* release_kv();
-  inline void set_allocated_kv(::floyd::CmdResponse_Kv* kv);
+  bool has_kv() const;
+  private:
+  bool _internal_has_kv() const;
+  public:
+  void clear_kv();
+  const ::floyd::CmdResponse_Kv& kv() const;
+  PROTOBUF_NODISCARD ::floyd::CmdResponse_Kv* release_kv();
+  ::floyd::CmdResponse_Kv* mutable_kv();
+  void set_allocated_kv(::floyd::CmdResponse_Kv* kv);
+  private:
+  const ::floyd::CmdResponse_Kv& _internal_kv() const;
+  ::floyd::CmdResponse_Kv* _internal_mutable_kv();
+  public:
+  void unsafe_arena_set_allocated_kv(
+      ::floyd::CmdResponse_Kv* kv);
+  ::floyd::CmdResponse_Kv* unsafe_arena_release_kv();
 
   // optional .floyd.CmdResponse.Kvs kvs = 5;
-  inline bool has_kvs() const;
-  inline void clear_kvs();
-  static const int kKvsFieldNumber = 5;
-  inline const ::floyd::CmdResponse_Kvs& kvs() const;
-  inline ::floyd::CmdResponse_Kvs* mutable_kvs();
-  inline ::floyd::CmdResponse_Kvs* release_kvs();
-  inline void set_allocated_kvs(::floyd::CmdResponse_Kvs* kvs);
+  bool has_kvs() const;
+  private:
+  bool _internal_has_kvs() const;
+  public:
+  void clear_kvs();
+  const ::floyd::CmdResponse_Kvs& kvs() const;
+  PROTOBUF_NODISCARD ::floyd::CmdResponse_Kvs* release_kvs();
+  ::floyd::CmdResponse_Kvs* mutable_kvs();
+  void set_allocated_kvs(::floyd::CmdResponse_Kvs* kvs);
+  private:
+  const ::floyd::CmdResponse_Kvs& _internal_kvs() const;
+  ::floyd::CmdResponse_Kvs* _internal_mutable_kvs();
+  public:
+  void unsafe_arena_set_allocated_kvs(
+      ::floyd::CmdResponse_Kvs* kvs);
+  ::floyd::CmdResponse_Kvs* unsafe_arena_release_kvs();
 
   // optional .floyd.CmdResponse.RequestVoteResponse request_vote_res = 6;
-  inline bool has_request_vote_res() const;
-  inline void clear_request_vote_res();
-  static const int kRequestVoteResFieldNumber = 6;
-  inline const ::floyd::CmdResponse_RequestVoteResponse& request_vote_res() const;
-  inline ::floyd::CmdResponse_RequestVoteResponse* mutable_request_vote_res();
-  inline ::floyd::CmdResponse_RequestVoteResponse* release_request_vote_res();
-  inline void set_allocated_request_vote_res(::floyd::CmdResponse_RequestVoteResponse* request_vote_res);
+  bool has_request_vote_res() const;
+  private:
+  bool _internal_has_request_vote_res() const;
+  public:
+  void clear_request_vote_res();
+  const ::floyd::CmdResponse_RequestVoteResponse& request_vote_res() const;
+  PROTOBUF_NODISCARD ::floyd::CmdResponse_RequestVoteResponse* release_request_vote_res();
+  ::floyd::CmdResponse_RequestVoteResponse* mutable_request_vote_res();
+  void set_allocated_request_vote_res(::floyd::CmdResponse_RequestVoteResponse* request_vote_res);
+  private:
+  const ::floyd::CmdResponse_RequestVoteResponse& _internal_request_vote_res() const;
+  ::floyd::CmdResponse_RequestVoteResponse* _internal_mutable_request_vote_res();
+  public:
+  void unsafe_arena_set_allocated_request_vote_res(
+      ::floyd::CmdResponse_RequestVoteResponse* request_vote_res);
+  ::floyd::CmdResponse_RequestVoteResponse* unsafe_arena_release_request_vote_res();
 
   // optional .floyd.CmdResponse.AppendEntriesResponse append_entries_res = 7;
-  inline bool has_append_entries_res() const;
-  inline void clear_append_entries_res();
-  static const int kAppendEntriesResFieldNumber = 7;
-  inline const ::floyd::CmdResponse_AppendEntriesResponse& append_entries_res() const;
-  inline ::floyd::CmdResponse_AppendEntriesResponse* mutable_append_entries_res();
-  inline ::floyd::CmdResponse_AppendEntriesResponse* release_append_entries_res();
-  inline void set_allocated_append_entries_res(::floyd::CmdResponse_AppendEntriesResponse* append_entries_res);
+  bool has_append_entries_res() const;
+  private:
+  bool _internal_has_append_entries_res() const;
+  public:
+  void clear_append_entries_res();
+  const ::floyd::CmdResponse_AppendEntriesResponse& append_entries_res() const;
+  PROTOBUF_NODISCARD ::floyd::CmdResponse_AppendEntriesResponse* release_append_entries_res();
+  ::floyd::CmdResponse_AppendEntriesResponse* mutable_append_entries_res();
+  void set_allocated_append_entries_res(::floyd::CmdResponse_AppendEntriesResponse* append_entries_res);
+  private:
+  const ::floyd::CmdResponse_AppendEntriesResponse& _internal_append_entries_res() const;
+  ::floyd::CmdResponse_AppendEntriesResponse* _internal_mutable_append_entries_res();
+  public:
+  void unsafe_arena_set_allocated_append_entries_res(
+      ::floyd::CmdResponse_AppendEntriesResponse* append_entries_res);
+  ::floyd::CmdResponse_AppendEntriesResponse* unsafe_arena_release_append_entries_res();
 
   // optional .floyd.CmdResponse.ServerStatus server_status = 8;
-  inline bool has_server_status() const;
-  inline void clear_server_status();
-  static const int kServerStatusFieldNumber = 8;
-  inline const ::floyd::CmdResponse_ServerStatus& server_status() const;
-  inline ::floyd::CmdResponse_ServerStatus* mutable_server_status();
-  inline ::floyd::CmdResponse_ServerStatus* release_server_status();
-  inline void set_allocated_server_status(::floyd::CmdResponse_ServerStatus* server_status);
+  bool has_server_status() const;
+  private:
+  bool _internal_has_server_status() const;
+  public:
+  void clear_server_status();
+  const ::floyd::CmdResponse_ServerStatus& server_status() const;
+  PROTOBUF_NODISCARD ::floyd::CmdResponse_ServerStatus* release_server_status();
+  ::floyd::CmdResponse_ServerStatus* mutable_server_status();
+  void set_allocated_server_status(::floyd::CmdResponse_ServerStatus* server_status);
+  private:
+  const ::floyd::CmdResponse_ServerStatus& _internal_server_status() const;
+  ::floyd::CmdResponse_ServerStatus* _internal_mutable_server_status();
+  public:
+  void unsafe_arena_set_allocated_server_status(
+      ::floyd::CmdResponse_ServerStatus* server_status);
+  ::floyd::CmdResponse_ServerStatus* unsafe_arena_release_server_status();
+
+  // optional .floyd.CmdResponse.ReadIndexResponse read_index_res = 9;
+  bool has_read_index_res() const;
+  private:
+  bool _internal_has_read_index_res() const;
+  public:
+  void clear_read_index_res();
+  const ::floyd::CmdResponse_ReadIndexResponse& read_index_res() const;
+  PROTOBUF_NODISCARD ::floyd::CmdResponse_ReadIndexResponse* release_read_index_res();
+  ::floyd::CmdResponse_ReadIndexResponse* mutable_read_index_res();
+  void set_allocated_read_index_res(::floyd::CmdResponse_ReadIndexResponse* read_index_res);
+  private:
+  const ::floyd::CmdResponse_ReadIndexResponse& _internal_read_index_res() const;
+  ::floyd::CmdResponse_ReadIndexResponse* _internal_mutable_read_index_res();
+  public:
+  void unsafe_arena_set_allocated_read_index_res(
+      ::floyd::CmdResponse_ReadIndexResponse* read_index_res);
+  ::floyd::CmdResponse_ReadIndexResponse* unsafe_arena_release_read_index_res();
+
+  // optional .floyd.CmdResponse.InstallSnapshotResponse install_snapshot_res = 10;
+  bool has_install_snapshot_res() const;
+  private:
+  bool _internal_has_install_snapshot_res() const;
+  public:
+  void clear_install_snapshot_res();
+  const ::floyd::CmdResponse_InstallSnapshotResponse& install_snapshot_res() const;
+  PROTOBUF_NODISCARD ::floyd::CmdResponse_InstallSnapshotResponse* release_install_snapshot_res();
+  ::floyd::CmdResponse_InstallSnapshotResponse* mutable_install_snapshot_res();
+  void set_allocated_install_snapshot_res(::floyd::CmdResponse_InstallSnapshotResponse* install_snapshot_res);
+  private:
+  const ::floyd::CmdResponse_InstallSnapshotResponse& _internal_install_snapshot_res() const;
+  ::floyd::CmdResponse_InstallSnapshotResponse* _internal_mutable_install_snapshot_res();
+  public:
+  void unsafe_arena_set_allocated_install_snapshot_res(
+      ::floyd::CmdResponse_InstallSnapshotResponse* install_snapshot_res);
+  ::floyd::CmdResponse_InstallSnapshotResponse* unsafe_arena_release_install_snapshot_res();
+
+  // required .floyd.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::floyd::Type type() const;
+  void set_type(::floyd::Type value);
+  private:
+  ::floyd::Type _internal_type() const;
+  void _internal_set_type(::floyd::Type value);
+  public:
+
+  // optional .floyd.StatusCode code = 2;
+  bool has_code() const;
+  private:
+  bool _internal_has_code() const;
+  public:
+  void clear_code();
+  ::floyd::StatusCode code() const;
+  void set_code(::floyd::StatusCode value);
+  private:
+  ::floyd::StatusCode _internal_code() const;
+  void _internal_set_code(::floyd::StatusCode value);
+  public:
 
   // @@protoc_insertion_point(class_scope:floyd.CmdResponse)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_code();
-  inline void clear_has_code();
-  inline void set_has_msg();
-  inline void clear_has_msg();
-  inline void set_has_kv();
-  inline void clear_has_kv();
-  inline void set_has_kvs();
-  inline void clear_has_kvs();
-  inline void set_has_request_vote_res();
-  inline void clear_has_request_vote_res();
-  inline void set_has_append_entries_res();
-  inline void clear_has_append_entries_res();
-  inline void set_has_server_status();
-  inline void clear_has_server_status();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  int type_;
-  int code_;
-  ::std::string* msg_;
-  ::floyd::CmdResponse_Kv* kv_;
-  ::floyd::CmdResponse_Kvs* kvs_;
-  ::floyd::CmdResponse_RequestVoteResponse* request_vote_res_;
-  ::floyd::CmdResponse_AppendEntriesResponse* append_entries_res_;
-  ::floyd::CmdResponse_ServerStatus* server_status_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(8 + 31) / 32];
-
-  friend void  protobuf_AddDesc_floyd_2eproto();
-  friend void protobuf_AssignDesc_floyd_2eproto();
-  friend void protobuf_ShutdownFile_floyd_2eproto();
-
-  void InitAsDefaultInstance();
-  static CmdResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse > forward_res_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    ::floyd::CmdResponse_Kv* kv_;
+    ::floyd::CmdResponse_Kvs* kvs_;
+    ::floyd::CmdResponse_RequestVoteResponse* request_vote_res_;
+    ::floyd::CmdResponse_AppendEntriesResponse* append_entries_res_;
+    ::floyd::CmdResponse_ServerStatus* server_status_;
+    ::floyd::CmdResponse_ReadIndexResponse* read_index_res_;
+    ::floyd::CmdResponse_InstallSnapshotResponse* install_snapshot_res_;
+    int type_;
+    int code_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_floyd_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Entry_Operation
+
+// required .floyd.Entry.OpType optype = 1;
+inline bool Entry_Operation::_internal_has_optype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Entry_Operation::has_optype() const {
+  return _internal_has_optype();
+}
+inline void Entry_Operation::clear_optype() {
+  _impl_.optype_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::floyd::Entry_OpType Entry_Operation::_internal_optype() const {
+  return static_cast< ::floyd::Entry_OpType >(_impl_.optype_);
+}
+inline ::floyd::Entry_OpType Entry_Operation::optype() const {
+  // @@protoc_insertion_point(field_get:floyd.Entry.Operation.optype)
+  return _internal_optype();
+}
+inline void Entry_Operation::_internal_set_optype(::floyd::Entry_OpType value) {
+  assert(::floyd::Entry_OpType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.optype_ = value;
+}
+inline void Entry_Operation::set_optype(::floyd::Entry_OpType value) {
+  _internal_set_optype(value);
+  // @@protoc_insertion_point(field_set:floyd.Entry.Operation.optype)
+}
+
+// required bytes key = 2;
+inline bool Entry_Operation::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Entry_Operation::has_key() const {
+  return _internal_has_key();
+}
+inline void Entry_Operation::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Entry_Operation::key() const {
+  // @@protoc_insertion_point(field_get:floyd.Entry.Operation.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry_Operation::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.Entry.Operation.key)
+}
+inline std::string* Entry_Operation::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:floyd.Entry.Operation.key)
+  return _s;
+}
+inline const std::string& Entry_Operation::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Entry_Operation::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry_Operation::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry_Operation::release_key() {
+  // @@protoc_insertion_point(field_release:floyd.Entry.Operation.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Entry_Operation::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.Entry.Operation.key)
+}
+
+// optional bytes value = 3;
+inline bool Entry_Operation::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Entry_Operation::has_value() const {
+  return _internal_has_value();
+}
+inline void Entry_Operation::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Entry_Operation::value() const {
+  // @@protoc_insertion_point(field_get:floyd.Entry.Operation.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry_Operation::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.Entry.Operation.value)
+}
+inline std::string* Entry_Operation::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:floyd.Entry.Operation.value)
+  return _s;
+}
+inline const std::string& Entry_Operation::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Entry_Operation::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry_Operation::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry_Operation::release_value() {
+  // @@protoc_insertion_point(field_release:floyd.Entry.Operation.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Entry_Operation::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.Entry.Operation.value)
+}
+
+// -------------------------------------------------------------------
+
 // Entry
 
 // required uint64 term = 1;
+inline bool Entry::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool Entry::has_term() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_term();
+}
+inline void Entry::clear_term() {
+  _impl_.term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Entry::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint64_t Entry::term() const {
+  // @@protoc_insertion_point(field_get:floyd.Entry.term)
+  return _internal_term();
+}
+inline void Entry::_internal_set_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.term_ = value;
+}
+inline void Entry::set_term(uint64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:floyd.Entry.term)
+}
+
+// required string key = 2;
+inline bool Entry::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Entry::has_key() const {
+  return _internal_has_key();
+}
+inline void Entry::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Entry::key() const {
+  // @@protoc_insertion_point(field_get:floyd.Entry.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.Entry.key)
+}
+inline std::string* Entry::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:floyd.Entry.key)
+  return _s;
+}
+inline const std::string& Entry::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Entry::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_key() {
+  // @@protoc_insertion_point(field_release:floyd.Entry.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Entry::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.Entry.key)
+}
+
+// optional bytes value = 3;
+inline bool Entry::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Entry::has_value() const {
+  return _internal_has_value();
+}
+inline void Entry::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Entry::value() const {
+  // @@protoc_insertion_point(field_get:floyd.Entry.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.Entry.value)
+}
+inline std::string* Entry::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:floyd.Entry.value)
+  return _s;
+}
+inline const std::string& Entry::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Entry::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_value() {
+  // @@protoc_insertion_point(field_release:floyd.Entry.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Entry::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.Entry.value)
+}
+
+// required .floyd.Entry.OpType optype = 4;
+inline bool Entry::_internal_has_optype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Entry::has_optype() const {
+  return _internal_has_optype();
+}
+inline void Entry::clear_optype() {
+  _impl_.optype_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::floyd::Entry_OpType Entry::_internal_optype() const {
+  return static_cast< ::floyd::Entry_OpType >(_impl_.optype_);
+}
+inline ::floyd::Entry_OpType Entry::optype() const {
+  // @@protoc_insertion_point(field_get:floyd.Entry.optype)
+  return _internal_optype();
+}
+inline void Entry::_internal_set_optype(::floyd::Entry_OpType value) {
+  assert(::floyd::Entry_OpType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.optype_ = value;
+}
+inline void Entry::set_optype(::floyd::Entry_OpType value) {
+  _internal_set_optype(value);
+  // @@protoc_insertion_point(field_set:floyd.Entry.optype)
+}
+
+// repeated .floyd.Entry.Operation ops = 5;
+inline int Entry::_internal_ops_size() const {
+  return _impl_.ops_.size();
+}
+inline int Entry::ops_size() const {
+  return _internal_ops_size();
+}
+inline void Entry::clear_ops() {
+  _impl_.ops_.Clear();
+}
+inline ::floyd::Entry_Operation* Entry::mutable_ops(int index) {
+  // @@protoc_insertion_point(field_mutable:floyd.Entry.ops)
+  return _impl_.ops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >*
+Entry::mutable_ops() {
+  // @@protoc_insertion_point(field_mutable_list:floyd.Entry.ops)
+  return &_impl_.ops_;
+}
+inline const ::floyd::Entry_Operation& Entry::_internal_ops(int index) const {
+  return _impl_.ops_.Get(index);
+}
+inline const ::floyd::Entry_Operation& Entry::ops(int index) const {
+  // @@protoc_insertion_point(field_get:floyd.Entry.ops)
+  return _internal_ops(index);
+}
+inline ::floyd::Entry_Operation* Entry::_internal_add_ops() {
+  return _impl_.ops_.Add();
+}
+inline ::floyd::Entry_Operation* Entry::add_ops() {
+  ::floyd::Entry_Operation* _add = _internal_add_ops();
+  // @@protoc_insertion_point(field_add:floyd.Entry.ops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >&
+Entry::ops() const {
+  // @@protoc_insertion_point(field_list:floyd.Entry.ops)
+  return _impl_.ops_;
+}
+
+// optional bytes command = 6;
+inline bool Entry::_internal_has_command() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Entry::has_command() const {
+  return _internal_has_command();
+}
+inline void Entry::clear_command() {
+  _impl_.command_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Entry::command() const {
+  // @@protoc_insertion_point(field_get:floyd.Entry.command)
+  return _internal_command();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_command(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.command_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.Entry.command)
+}
+inline std::string* Entry::mutable_command() {
+  std::string* _s = _internal_mutable_command();
+  // @@protoc_insertion_point(field_mutable:floyd.Entry.command)
+  return _s;
+}
+inline const std::string& Entry::_internal_command() const {
+  return _impl_.command_.Get();
+}
+inline void Entry::_internal_set_command(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.command_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_command() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.command_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_command() {
+  // @@protoc_insertion_point(field_release:floyd.Entry.command)
+  if (!_internal_has_command()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.command_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Entry::set_allocated_command(std::string* command) {
+  if (command != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.Entry.command)
+}
+
+// -------------------------------------------------------------------
+
+// KvCommand
+
+// repeated .floyd.Entry.Operation ops = 1;
+inline int KvCommand::_internal_ops_size() const {
+  return _impl_.ops_.size();
+}
+inline int KvCommand::ops_size() const {
+  return _internal_ops_size();
+}
+inline void KvCommand::clear_ops() {
+  _impl_.ops_.Clear();
+}
+inline ::floyd::Entry_Operation* KvCommand::mutable_ops(int index) {
+  // @@protoc_insertion_point(field_mutable:floyd.KvCommand.ops)
+  return _impl_.ops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >*
+KvCommand::mutable_ops() {
+  // @@protoc_insertion_point(field_mutable_list:floyd.KvCommand.ops)
+  return &_impl_.ops_;
+}
+inline const ::floyd::Entry_Operation& KvCommand::_internal_ops(int index) const {
+  return _impl_.ops_.Get(index);
+}
+inline const ::floyd::Entry_Operation& KvCommand::ops(int index) const {
+  // @@protoc_insertion_point(field_get:floyd.KvCommand.ops)
+  return _internal_ops(index);
+}
+inline ::floyd::Entry_Operation* KvCommand::_internal_add_ops() {
+  return _impl_.ops_.Add();
+}
+inline ::floyd::Entry_Operation* KvCommand::add_ops() {
+  ::floyd::Entry_Operation* _add = _internal_add_ops();
+  // @@protoc_insertion_point(field_add:floyd.KvCommand.ops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >&
+KvCommand::ops() const {
+  // @@protoc_insertion_point(field_list:floyd.KvCommand.ops)
+  return _impl_.ops_;
+}
+
+// -------------------------------------------------------------------
+
+// HardState
+
+// required uint64 current_term = 1;
+inline bool HardState::_internal_has_current_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HardState::has_current_term() const {
+  return _internal_has_current_term();
+}
+inline void HardState::clear_current_term() {
+  _impl_.current_term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t HardState::_internal_current_term() const {
+  return _impl_.current_term_;
+}
+inline uint64_t HardState::current_term() const {
+  // @@protoc_insertion_point(field_get:floyd.HardState.current_term)
+  return _internal_current_term();
+}
+inline void HardState::_internal_set_current_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.current_term_ = value;
+}
+inline void HardState::set_current_term(uint64_t value) {
+  _internal_set_current_term(value);
+  // @@protoc_insertion_point(field_set:floyd.HardState.current_term)
+}
+
+// optional bytes voted_for_ip = 2;
+inline bool HardState::_internal_has_voted_for_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HardState::has_voted_for_ip() const {
+  return _internal_has_voted_for_ip();
+}
+inline void HardState::clear_voted_for_ip() {
+  _impl_.voted_for_ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HardState::voted_for_ip() const {
+  // @@protoc_insertion_point(field_get:floyd.HardState.voted_for_ip)
+  return _internal_voted_for_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HardState::set_voted_for_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.voted_for_ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.HardState.voted_for_ip)
+}
+inline std::string* HardState::mutable_voted_for_ip() {
+  std::string* _s = _internal_mutable_voted_for_ip();
+  // @@protoc_insertion_point(field_mutable:floyd.HardState.voted_for_ip)
+  return _s;
+}
+inline const std::string& HardState::_internal_voted_for_ip() const {
+  return _impl_.voted_for_ip_.Get();
+}
+inline void HardState::_internal_set_voted_for_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.voted_for_ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HardState::_internal_mutable_voted_for_ip() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.voted_for_ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HardState::release_voted_for_ip() {
+  // @@protoc_insertion_point(field_release:floyd.HardState.voted_for_ip)
+  if (!_internal_has_voted_for_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.voted_for_ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.voted_for_ip_.IsDefault()) {
+    _impl_.voted_for_ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HardState::set_allocated_voted_for_ip(std::string* voted_for_ip) {
+  if (voted_for_ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.voted_for_ip_.SetAllocated(voted_for_ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.voted_for_ip_.IsDefault()) {
+    _impl_.voted_for_ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.HardState.voted_for_ip)
+}
+
+// optional int32 voted_for_port = 3;
+inline bool HardState::_internal_has_voted_for_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool HardState::has_voted_for_port() const {
+  return _internal_has_voted_for_port();
 }
-inline void Entry::set_has_term() {
-  _has_bits_[0] |= 0x00000001u;
+inline void HardState::clear_voted_for_port() {
+  _impl_.voted_for_port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Entry::clear_has_term() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t HardState::_internal_voted_for_port() const {
+  return _impl_.voted_for_port_;
 }
-inline void Entry::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
-  clear_has_term();
+inline int32_t HardState::voted_for_port() const {
+  // @@protoc_insertion_point(field_get:floyd.HardState.voted_for_port)
+  return _internal_voted_for_port();
 }
-inline ::google::protobuf::uint64 Entry::term() const {
-  return term_;
+inline void HardState::_internal_set_voted_for_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.voted_for_port_ = value;
 }
-inline void Entry::set_term(::google::protobuf::uint64 value) {
-  set_has_term();
-  term_ = value;
+inline void HardState::set_voted_for_port(int32_t value) {
+  _internal_set_voted_for_port(value);
+  // @@protoc_insertion_point(field_set:floyd.HardState.voted_for_port)
 }
 
-// required string key = 2;
-inline bool Entry::has_key() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional uint64 commit_index = 4;
+inline bool HardState::_internal_has_commit_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Entry::set_has_key() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool HardState::has_commit_index() const {
+  return _internal_has_commit_index();
 }
-inline void Entry::clear_has_key() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void HardState::clear_commit_index() {
+  _impl_.commit_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Entry::clear_key() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    key_->clear();
-  }
-  clear_has_key();
+inline uint64_t HardState::_internal_commit_index() const {
+  return _impl_.commit_index_;
 }
-inline const ::std::string& Entry::key() const {
-  return *key_;
+inline uint64_t HardState::commit_index() const {
+  // @@protoc_insertion_point(field_get:floyd.HardState.commit_index)
+  return _internal_commit_index();
 }
-inline void Entry::set_key(const ::std::string& value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline void HardState::_internal_set_commit_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.commit_index_ = value;
 }
-inline void Entry::set_key(const char* value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline void HardState::set_commit_index(uint64_t value) {
+  _internal_set_commit_index(value);
+  // @@protoc_insertion_point(field_set:floyd.HardState.commit_index)
 }
-inline void Entry::set_key(const char* value, size_t size) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(reinterpret_cast<const char*>(value), size);
+
+// -------------------------------------------------------------------
+
+// CmdRequest_Kv
+
+// required bytes key = 1;
+inline bool CmdRequest_Kv::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* Entry::mutable_key() {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  return key_;
+inline bool CmdRequest_Kv::has_key() const {
+  return _internal_has_key();
 }
-inline ::std::string* Entry::release_key() {
-  clear_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void CmdRequest_Kv::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_Kv::key() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.Kv.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Kv::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.Kv.key)
+}
+inline std::string* CmdRequest_Kv::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.Kv.key)
+  return _s;
+}
+inline const std::string& CmdRequest_Kv::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CmdRequest_Kv::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Kv::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Kv::release_key() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.Kv.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Kv::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = key_;
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Entry::set_allocated_key(::std::string* key) {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (key) {
-    set_has_key();
-    key_ = key;
-  } else {
-    clear_has_key();
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.Kv.key)
 }
 
-// optional bytes value = 3;
-inline bool Entry::has_value() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void Entry::set_has_value() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void Entry::clear_has_value() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void Entry::clear_value() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    value_->clear();
-  }
-  clear_has_value();
+// optional bytes value = 2;
+inline bool CmdRequest_Kv::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline const ::std::string& Entry::value() const {
-  return *value_;
+inline bool CmdRequest_Kv::has_value() const {
+  return _internal_has_value();
 }
-inline void Entry::set_value(const ::std::string& value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+inline void CmdRequest_Kv::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdRequest_Kv::value() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.Kv.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_Kv::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.Kv.value)
+}
+inline std::string* CmdRequest_Kv::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.Kv.value)
+  return _s;
+}
+inline const std::string& CmdRequest_Kv::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CmdRequest_Kv::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Kv::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_Kv::release_value() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.Kv.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_Kv::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  value_->assign(value);
-}
-inline void Entry::set_value(const char* value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
-  value_->assign(value);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.Kv.value)
 }
-inline void Entry::set_value(const void* value, size_t size) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(reinterpret_cast<const char*>(value), size);
+
+// -------------------------------------------------------------------
+
+// CmdRequest_User
+
+// required bytes ip = 1;
+inline bool CmdRequest_User::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* Entry::mutable_value() {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  return value_;
+inline bool CmdRequest_User::has_ip() const {
+  return _internal_has_ip();
 }
-inline ::std::string* Entry::release_value() {
-  clear_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void CmdRequest_User::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_User::ip() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.User.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_User::set_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.User.ip)
+}
+inline std::string* CmdRequest_User::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.User.ip)
+  return _s;
+}
+inline const std::string& CmdRequest_User::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void CmdRequest_User::_internal_set_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_User::_internal_mutable_ip() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_User::release_ip() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.User.ip)
+  if (!_internal_has_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_User::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = value_;
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Entry::set_allocated_value(::std::string* value) {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (value) {
-    set_has_value();
-    value_ = value;
-  } else {
-    clear_has_value();
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.User.ip)
 }
 
-// required .floyd.Entry.OpType optype = 4;
-inline bool Entry::has_optype() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// required int32 port = 2;
+inline bool CmdRequest_User::_internal_has_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Entry::set_has_optype() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool CmdRequest_User::has_port() const {
+  return _internal_has_port();
 }
-inline void Entry::clear_has_optype() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void CmdRequest_User::clear_port() {
+  _impl_.port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Entry::clear_optype() {
-  optype_ = 0;
-  clear_has_optype();
+inline int32_t CmdRequest_User::_internal_port() const {
+  return _impl_.port_;
 }
-inline ::floyd::Entry_OpType Entry::optype() const {
-  return static_cast< ::floyd::Entry_OpType >(optype_);
+inline int32_t CmdRequest_User::port() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.User.port)
+  return _internal_port();
 }
-inline void Entry::set_optype(::floyd::Entry_OpType value) {
-  assert(::floyd::Entry_OpType_IsValid(value));
-  set_has_optype();
-  optype_ = value;
+inline void CmdRequest_User::_internal_set_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.port_ = value;
+}
+inline void CmdRequest_User::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.User.port)
 }
 
 // -------------------------------------------------------------------
 
-// CmdRequest_Kv
+// CmdRequest_RequestVote
 
-// required bytes key = 1;
-inline bool CmdRequest_Kv::has_key() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required uint64 term = 1;
+inline bool CmdRequest_RequestVote::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdRequest_Kv::set_has_key() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest_RequestVote::has_term() const {
+  return _internal_has_term();
 }
-inline void CmdRequest_Kv::clear_has_key() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest_RequestVote::clear_term() {
+  _impl_.term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdRequest_Kv::clear_key() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    key_->clear();
-  }
-  clear_has_key();
+inline uint64_t CmdRequest_RequestVote::_internal_term() const {
+  return _impl_.term_;
 }
-inline const ::std::string& CmdRequest_Kv::key() const {
-  return *key_;
+inline uint64_t CmdRequest_RequestVote::term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.RequestVote.term)
+  return _internal_term();
 }
-inline void CmdRequest_Kv::set_key(const ::std::string& value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline void CmdRequest_RequestVote::_internal_set_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.term_ = value;
 }
-inline void CmdRequest_Kv::set_key(const char* value) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(value);
+inline void CmdRequest_RequestVote::set_term(uint64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.RequestVote.term)
 }
-inline void CmdRequest_Kv::set_key(const void* value, size_t size) {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  key_->assign(reinterpret_cast<const char*>(value), size);
+
+// required bytes ip = 2;
+inline bool CmdRequest_RequestVote::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* CmdRequest_Kv::mutable_key() {
-  set_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    key_ = new ::std::string;
-  }
-  return key_;
+inline bool CmdRequest_RequestVote::has_ip() const {
+  return _internal_has_ip();
 }
-inline ::std::string* CmdRequest_Kv::release_key() {
-  clear_has_key();
-  if (key_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void CmdRequest_RequestVote::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_RequestVote::ip() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.RequestVote.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_RequestVote::set_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.RequestVote.ip)
+}
+inline std::string* CmdRequest_RequestVote::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.RequestVote.ip)
+  return _s;
+}
+inline const std::string& CmdRequest_RequestVote::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void CmdRequest_RequestVote::_internal_set_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_RequestVote::_internal_mutable_ip() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_RequestVote::release_ip() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.RequestVote.ip)
+  if (!_internal_has_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_RequestVote::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = key_;
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void CmdRequest_Kv::set_allocated_key(::std::string* key) {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (key) {
-    set_has_key();
-    key_ = key;
-  } else {
-    clear_has_key();
-    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.RequestVote.ip)
 }
 
-// optional bytes value = 2;
-inline bool CmdRequest_Kv::has_value() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// required int32 port = 3;
+inline bool CmdRequest_RequestVote::_internal_has_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CmdRequest_RequestVote::has_port() const {
+  return _internal_has_port();
 }
-inline void CmdRequest_Kv::set_has_value() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdRequest_RequestVote::clear_port() {
+  _impl_.port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void CmdRequest_Kv::clear_has_value() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t CmdRequest_RequestVote::_internal_port() const {
+  return _impl_.port_;
 }
-inline void CmdRequest_Kv::clear_value() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    value_->clear();
-  }
-  clear_has_value();
+inline int32_t CmdRequest_RequestVote::port() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.RequestVote.port)
+  return _internal_port();
 }
-inline const ::std::string& CmdRequest_Kv::value() const {
-  return *value_;
+inline void CmdRequest_RequestVote::_internal_set_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.port_ = value;
 }
-inline void CmdRequest_Kv::set_value(const ::std::string& value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(value);
+inline void CmdRequest_RequestVote::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.RequestVote.port)
 }
-inline void CmdRequest_Kv::set_value(const char* value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(value);
+
+// required uint64 last_log_index = 4;
+inline bool CmdRequest_RequestVote::_internal_has_last_log_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void CmdRequest_Kv::set_value(const void* value, size_t size) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(reinterpret_cast<const char*>(value), size);
+inline bool CmdRequest_RequestVote::has_last_log_index() const {
+  return _internal_has_last_log_index();
 }
-inline ::std::string* CmdRequest_Kv::mutable_value() {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  return value_;
+inline void CmdRequest_RequestVote::clear_last_log_index() {
+  _impl_.last_log_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::std::string* CmdRequest_Kv::release_value() {
-  clear_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = value_;
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline uint64_t CmdRequest_RequestVote::_internal_last_log_index() const {
+  return _impl_.last_log_index_;
 }
-inline void CmdRequest_Kv::set_allocated_value(::std::string* value) {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
-  }
-  if (value) {
-    set_has_value();
-    value_ = value;
-  } else {
-    clear_has_value();
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline uint64_t CmdRequest_RequestVote::last_log_index() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.RequestVote.last_log_index)
+  return _internal_last_log_index();
+}
+inline void CmdRequest_RequestVote::_internal_set_last_log_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.last_log_index_ = value;
+}
+inline void CmdRequest_RequestVote::set_last_log_index(uint64_t value) {
+  _internal_set_last_log_index(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.RequestVote.last_log_index)
+}
+
+// required uint64 last_log_term = 5;
+inline bool CmdRequest_RequestVote::_internal_has_last_log_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CmdRequest_RequestVote::has_last_log_term() const {
+  return _internal_has_last_log_term();
+}
+inline void CmdRequest_RequestVote::clear_last_log_term() {
+  _impl_.last_log_term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t CmdRequest_RequestVote::_internal_last_log_term() const {
+  return _impl_.last_log_term_;
+}
+inline uint64_t CmdRequest_RequestVote::last_log_term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.RequestVote.last_log_term)
+  return _internal_last_log_term();
+}
+inline void CmdRequest_RequestVote::_internal_set_last_log_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.last_log_term_ = value;
+}
+inline void CmdRequest_RequestVote::set_last_log_term(uint64_t value) {
+  _internal_set_last_log_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.RequestVote.last_log_term)
 }
 
 // -------------------------------------------------------------------
 
-// CmdRequest_User
+// CmdRequest_AppendEntries
 
-// required bytes ip = 1;
-inline bool CmdRequest_User::has_ip() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required uint64 term = 1;
+inline bool CmdRequest_AppendEntries::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdRequest_User::set_has_ip() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest_AppendEntries::has_term() const {
+  return _internal_has_term();
 }
-inline void CmdRequest_User::clear_has_ip() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest_AppendEntries::clear_term() {
+  _impl_.term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdRequest_User::clear_ip() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    ip_->clear();
-  }
-  clear_has_ip();
+inline uint64_t CmdRequest_AppendEntries::_internal_term() const {
+  return _impl_.term_;
 }
-inline const ::std::string& CmdRequest_User::ip() const {
-  return *ip_;
+inline uint64_t CmdRequest_AppendEntries::term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.AppendEntries.term)
+  return _internal_term();
 }
-inline void CmdRequest_User::set_ip(const ::std::string& value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
+inline void CmdRequest_AppendEntries::_internal_set_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.term_ = value;
 }
-inline void CmdRequest_User::set_ip(const char* value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
+inline void CmdRequest_AppendEntries::set_term(uint64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.AppendEntries.term)
 }
-inline void CmdRequest_User::set_ip(const void* value, size_t size) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(reinterpret_cast<const char*>(value), size);
+
+// required bytes ip = 2;
+inline bool CmdRequest_AppendEntries::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::std::string* CmdRequest_User::mutable_ip() {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  return ip_;
+inline bool CmdRequest_AppendEntries::has_ip() const {
+  return _internal_has_ip();
 }
-inline ::std::string* CmdRequest_User::release_ip() {
-  clear_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void CmdRequest_AppendEntries::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_AppendEntries::ip() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.AppendEntries.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_AppendEntries::set_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.AppendEntries.ip)
+}
+inline std::string* CmdRequest_AppendEntries::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.AppendEntries.ip)
+  return _s;
+}
+inline const std::string& CmdRequest_AppendEntries::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void CmdRequest_AppendEntries::_internal_set_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_AppendEntries::_internal_mutable_ip() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_AppendEntries::release_ip() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.AppendEntries.ip)
+  if (!_internal_has_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_AppendEntries::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = ip_;
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void CmdRequest_User::set_allocated_ip(::std::string* ip) {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (ip) {
-    set_has_ip();
-    ip_ = ip;
-  } else {
-    clear_has_ip();
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.AppendEntries.ip)
 }
 
-// required int32 port = 2;
-inline bool CmdRequest_User::has_port() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// required int32 port = 3;
+inline bool CmdRequest_AppendEntries::_internal_has_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void CmdRequest_User::set_has_port() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdRequest_AppendEntries::has_port() const {
+  return _internal_has_port();
 }
-inline void CmdRequest_User::clear_has_port() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest_AppendEntries::clear_port() {
+  _impl_.port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void CmdRequest_User::clear_port() {
-  port_ = 0;
-  clear_has_port();
+inline int32_t CmdRequest_AppendEntries::_internal_port() const {
+  return _impl_.port_;
 }
-inline ::google::protobuf::int32 CmdRequest_User::port() const {
-  return port_;
+inline int32_t CmdRequest_AppendEntries::port() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.AppendEntries.port)
+  return _internal_port();
 }
-inline void CmdRequest_User::set_port(::google::protobuf::int32 value) {
-  set_has_port();
-  port_ = value;
+inline void CmdRequest_AppendEntries::_internal_set_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.port_ = value;
+}
+inline void CmdRequest_AppendEntries::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.AppendEntries.port)
 }
 
-// -------------------------------------------------------------------
-
-// CmdRequest_RequestVote
-
-// required uint64 term = 1;
-inline bool CmdRequest_RequestVote::has_term() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required uint64 prev_log_index = 4;
+inline bool CmdRequest_AppendEntries::_internal_has_prev_log_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CmdRequest_AppendEntries::has_prev_log_index() const {
+  return _internal_has_prev_log_index();
 }
-inline void CmdRequest_RequestVote::set_has_term() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdRequest_AppendEntries::clear_prev_log_index() {
+  _impl_.prev_log_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest_RequestVote::clear_has_term() {
-  _has_bits_[0] &= ~0x00000001u;
+inline uint64_t CmdRequest_AppendEntries::_internal_prev_log_index() const {
+  return _impl_.prev_log_index_;
 }
-inline void CmdRequest_RequestVote::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
-  clear_has_term();
+inline uint64_t CmdRequest_AppendEntries::prev_log_index() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.AppendEntries.prev_log_index)
+  return _internal_prev_log_index();
 }
-inline ::google::protobuf::uint64 CmdRequest_RequestVote::term() const {
-  return term_;
+inline void CmdRequest_AppendEntries::_internal_set_prev_log_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.prev_log_index_ = value;
 }
-inline void CmdRequest_RequestVote::set_term(::google::protobuf::uint64 value) {
-  set_has_term();
-  term_ = value;
+inline void CmdRequest_AppendEntries::set_prev_log_index(uint64_t value) {
+  _internal_set_prev_log_index(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.AppendEntries.prev_log_index)
 }
 
-// required bytes ip = 2;
-inline bool CmdRequest_RequestVote::has_ip() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// required uint64 prev_log_term = 5;
+inline bool CmdRequest_AppendEntries::_internal_has_prev_log_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void CmdRequest_RequestVote::set_has_ip() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdRequest_AppendEntries::has_prev_log_term() const {
+  return _internal_has_prev_log_term();
 }
-inline void CmdRequest_RequestVote::clear_has_ip() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest_AppendEntries::clear_prev_log_term() {
+  _impl_.prev_log_term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdRequest_RequestVote::clear_ip() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    ip_->clear();
-  }
-  clear_has_ip();
+inline uint64_t CmdRequest_AppendEntries::_internal_prev_log_term() const {
+  return _impl_.prev_log_term_;
 }
-inline const ::std::string& CmdRequest_RequestVote::ip() const {
-  return *ip_;
+inline uint64_t CmdRequest_AppendEntries::prev_log_term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.AppendEntries.prev_log_term)
+  return _internal_prev_log_term();
 }
-inline void CmdRequest_RequestVote::set_ip(const ::std::string& value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
+inline void CmdRequest_AppendEntries::_internal_set_prev_log_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.prev_log_term_ = value;
 }
-inline void CmdRequest_RequestVote::set_ip(const char* value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
+inline void CmdRequest_AppendEntries::set_prev_log_term(uint64_t value) {
+  _internal_set_prev_log_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.AppendEntries.prev_log_term)
 }
-inline void CmdRequest_RequestVote::set_ip(const void* value, size_t size) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(reinterpret_cast<const char*>(value), size);
+
+// required uint64 leader_commit = 6;
+inline bool CmdRequest_AppendEntries::_internal_has_leader_commit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline ::std::string* CmdRequest_RequestVote::mutable_ip() {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  return ip_;
+inline bool CmdRequest_AppendEntries::has_leader_commit() const {
+  return _internal_has_leader_commit();
 }
-inline ::std::string* CmdRequest_RequestVote::release_ip() {
-  clear_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = ip_;
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void CmdRequest_AppendEntries::clear_leader_commit() {
+  _impl_.leader_commit_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void CmdRequest_RequestVote::set_allocated_ip(::std::string* ip) {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
-  }
-  if (ip) {
-    set_has_ip();
-    ip_ = ip;
-  } else {
-    clear_has_ip();
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline uint64_t CmdRequest_AppendEntries::_internal_leader_commit() const {
+  return _impl_.leader_commit_;
+}
+inline uint64_t CmdRequest_AppendEntries::leader_commit() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.AppendEntries.leader_commit)
+  return _internal_leader_commit();
+}
+inline void CmdRequest_AppendEntries::_internal_set_leader_commit(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.leader_commit_ = value;
+}
+inline void CmdRequest_AppendEntries::set_leader_commit(uint64_t value) {
+  _internal_set_leader_commit(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.AppendEntries.leader_commit)
 }
 
-// required int32 port = 3;
-inline bool CmdRequest_RequestVote::has_port() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// repeated bytes entries = 7;
+inline int CmdRequest_AppendEntries::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline void CmdRequest_RequestVote::set_has_port() {
-  _has_bits_[0] |= 0x00000004u;
+inline int CmdRequest_AppendEntries::entries_size() const {
+  return _internal_entries_size();
 }
-inline void CmdRequest_RequestVote::clear_has_port() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest_AppendEntries::clear_entries() {
+  _impl_.entries_.Clear();
 }
-inline void CmdRequest_RequestVote::clear_port() {
-  port_ = 0;
-  clear_has_port();
+inline std::string* CmdRequest_AppendEntries::add_entries() {
+  std::string* _s = _internal_add_entries();
+  // @@protoc_insertion_point(field_add_mutable:floyd.CmdRequest.AppendEntries.entries)
+  return _s;
 }
-inline ::google::protobuf::int32 CmdRequest_RequestVote::port() const {
-  return port_;
+inline const std::string& CmdRequest_AppendEntries::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
 }
-inline void CmdRequest_RequestVote::set_port(::google::protobuf::int32 value) {
-  set_has_port();
-  port_ = value;
+inline const std::string& CmdRequest_AppendEntries::entries(int index) const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.AppendEntries.entries)
+  return _internal_entries(index);
 }
-
-// required uint64 last_log_index = 4;
-inline bool CmdRequest_RequestVote::has_last_log_index() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline std::string* CmdRequest_AppendEntries::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.AppendEntries.entries)
+  return _impl_.entries_.Mutable(index);
 }
-inline void CmdRequest_RequestVote::set_has_last_log_index() {
-  _has_bits_[0] |= 0x00000008u;
+inline void CmdRequest_AppendEntries::set_entries(int index, const std::string& value) {
+  _impl_.entries_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.AppendEntries.entries)
 }
-inline void CmdRequest_RequestVote::clear_has_last_log_index() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void CmdRequest_AppendEntries::set_entries(int index, std::string&& value) {
+  _impl_.entries_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.AppendEntries.entries)
 }
-inline void CmdRequest_RequestVote::clear_last_log_index() {
-  last_log_index_ = GOOGLE_ULONGLONG(0);
-  clear_has_last_log_index();
+inline void CmdRequest_AppendEntries::set_entries(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.entries_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:floyd.CmdRequest.AppendEntries.entries)
 }
-inline ::google::protobuf::uint64 CmdRequest_RequestVote::last_log_index() const {
-  return last_log_index_;
+inline void CmdRequest_AppendEntries::set_entries(int index, const void* value, size_t size) {
+  _impl_.entries_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:floyd.CmdRequest.AppendEntries.entries)
 }
-inline void CmdRequest_RequestVote::set_last_log_index(::google::protobuf::uint64 value) {
-  set_has_last_log_index();
-  last_log_index_ = value;
+inline std::string* CmdRequest_AppendEntries::_internal_add_entries() {
+  return _impl_.entries_.Add();
 }
-
-// required uint64 last_log_term = 5;
-inline bool CmdRequest_RequestVote::has_last_log_term() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline void CmdRequest_AppendEntries::add_entries(const std::string& value) {
+  _impl_.entries_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:floyd.CmdRequest.AppendEntries.entries)
 }
-inline void CmdRequest_RequestVote::set_has_last_log_term() {
-  _has_bits_[0] |= 0x00000010u;
+inline void CmdRequest_AppendEntries::add_entries(std::string&& value) {
+  _impl_.entries_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:floyd.CmdRequest.AppendEntries.entries)
 }
-inline void CmdRequest_RequestVote::clear_has_last_log_term() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void CmdRequest_AppendEntries::add_entries(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.entries_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:floyd.CmdRequest.AppendEntries.entries)
 }
-inline void CmdRequest_RequestVote::clear_last_log_term() {
-  last_log_term_ = GOOGLE_ULONGLONG(0);
-  clear_has_last_log_term();
+inline void CmdRequest_AppendEntries::add_entries(const void* value, size_t size) {
+  _impl_.entries_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:floyd.CmdRequest.AppendEntries.entries)
 }
-inline ::google::protobuf::uint64 CmdRequest_RequestVote::last_log_term() const {
-  return last_log_term_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CmdRequest_AppendEntries::entries() const {
+  // @@protoc_insertion_point(field_list:floyd.CmdRequest.AppendEntries.entries)
+  return _impl_.entries_;
 }
-inline void CmdRequest_RequestVote::set_last_log_term(::google::protobuf::uint64 value) {
-  set_has_last_log_term();
-  last_log_term_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CmdRequest_AppendEntries::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:floyd.CmdRequest.AppendEntries.entries)
+  return &_impl_.entries_;
 }
 
 // -------------------------------------------------------------------
 
-// CmdRequest_AppendEntries
+// CmdRequest_ServerStatus
 
-// required bytes ip = 1;
-inline bool CmdRequest_AppendEntries::has_ip() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required int64 term = 1;
+inline bool CmdRequest_ServerStatus::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdRequest_ServerStatus::has_term() const {
+  return _internal_has_term();
 }
-inline void CmdRequest_AppendEntries::set_has_ip() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdRequest_ServerStatus::clear_term() {
+  _impl_.term_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdRequest_AppendEntries::clear_has_ip() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int64_t CmdRequest_ServerStatus::_internal_term() const {
+  return _impl_.term_;
 }
-inline void CmdRequest_AppendEntries::clear_ip() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    ip_->clear();
-  }
-  clear_has_ip();
+inline int64_t CmdRequest_ServerStatus::term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.ServerStatus.term)
+  return _internal_term();
 }
-inline const ::std::string& CmdRequest_AppendEntries::ip() const {
-  return *ip_;
+inline void CmdRequest_ServerStatus::_internal_set_term(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.term_ = value;
 }
-inline void CmdRequest_AppendEntries::set_ip(const ::std::string& value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
+inline void CmdRequest_ServerStatus::set_term(int64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.ServerStatus.term)
 }
-inline void CmdRequest_AppendEntries::set_ip(const char* value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
+
+// required int64 commit_index = 2;
+inline bool CmdRequest_ServerStatus::_internal_has_commit_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void CmdRequest_AppendEntries::set_ip(const void* value, size_t size) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(reinterpret_cast<const char*>(value), size);
+inline bool CmdRequest_ServerStatus::has_commit_index() const {
+  return _internal_has_commit_index();
 }
-inline ::std::string* CmdRequest_AppendEntries::mutable_ip() {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  return ip_;
+inline void CmdRequest_ServerStatus::clear_commit_index() {
+  _impl_.commit_index_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::std::string* CmdRequest_AppendEntries::release_ip() {
-  clear_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = ip_;
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline int64_t CmdRequest_ServerStatus::_internal_commit_index() const {
+  return _impl_.commit_index_;
 }
-inline void CmdRequest_AppendEntries::set_allocated_ip(::std::string* ip) {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
-  }
-  if (ip) {
-    set_has_ip();
-    ip_ = ip;
+inline int64_t CmdRequest_ServerStatus::commit_index() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.ServerStatus.commit_index)
+  return _internal_commit_index();
+}
+inline void CmdRequest_ServerStatus::_internal_set_commit_index(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.commit_index_ = value;
+}
+inline void CmdRequest_ServerStatus::set_commit_index(int64_t value) {
+  _internal_set_commit_index(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.ServerStatus.commit_index)
+}
+
+// optional bytes ip = 3;
+inline bool CmdRequest_ServerStatus::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_ServerStatus::has_ip() const {
+  return _internal_has_ip();
+}
+inline void CmdRequest_ServerStatus::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_ServerStatus::ip() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.ServerStatus.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_ServerStatus::set_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.ServerStatus.ip)
+}
+inline std::string* CmdRequest_ServerStatus::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.ServerStatus.ip)
+  return _s;
+}
+inline const std::string& CmdRequest_ServerStatus::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void CmdRequest_ServerStatus::_internal_set_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_ServerStatus::_internal_mutable_ip() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_ServerStatus::release_ip() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.ServerStatus.ip)
+  if (!_internal_has_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_ServerStatus::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_ip();
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.ServerStatus.ip)
 }
 
-// required int32 port = 2;
-inline bool CmdRequest_AppendEntries::has_port() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional int32 port = 4;
+inline bool CmdRequest_ServerStatus::_internal_has_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CmdRequest_ServerStatus::has_port() const {
+  return _internal_has_port();
 }
-inline void CmdRequest_AppendEntries::set_has_port() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdRequest_ServerStatus::clear_port() {
+  _impl_.port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdRequest_AppendEntries::clear_has_port() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t CmdRequest_ServerStatus::_internal_port() const {
+  return _impl_.port_;
 }
-inline void CmdRequest_AppendEntries::clear_port() {
-  port_ = 0;
-  clear_has_port();
+inline int32_t CmdRequest_ServerStatus::port() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.ServerStatus.port)
+  return _internal_port();
 }
-inline ::google::protobuf::int32 CmdRequest_AppendEntries::port() const {
-  return port_;
+inline void CmdRequest_ServerStatus::_internal_set_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.port_ = value;
 }
-inline void CmdRequest_AppendEntries::set_port(::google::protobuf::int32 value) {
-  set_has_port();
-  port_ = value;
+inline void CmdRequest_ServerStatus::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.ServerStatus.port)
 }
 
-// required uint64 term = 3;
-inline bool CmdRequest_AppendEntries::has_term() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// CmdRequest_WriteBatch
+
+// repeated .floyd.Entry.Operation ops = 1;
+inline int CmdRequest_WriteBatch::_internal_ops_size() const {
+  return _impl_.ops_.size();
 }
-inline void CmdRequest_AppendEntries::set_has_term() {
-  _has_bits_[0] |= 0x00000004u;
+inline int CmdRequest_WriteBatch::ops_size() const {
+  return _internal_ops_size();
 }
-inline void CmdRequest_AppendEntries::clear_has_term() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest_WriteBatch::clear_ops() {
+  _impl_.ops_.Clear();
 }
-inline void CmdRequest_AppendEntries::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
-  clear_has_term();
+inline ::floyd::Entry_Operation* CmdRequest_WriteBatch::mutable_ops(int index) {
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.WriteBatch.ops)
+  return _impl_.ops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >*
+CmdRequest_WriteBatch::mutable_ops() {
+  // @@protoc_insertion_point(field_mutable_list:floyd.CmdRequest.WriteBatch.ops)
+  return &_impl_.ops_;
+}
+inline const ::floyd::Entry_Operation& CmdRequest_WriteBatch::_internal_ops(int index) const {
+  return _impl_.ops_.Get(index);
+}
+inline const ::floyd::Entry_Operation& CmdRequest_WriteBatch::ops(int index) const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.WriteBatch.ops)
+  return _internal_ops(index);
+}
+inline ::floyd::Entry_Operation* CmdRequest_WriteBatch::_internal_add_ops() {
+  return _impl_.ops_.Add();
 }
-inline ::google::protobuf::uint64 CmdRequest_AppendEntries::term() const {
-  return term_;
+inline ::floyd::Entry_Operation* CmdRequest_WriteBatch::add_ops() {
+  ::floyd::Entry_Operation* _add = _internal_add_ops();
+  // @@protoc_insertion_point(field_add:floyd.CmdRequest.WriteBatch.ops)
+  return _add;
 }
-inline void CmdRequest_AppendEntries::set_term(::google::protobuf::uint64 value) {
-  set_has_term();
-  term_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::Entry_Operation >&
+CmdRequest_WriteBatch::ops() const {
+  // @@protoc_insertion_point(field_list:floyd.CmdRequest.WriteBatch.ops)
+  return _impl_.ops_;
 }
 
-// required uint64 prev_log_index = 4;
-inline bool CmdRequest_AppendEntries::has_prev_log_index() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// -------------------------------------------------------------------
+
+// CmdRequest_InstallSnapshot
+
+// required uint64 term = 1;
+inline bool CmdRequest_InstallSnapshot::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void CmdRequest_AppendEntries::set_has_prev_log_index() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool CmdRequest_InstallSnapshot::has_term() const {
+  return _internal_has_term();
 }
-inline void CmdRequest_AppendEntries::clear_has_prev_log_index() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void CmdRequest_InstallSnapshot::clear_term() {
+  _impl_.term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdRequest_AppendEntries::clear_prev_log_index() {
-  prev_log_index_ = GOOGLE_ULONGLONG(0);
-  clear_has_prev_log_index();
+inline uint64_t CmdRequest_InstallSnapshot::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint64_t CmdRequest_InstallSnapshot::term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.InstallSnapshot.term)
+  return _internal_term();
 }
-inline ::google::protobuf::uint64 CmdRequest_AppendEntries::prev_log_index() const {
-  return prev_log_index_;
+inline void CmdRequest_InstallSnapshot::_internal_set_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.term_ = value;
 }
-inline void CmdRequest_AppendEntries::set_prev_log_index(::google::protobuf::uint64 value) {
-  set_has_prev_log_index();
-  prev_log_index_ = value;
+inline void CmdRequest_InstallSnapshot::set_term(uint64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.InstallSnapshot.term)
 }
 
-// required uint64 prev_log_term = 5;
-inline bool CmdRequest_AppendEntries::has_prev_log_term() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// required bytes ip = 2;
+inline bool CmdRequest_InstallSnapshot::_internal_has_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest_InstallSnapshot::has_ip() const {
+  return _internal_has_ip();
+}
+inline void CmdRequest_InstallSnapshot::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest_InstallSnapshot::ip() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.InstallSnapshot.ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_InstallSnapshot::set_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.InstallSnapshot.ip)
+}
+inline std::string* CmdRequest_InstallSnapshot::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.InstallSnapshot.ip)
+  return _s;
+}
+inline const std::string& CmdRequest_InstallSnapshot::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void CmdRequest_InstallSnapshot::_internal_set_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_InstallSnapshot::_internal_mutable_ip() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_InstallSnapshot::release_ip() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.InstallSnapshot.ip)
+  if (!_internal_has_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_InstallSnapshot::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.InstallSnapshot.ip)
+}
+
+// required int32 port = 3;
+inline bool CmdRequest_InstallSnapshot::_internal_has_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void CmdRequest_AppendEntries::set_has_prev_log_term() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool CmdRequest_InstallSnapshot::has_port() const {
+  return _internal_has_port();
 }
-inline void CmdRequest_AppendEntries::clear_has_prev_log_term() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void CmdRequest_InstallSnapshot::clear_port() {
+  _impl_.port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void CmdRequest_AppendEntries::clear_prev_log_term() {
-  prev_log_term_ = GOOGLE_ULONGLONG(0);
-  clear_has_prev_log_term();
+inline int32_t CmdRequest_InstallSnapshot::_internal_port() const {
+  return _impl_.port_;
 }
-inline ::google::protobuf::uint64 CmdRequest_AppendEntries::prev_log_term() const {
-  return prev_log_term_;
+inline int32_t CmdRequest_InstallSnapshot::port() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.InstallSnapshot.port)
+  return _internal_port();
 }
-inline void CmdRequest_AppendEntries::set_prev_log_term(::google::protobuf::uint64 value) {
-  set_has_prev_log_term();
-  prev_log_term_ = value;
+inline void CmdRequest_InstallSnapshot::_internal_set_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.port_ = value;
+}
+inline void CmdRequest_InstallSnapshot::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.InstallSnapshot.port)
 }
 
-// required uint64 leader_commit = 6;
-inline bool CmdRequest_AppendEntries::has_leader_commit() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// required uint64 last_included_index = 4;
+inline bool CmdRequest_InstallSnapshot::_internal_has_last_included_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void CmdRequest_AppendEntries::set_has_leader_commit() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool CmdRequest_InstallSnapshot::has_last_included_index() const {
+  return _internal_has_last_included_index();
 }
-inline void CmdRequest_AppendEntries::clear_has_leader_commit() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void CmdRequest_InstallSnapshot::clear_last_included_index() {
+  _impl_.last_included_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void CmdRequest_AppendEntries::clear_leader_commit() {
-  leader_commit_ = GOOGLE_ULONGLONG(0);
-  clear_has_leader_commit();
+inline uint64_t CmdRequest_InstallSnapshot::_internal_last_included_index() const {
+  return _impl_.last_included_index_;
 }
-inline ::google::protobuf::uint64 CmdRequest_AppendEntries::leader_commit() const {
-  return leader_commit_;
+inline uint64_t CmdRequest_InstallSnapshot::last_included_index() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.InstallSnapshot.last_included_index)
+  return _internal_last_included_index();
 }
-inline void CmdRequest_AppendEntries::set_leader_commit(::google::protobuf::uint64 value) {
-  set_has_leader_commit();
-  leader_commit_ = value;
+inline void CmdRequest_InstallSnapshot::_internal_set_last_included_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.last_included_index_ = value;
+}
+inline void CmdRequest_InstallSnapshot::set_last_included_index(uint64_t value) {
+  _internal_set_last_included_index(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.InstallSnapshot.last_included_index)
 }
 
-// repeated .floyd.Entry entries = 7;
-inline int CmdRequest_AppendEntries::entries_size() const {
-  return entries_.size();
+// required uint64 last_included_term = 5;
+inline bool CmdRequest_InstallSnapshot::_internal_has_last_included_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void CmdRequest_AppendEntries::clear_entries() {
-  entries_.Clear();
+inline bool CmdRequest_InstallSnapshot::has_last_included_term() const {
+  return _internal_has_last_included_term();
 }
-inline const ::floyd::Entry& CmdRequest_AppendEntries::entries(int index) const {
-  return entries_.Get(index);
+inline void CmdRequest_InstallSnapshot::clear_last_included_term() {
+  _impl_.last_included_term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline ::floyd::Entry* CmdRequest_AppendEntries::mutable_entries(int index) {
-  return entries_.Mutable(index);
+inline uint64_t CmdRequest_InstallSnapshot::_internal_last_included_term() const {
+  return _impl_.last_included_term_;
 }
-inline ::floyd::Entry* CmdRequest_AppendEntries::add_entries() {
-  return entries_.Add();
+inline uint64_t CmdRequest_InstallSnapshot::last_included_term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.InstallSnapshot.last_included_term)
+  return _internal_last_included_term();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::floyd::Entry >&
-CmdRequest_AppendEntries::entries() const {
-  return entries_;
+inline void CmdRequest_InstallSnapshot::_internal_set_last_included_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.last_included_term_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField< ::floyd::Entry >*
-CmdRequest_AppendEntries::mutable_entries() {
-  return &entries_;
+inline void CmdRequest_InstallSnapshot::set_last_included_term(uint64_t value) {
+  _internal_set_last_included_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.InstallSnapshot.last_included_term)
 }
 
-// -------------------------------------------------------------------
-
-// CmdRequest_ServerStatus
-
-// required int64 term = 1;
-inline bool CmdRequest_ServerStatus::has_term() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// required uint64 offset = 6;
+inline bool CmdRequest_InstallSnapshot::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void CmdRequest_ServerStatus::set_has_term() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest_InstallSnapshot::has_offset() const {
+  return _internal_has_offset();
 }
-inline void CmdRequest_ServerStatus::clear_has_term() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest_InstallSnapshot::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline void CmdRequest_ServerStatus::clear_term() {
-  term_ = GOOGLE_LONGLONG(0);
-  clear_has_term();
+inline uint64_t CmdRequest_InstallSnapshot::_internal_offset() const {
+  return _impl_.offset_;
 }
-inline ::google::protobuf::int64 CmdRequest_ServerStatus::term() const {
-  return term_;
+inline uint64_t CmdRequest_InstallSnapshot::offset() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.InstallSnapshot.offset)
+  return _internal_offset();
 }
-inline void CmdRequest_ServerStatus::set_term(::google::protobuf::int64 value) {
-  set_has_term();
-  term_ = value;
+inline void CmdRequest_InstallSnapshot::_internal_set_offset(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.offset_ = value;
+}
+inline void CmdRequest_InstallSnapshot::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.InstallSnapshot.offset)
 }
 
-// required int64 commit_index = 2;
-inline bool CmdRequest_ServerStatus::has_commit_index() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// required bool done = 7;
+inline bool CmdRequest_InstallSnapshot::_internal_has_done() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline void CmdRequest_ServerStatus::set_has_commit_index() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdRequest_InstallSnapshot::has_done() const {
+  return _internal_has_done();
 }
-inline void CmdRequest_ServerStatus::clear_has_commit_index() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void CmdRequest_InstallSnapshot::clear_done() {
+  _impl_.done_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline void CmdRequest_ServerStatus::clear_commit_index() {
-  commit_index_ = GOOGLE_LONGLONG(0);
-  clear_has_commit_index();
+inline bool CmdRequest_InstallSnapshot::_internal_done() const {
+  return _impl_.done_;
 }
-inline ::google::protobuf::int64 CmdRequest_ServerStatus::commit_index() const {
-  return commit_index_;
+inline bool CmdRequest_InstallSnapshot::done() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.InstallSnapshot.done)
+  return _internal_done();
 }
-inline void CmdRequest_ServerStatus::set_commit_index(::google::protobuf::int64 value) {
-  set_has_commit_index();
-  commit_index_ = value;
+inline void CmdRequest_InstallSnapshot::_internal_set_done(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.done_ = value;
+}
+inline void CmdRequest_InstallSnapshot::set_done(bool value) {
+  _internal_set_done(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.InstallSnapshot.done)
 }
 
-// optional bytes ip = 3;
-inline bool CmdRequest_ServerStatus::has_ip() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional bytes file_name = 9;
+inline bool CmdRequest_InstallSnapshot::_internal_has_file_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdRequest_ServerStatus::set_has_ip() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdRequest_InstallSnapshot::has_file_name() const {
+  return _internal_has_file_name();
 }
-inline void CmdRequest_ServerStatus::clear_has_ip() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void CmdRequest_InstallSnapshot::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdRequest_ServerStatus::clear_ip() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    ip_->clear();
-  }
-  clear_has_ip();
+inline const std::string& CmdRequest_InstallSnapshot::file_name() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.InstallSnapshot.file_name)
+  return _internal_file_name();
 }
-inline const ::std::string& CmdRequest_ServerStatus::ip() const {
-  return *ip_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_InstallSnapshot::set_file_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.file_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.InstallSnapshot.file_name)
 }
-inline void CmdRequest_ServerStatus::set_ip(const ::std::string& value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
+inline std::string* CmdRequest_InstallSnapshot::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.InstallSnapshot.file_name)
+  return _s;
 }
-inline void CmdRequest_ServerStatus::set_ip(const char* value) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(value);
+inline const std::string& CmdRequest_InstallSnapshot::_internal_file_name() const {
+  return _impl_.file_name_.Get();
 }
-inline void CmdRequest_ServerStatus::set_ip(const void* value, size_t size) {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  ip_->assign(reinterpret_cast<const char*>(value), size);
+inline void CmdRequest_InstallSnapshot::_internal_set_file_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* CmdRequest_ServerStatus::mutable_ip() {
-  set_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    ip_ = new ::std::string;
-  }
-  return ip_;
+inline std::string* CmdRequest_InstallSnapshot::_internal_mutable_file_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* CmdRequest_ServerStatus::release_ip() {
-  clear_has_ip();
-  if (ip_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = ip_;
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+inline std::string* CmdRequest_InstallSnapshot::release_file_name() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.InstallSnapshot.file_name)
+  if (!_internal_has_file_name()) {
+    return nullptr;
   }
-}
-inline void CmdRequest_ServerStatus::set_allocated_ip(::std::string* ip) {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.file_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
   }
-  if (ip) {
-    set_has_ip();
-    ip_ = ip;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_InstallSnapshot::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_ip();
-    ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.InstallSnapshot.file_name)
 }
 
-// optional int32 port = 4;
-inline bool CmdRequest_ServerStatus::has_port() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional bytes data = 10;
+inline bool CmdRequest_InstallSnapshot::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void CmdRequest_ServerStatus::set_has_port() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool CmdRequest_InstallSnapshot::has_data() const {
+  return _internal_has_data();
 }
-inline void CmdRequest_ServerStatus::clear_has_port() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void CmdRequest_InstallSnapshot::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void CmdRequest_ServerStatus::clear_port() {
-  port_ = 0;
-  clear_has_port();
+inline const std::string& CmdRequest_InstallSnapshot::data() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.InstallSnapshot.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest_InstallSnapshot::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.InstallSnapshot.data)
+}
+inline std::string* CmdRequest_InstallSnapshot::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.InstallSnapshot.data)
+  return _s;
 }
-inline ::google::protobuf::int32 CmdRequest_ServerStatus::port() const {
-  return port_;
+inline const std::string& CmdRequest_InstallSnapshot::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline void CmdRequest_ServerStatus::set_port(::google::protobuf::int32 value) {
-  set_has_port();
-  port_ = value;
+inline void CmdRequest_InstallSnapshot::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdRequest_InstallSnapshot::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest_InstallSnapshot::release_data() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.InstallSnapshot.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdRequest_InstallSnapshot::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.InstallSnapshot.data)
 }
 
 // -------------------------------------------------------------------
@@ -2674,290 +6665,842 @@ inline void CmdRequest_ServerStatus::set_port(::google::protobuf::int32 value) {
 // CmdRequest
 
 // required .floyd.Type type = 1;
-inline bool CmdRequest::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void CmdRequest::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void CmdRequest::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool CmdRequest::has_type() const {
+  return _internal_has_type();
 }
 inline void CmdRequest::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline ::floyd::Type CmdRequest::_internal_type() const {
+  return static_cast< ::floyd::Type >(_impl_.type_);
 }
 inline ::floyd::Type CmdRequest::type() const {
-  return static_cast< ::floyd::Type >(type_);
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.type)
+  return _internal_type();
 }
-inline void CmdRequest::set_type(::floyd::Type value) {
+inline void CmdRequest::_internal_set_type(::floyd::Type value) {
   assert(::floyd::Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.type_ = value;
+}
+inline void CmdRequest::set_type(::floyd::Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.type)
 }
 
 // optional .floyd.CmdRequest.Kv kv = 2;
-inline bool CmdRequest::has_kv() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool CmdRequest::_internal_has_kv() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.kv_ != nullptr);
+  return value;
 }
-inline void CmdRequest::set_has_kv() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void CmdRequest::clear_has_kv() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CmdRequest::has_kv() const {
+  return _internal_has_kv();
 }
 inline void CmdRequest::clear_kv() {
-  if (kv_ != NULL) kv_->::floyd::CmdRequest_Kv::Clear();
-  clear_has_kv();
+  if (_impl_.kv_ != nullptr) _impl_.kv_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::floyd::CmdRequest_Kv& CmdRequest::_internal_kv() const {
+  const ::floyd::CmdRequest_Kv* p = _impl_.kv_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdRequest_Kv&>(
+      ::floyd::_CmdRequest_Kv_default_instance_);
 }
 inline const ::floyd::CmdRequest_Kv& CmdRequest::kv() const {
-  return kv_ != NULL ? *kv_ : *default_instance_->kv_;
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.kv)
+  return _internal_kv();
 }
-inline ::floyd::CmdRequest_Kv* CmdRequest::mutable_kv() {
-  set_has_kv();
-  if (kv_ == NULL) kv_ = new ::floyd::CmdRequest_Kv;
-  return kv_;
+inline void CmdRequest::unsafe_arena_set_allocated_kv(
+    ::floyd::CmdRequest_Kv* kv) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.kv_);
+  }
+  _impl_.kv_ = kv;
+  if (kv) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdRequest.kv)
 }
 inline ::floyd::CmdRequest_Kv* CmdRequest::release_kv() {
-  clear_has_kv();
-  ::floyd::CmdRequest_Kv* temp = kv_;
-  kv_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::floyd::CmdRequest_Kv* temp = _impl_.kv_;
+  _impl_.kv_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::floyd::CmdRequest_Kv* CmdRequest::unsafe_arena_release_kv() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.kv)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::floyd::CmdRequest_Kv* temp = _impl_.kv_;
+  _impl_.kv_ = nullptr;
+  return temp;
+}
+inline ::floyd::CmdRequest_Kv* CmdRequest::_internal_mutable_kv() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.kv_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdRequest_Kv>(GetArenaForAllocation());
+    _impl_.kv_ = p;
+  }
+  return _impl_.kv_;
+}
+inline ::floyd::CmdRequest_Kv* CmdRequest::mutable_kv() {
+  ::floyd::CmdRequest_Kv* _msg = _internal_mutable_kv();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.kv)
+  return _msg;
+}
 inline void CmdRequest::set_allocated_kv(::floyd::CmdRequest_Kv* kv) {
-  delete kv_;
-  kv_ = kv;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.kv_;
+  }
   if (kv) {
-    set_has_kv();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(kv);
+    if (message_arena != submessage_arena) {
+      kv = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, kv, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_kv();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.kv_ = kv;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.kv)
 }
 
 // optional .floyd.CmdRequest.User user = 3;
-inline bool CmdRequest::has_user() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool CmdRequest::_internal_has_user() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.user_ != nullptr);
+  return value;
 }
-inline void CmdRequest::set_has_user() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void CmdRequest::clear_has_user() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool CmdRequest::has_user() const {
+  return _internal_has_user();
 }
 inline void CmdRequest::clear_user() {
-  if (user_ != NULL) user_->::floyd::CmdRequest_User::Clear();
-  clear_has_user();
+  if (_impl_.user_ != nullptr) _impl_.user_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::floyd::CmdRequest_User& CmdRequest::_internal_user() const {
+  const ::floyd::CmdRequest_User* p = _impl_.user_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdRequest_User&>(
+      ::floyd::_CmdRequest_User_default_instance_);
 }
 inline const ::floyd::CmdRequest_User& CmdRequest::user() const {
-  return user_ != NULL ? *user_ : *default_instance_->user_;
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.user)
+  return _internal_user();
 }
-inline ::floyd::CmdRequest_User* CmdRequest::mutable_user() {
-  set_has_user();
-  if (user_ == NULL) user_ = new ::floyd::CmdRequest_User;
-  return user_;
+inline void CmdRequest::unsafe_arena_set_allocated_user(
+    ::floyd::CmdRequest_User* user) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.user_);
+  }
+  _impl_.user_ = user;
+  if (user) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdRequest.user)
 }
 inline ::floyd::CmdRequest_User* CmdRequest::release_user() {
-  clear_has_user();
-  ::floyd::CmdRequest_User* temp = user_;
-  user_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::floyd::CmdRequest_User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::floyd::CmdRequest_User* CmdRequest::unsafe_arena_release_user() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.user)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::floyd::CmdRequest_User* temp = _impl_.user_;
+  _impl_.user_ = nullptr;
+  return temp;
+}
+inline ::floyd::CmdRequest_User* CmdRequest::_internal_mutable_user() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.user_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdRequest_User>(GetArenaForAllocation());
+    _impl_.user_ = p;
+  }
+  return _impl_.user_;
+}
+inline ::floyd::CmdRequest_User* CmdRequest::mutable_user() {
+  ::floyd::CmdRequest_User* _msg = _internal_mutable_user();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.user)
+  return _msg;
+}
 inline void CmdRequest::set_allocated_user(::floyd::CmdRequest_User* user) {
-  delete user_;
-  user_ = user;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.user_;
+  }
   if (user) {
-    set_has_user();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user);
+    if (message_arena != submessage_arena) {
+      user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_user();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.user_ = user;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.user)
 }
 
 // optional .floyd.CmdRequest.RequestVote request_vote = 4;
-inline bool CmdRequest::has_request_vote() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool CmdRequest::_internal_has_request_vote() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_vote_ != nullptr);
+  return value;
 }
-inline void CmdRequest::set_has_request_vote() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void CmdRequest::clear_has_request_vote() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool CmdRequest::has_request_vote() const {
+  return _internal_has_request_vote();
 }
 inline void CmdRequest::clear_request_vote() {
-  if (request_vote_ != NULL) request_vote_->::floyd::CmdRequest_RequestVote::Clear();
-  clear_has_request_vote();
+  if (_impl_.request_vote_ != nullptr) _impl_.request_vote_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::floyd::CmdRequest_RequestVote& CmdRequest::_internal_request_vote() const {
+  const ::floyd::CmdRequest_RequestVote* p = _impl_.request_vote_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdRequest_RequestVote&>(
+      ::floyd::_CmdRequest_RequestVote_default_instance_);
 }
 inline const ::floyd::CmdRequest_RequestVote& CmdRequest::request_vote() const {
-  return request_vote_ != NULL ? *request_vote_ : *default_instance_->request_vote_;
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.request_vote)
+  return _internal_request_vote();
 }
-inline ::floyd::CmdRequest_RequestVote* CmdRequest::mutable_request_vote() {
-  set_has_request_vote();
-  if (request_vote_ == NULL) request_vote_ = new ::floyd::CmdRequest_RequestVote;
-  return request_vote_;
+inline void CmdRequest::unsafe_arena_set_allocated_request_vote(
+    ::floyd::CmdRequest_RequestVote* request_vote) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_vote_);
+  }
+  _impl_.request_vote_ = request_vote;
+  if (request_vote) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdRequest.request_vote)
 }
 inline ::floyd::CmdRequest_RequestVote* CmdRequest::release_request_vote() {
-  clear_has_request_vote();
-  ::floyd::CmdRequest_RequestVote* temp = request_vote_;
-  request_vote_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::floyd::CmdRequest_RequestVote* temp = _impl_.request_vote_;
+  _impl_.request_vote_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::floyd::CmdRequest_RequestVote* CmdRequest::unsafe_arena_release_request_vote() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.request_vote)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::floyd::CmdRequest_RequestVote* temp = _impl_.request_vote_;
+  _impl_.request_vote_ = nullptr;
+  return temp;
+}
+inline ::floyd::CmdRequest_RequestVote* CmdRequest::_internal_mutable_request_vote() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.request_vote_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdRequest_RequestVote>(GetArenaForAllocation());
+    _impl_.request_vote_ = p;
+  }
+  return _impl_.request_vote_;
+}
+inline ::floyd::CmdRequest_RequestVote* CmdRequest::mutable_request_vote() {
+  ::floyd::CmdRequest_RequestVote* _msg = _internal_mutable_request_vote();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.request_vote)
+  return _msg;
+}
 inline void CmdRequest::set_allocated_request_vote(::floyd::CmdRequest_RequestVote* request_vote) {
-  delete request_vote_;
-  request_vote_ = request_vote;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_vote_;
+  }
   if (request_vote) {
-    set_has_request_vote();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request_vote);
+    if (message_arena != submessage_arena) {
+      request_vote = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request_vote, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_request_vote();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.request_vote_ = request_vote;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.request_vote)
 }
 
 // optional .floyd.CmdRequest.AppendEntries append_entries = 5;
-inline bool CmdRequest::has_append_entries() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool CmdRequest::_internal_has_append_entries() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.append_entries_ != nullptr);
+  return value;
 }
-inline void CmdRequest::set_has_append_entries() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void CmdRequest::clear_has_append_entries() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool CmdRequest::has_append_entries() const {
+  return _internal_has_append_entries();
 }
 inline void CmdRequest::clear_append_entries() {
-  if (append_entries_ != NULL) append_entries_->::floyd::CmdRequest_AppendEntries::Clear();
-  clear_has_append_entries();
+  if (_impl_.append_entries_ != nullptr) _impl_.append_entries_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::floyd::CmdRequest_AppendEntries& CmdRequest::_internal_append_entries() const {
+  const ::floyd::CmdRequest_AppendEntries* p = _impl_.append_entries_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdRequest_AppendEntries&>(
+      ::floyd::_CmdRequest_AppendEntries_default_instance_);
 }
 inline const ::floyd::CmdRequest_AppendEntries& CmdRequest::append_entries() const {
-  return append_entries_ != NULL ? *append_entries_ : *default_instance_->append_entries_;
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.append_entries)
+  return _internal_append_entries();
 }
-inline ::floyd::CmdRequest_AppendEntries* CmdRequest::mutable_append_entries() {
-  set_has_append_entries();
-  if (append_entries_ == NULL) append_entries_ = new ::floyd::CmdRequest_AppendEntries;
-  return append_entries_;
+inline void CmdRequest::unsafe_arena_set_allocated_append_entries(
+    ::floyd::CmdRequest_AppendEntries* append_entries) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.append_entries_);
+  }
+  _impl_.append_entries_ = append_entries;
+  if (append_entries) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdRequest.append_entries)
 }
 inline ::floyd::CmdRequest_AppendEntries* CmdRequest::release_append_entries() {
-  clear_has_append_entries();
-  ::floyd::CmdRequest_AppendEntries* temp = append_entries_;
-  append_entries_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::floyd::CmdRequest_AppendEntries* temp = _impl_.append_entries_;
+  _impl_.append_entries_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::floyd::CmdRequest_AppendEntries* CmdRequest::unsafe_arena_release_append_entries() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.append_entries)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::floyd::CmdRequest_AppendEntries* temp = _impl_.append_entries_;
+  _impl_.append_entries_ = nullptr;
+  return temp;
+}
+inline ::floyd::CmdRequest_AppendEntries* CmdRequest::_internal_mutable_append_entries() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.append_entries_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdRequest_AppendEntries>(GetArenaForAllocation());
+    _impl_.append_entries_ = p;
+  }
+  return _impl_.append_entries_;
+}
+inline ::floyd::CmdRequest_AppendEntries* CmdRequest::mutable_append_entries() {
+  ::floyd::CmdRequest_AppendEntries* _msg = _internal_mutable_append_entries();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.append_entries)
+  return _msg;
+}
 inline void CmdRequest::set_allocated_append_entries(::floyd::CmdRequest_AppendEntries* append_entries) {
-  delete append_entries_;
-  append_entries_ = append_entries;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.append_entries_;
+  }
   if (append_entries) {
-    set_has_append_entries();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(append_entries);
+    if (message_arena != submessage_arena) {
+      append_entries = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, append_entries, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    clear_has_append_entries();
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
+  _impl_.append_entries_ = append_entries;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.append_entries)
 }
 
 // optional .floyd.CmdRequest.ServerStatus server_status = 6;
-inline bool CmdRequest::has_server_status() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool CmdRequest::_internal_has_server_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.server_status_ != nullptr);
+  return value;
 }
-inline void CmdRequest::set_has_server_status() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void CmdRequest::clear_has_server_status() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool CmdRequest::has_server_status() const {
+  return _internal_has_server_status();
 }
 inline void CmdRequest::clear_server_status() {
-  if (server_status_ != NULL) server_status_->::floyd::CmdRequest_ServerStatus::Clear();
-  clear_has_server_status();
+  if (_impl_.server_status_ != nullptr) _impl_.server_status_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::floyd::CmdRequest_ServerStatus& CmdRequest::_internal_server_status() const {
+  const ::floyd::CmdRequest_ServerStatus* p = _impl_.server_status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdRequest_ServerStatus&>(
+      ::floyd::_CmdRequest_ServerStatus_default_instance_);
 }
 inline const ::floyd::CmdRequest_ServerStatus& CmdRequest::server_status() const {
-  return server_status_ != NULL ? *server_status_ : *default_instance_->server_status_;
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.server_status)
+  return _internal_server_status();
 }
-inline ::floyd::CmdRequest_ServerStatus* CmdRequest::mutable_server_status() {
-  set_has_server_status();
-  if (server_status_ == NULL) server_status_ = new ::floyd::CmdRequest_ServerStatus;
-  return server_status_;
+inline void CmdRequest::unsafe_arena_set_allocated_server_status(
+    ::floyd::CmdRequest_ServerStatus* server_status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.server_status_);
+  }
+  _impl_.server_status_ = server_status;
+  if (server_status) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdRequest.server_status)
 }
 inline ::floyd::CmdRequest_ServerStatus* CmdRequest::release_server_status() {
-  clear_has_server_status();
-  ::floyd::CmdRequest_ServerStatus* temp = server_status_;
-  server_status_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::floyd::CmdRequest_ServerStatus* temp = _impl_.server_status_;
+  _impl_.server_status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::floyd::CmdRequest_ServerStatus* CmdRequest::unsafe_arena_release_server_status() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.server_status)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::floyd::CmdRequest_ServerStatus* temp = _impl_.server_status_;
+  _impl_.server_status_ = nullptr;
+  return temp;
+}
+inline ::floyd::CmdRequest_ServerStatus* CmdRequest::_internal_mutable_server_status() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.server_status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdRequest_ServerStatus>(GetArenaForAllocation());
+    _impl_.server_status_ = p;
+  }
+  return _impl_.server_status_;
+}
+inline ::floyd::CmdRequest_ServerStatus* CmdRequest::mutable_server_status() {
+  ::floyd::CmdRequest_ServerStatus* _msg = _internal_mutable_server_status();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.server_status)
+  return _msg;
+}
 inline void CmdRequest::set_allocated_server_status(::floyd::CmdRequest_ServerStatus* server_status) {
-  delete server_status_;
-  server_status_ = server_status;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.server_status_;
+  }
   if (server_status) {
-    set_has_server_status();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(server_status);
+    if (message_arena != submessage_arena) {
+      server_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, server_status, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    clear_has_server_status();
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
+  _impl_.server_status_ = server_status;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.server_status)
 }
 
-// -------------------------------------------------------------------
-
-// CmdResponse_Kv
-
-// optional bytes value = 1;
-inline bool CmdResponse_Kv::has_value() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .floyd.CmdRequest.WriteBatch write_batch = 7;
+inline bool CmdRequest::_internal_has_write_batch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.write_batch_ != nullptr);
+  return value;
 }
-inline void CmdResponse_Kv::set_has_value() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdRequest::has_write_batch() const {
+  return _internal_has_write_batch();
 }
-inline void CmdResponse_Kv::clear_has_value() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void CmdRequest::clear_write_batch() {
+  if (_impl_.write_batch_ != nullptr) _impl_.write_batch_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void CmdResponse_Kv::clear_value() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    value_->clear();
+inline const ::floyd::CmdRequest_WriteBatch& CmdRequest::_internal_write_batch() const {
+  const ::floyd::CmdRequest_WriteBatch* p = _impl_.write_batch_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdRequest_WriteBatch&>(
+      ::floyd::_CmdRequest_WriteBatch_default_instance_);
+}
+inline const ::floyd::CmdRequest_WriteBatch& CmdRequest::write_batch() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.write_batch)
+  return _internal_write_batch();
+}
+inline void CmdRequest::unsafe_arena_set_allocated_write_batch(
+    ::floyd::CmdRequest_WriteBatch* write_batch) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.write_batch_);
   }
-  clear_has_value();
+  _impl_.write_batch_ = write_batch;
+  if (write_batch) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdRequest.write_batch)
+}
+inline ::floyd::CmdRequest_WriteBatch* CmdRequest::release_write_batch() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::floyd::CmdRequest_WriteBatch* temp = _impl_.write_batch_;
+  _impl_.write_batch_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline const ::std::string& CmdResponse_Kv::value() const {
-  return *value_;
+inline ::floyd::CmdRequest_WriteBatch* CmdRequest::unsafe_arena_release_write_batch() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.write_batch)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::floyd::CmdRequest_WriteBatch* temp = _impl_.write_batch_;
+  _impl_.write_batch_ = nullptr;
+  return temp;
 }
-inline void CmdResponse_Kv::set_value(const ::std::string& value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+inline ::floyd::CmdRequest_WriteBatch* CmdRequest::_internal_mutable_write_batch() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.write_batch_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdRequest_WriteBatch>(GetArenaForAllocation());
+    _impl_.write_batch_ = p;
+  }
+  return _impl_.write_batch_;
+}
+inline ::floyd::CmdRequest_WriteBatch* CmdRequest::mutable_write_batch() {
+  ::floyd::CmdRequest_WriteBatch* _msg = _internal_mutable_write_batch();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.write_batch)
+  return _msg;
+}
+inline void CmdRequest::set_allocated_write_batch(::floyd::CmdRequest_WriteBatch* write_batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.write_batch_;
+  }
+  if (write_batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(write_batch);
+    if (message_arena != submessage_arena) {
+      write_batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, write_batch, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
-  value_->assign(value);
+  _impl_.write_batch_ = write_batch;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.write_batch)
+}
+
+// optional .floyd.CmdRequest.InstallSnapshot install_snapshot = 8;
+inline bool CmdRequest::_internal_has_install_snapshot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.install_snapshot_ != nullptr);
+  return value;
+}
+inline bool CmdRequest::has_install_snapshot() const {
+  return _internal_has_install_snapshot();
+}
+inline void CmdRequest::clear_install_snapshot() {
+  if (_impl_.install_snapshot_ != nullptr) _impl_.install_snapshot_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline void CmdResponse_Kv::set_value(const char* value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+inline const ::floyd::CmdRequest_InstallSnapshot& CmdRequest::_internal_install_snapshot() const {
+  const ::floyd::CmdRequest_InstallSnapshot* p = _impl_.install_snapshot_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdRequest_InstallSnapshot&>(
+      ::floyd::_CmdRequest_InstallSnapshot_default_instance_);
+}
+inline const ::floyd::CmdRequest_InstallSnapshot& CmdRequest::install_snapshot() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.install_snapshot)
+  return _internal_install_snapshot();
+}
+inline void CmdRequest::unsafe_arena_set_allocated_install_snapshot(
+    ::floyd::CmdRequest_InstallSnapshot* install_snapshot) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.install_snapshot_);
   }
-  value_->assign(value);
+  _impl_.install_snapshot_ = install_snapshot;
+  if (install_snapshot) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdRequest.install_snapshot)
+}
+inline ::floyd::CmdRequest_InstallSnapshot* CmdRequest::release_install_snapshot() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::floyd::CmdRequest_InstallSnapshot* temp = _impl_.install_snapshot_;
+  _impl_.install_snapshot_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CmdResponse_Kv::set_value(const void* value, size_t size) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+inline ::floyd::CmdRequest_InstallSnapshot* CmdRequest::unsafe_arena_release_install_snapshot() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.install_snapshot)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::floyd::CmdRequest_InstallSnapshot* temp = _impl_.install_snapshot_;
+  _impl_.install_snapshot_ = nullptr;
+  return temp;
+}
+inline ::floyd::CmdRequest_InstallSnapshot* CmdRequest::_internal_mutable_install_snapshot() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.install_snapshot_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdRequest_InstallSnapshot>(GetArenaForAllocation());
+    _impl_.install_snapshot_ = p;
+  }
+  return _impl_.install_snapshot_;
+}
+inline ::floyd::CmdRequest_InstallSnapshot* CmdRequest::mutable_install_snapshot() {
+  ::floyd::CmdRequest_InstallSnapshot* _msg = _internal_mutable_install_snapshot();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.install_snapshot)
+  return _msg;
+}
+inline void CmdRequest::set_allocated_install_snapshot(::floyd::CmdRequest_InstallSnapshot* install_snapshot) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.install_snapshot_;
+  }
+  if (install_snapshot) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(install_snapshot);
+    if (message_arena != submessage_arena) {
+      install_snapshot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, install_snapshot, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
-  value_->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.install_snapshot_ = install_snapshot;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.install_snapshot)
+}
+
+// optional bytes command = 9;
+inline bool CmdRequest::_internal_has_command() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdRequest::has_command() const {
+  return _internal_has_command();
+}
+inline void CmdRequest::clear_command() {
+  _impl_.command_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdRequest::command() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.command)
+  return _internal_command();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdRequest::set_command(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.command_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdRequest.command)
+}
+inline std::string* CmdRequest::mutable_command() {
+  std::string* _s = _internal_mutable_command();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.command)
+  return _s;
+}
+inline const std::string& CmdRequest::_internal_command() const {
+  return _impl_.command_.Get();
+}
+inline void CmdRequest::_internal_set_command(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.command_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* CmdResponse_Kv::mutable_value() {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+inline std::string* CmdRequest::_internal_mutable_command() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.command_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdRequest::release_command() {
+  // @@protoc_insertion_point(field_release:floyd.CmdRequest.command)
+  if (!_internal_has_command()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.command_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
   }
-  return value_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* CmdResponse_Kv::release_value() {
-  clear_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void CmdRequest::set_allocated_command(std::string* command) {
+  if (command != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = value_;
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void CmdResponse_Kv::set_allocated_value(::std::string* value) {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
   }
-  if (value) {
-    set_has_value();
-    value_ = value;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdRequest.command)
+}
+
+// repeated .floyd.CmdRequest forward_cmds = 10;
+inline int CmdRequest::_internal_forward_cmds_size() const {
+  return _impl_.forward_cmds_.size();
+}
+inline int CmdRequest::forward_cmds_size() const {
+  return _internal_forward_cmds_size();
+}
+inline void CmdRequest::clear_forward_cmds() {
+  _impl_.forward_cmds_.Clear();
+}
+inline ::floyd::CmdRequest* CmdRequest::mutable_forward_cmds(int index) {
+  // @@protoc_insertion_point(field_mutable:floyd.CmdRequest.forward_cmds)
+  return _impl_.forward_cmds_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdRequest >*
+CmdRequest::mutable_forward_cmds() {
+  // @@protoc_insertion_point(field_mutable_list:floyd.CmdRequest.forward_cmds)
+  return &_impl_.forward_cmds_;
+}
+inline const ::floyd::CmdRequest& CmdRequest::_internal_forward_cmds(int index) const {
+  return _impl_.forward_cmds_.Get(index);
+}
+inline const ::floyd::CmdRequest& CmdRequest::forward_cmds(int index) const {
+  // @@protoc_insertion_point(field_get:floyd.CmdRequest.forward_cmds)
+  return _internal_forward_cmds(index);
+}
+inline ::floyd::CmdRequest* CmdRequest::_internal_add_forward_cmds() {
+  return _impl_.forward_cmds_.Add();
+}
+inline ::floyd::CmdRequest* CmdRequest::add_forward_cmds() {
+  ::floyd::CmdRequest* _add = _internal_add_forward_cmds();
+  // @@protoc_insertion_point(field_add:floyd.CmdRequest.forward_cmds)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdRequest >&
+CmdRequest::forward_cmds() const {
+  // @@protoc_insertion_point(field_list:floyd.CmdRequest.forward_cmds)
+  return _impl_.forward_cmds_;
+}
+
+// -------------------------------------------------------------------
+
+// CmdResponse_Kv
+
+// optional bytes value = 1;
+inline bool CmdResponse_Kv::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdResponse_Kv::has_value() const {
+  return _internal_has_value();
+}
+inline void CmdResponse_Kv::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_Kv::value() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.Kv.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_Kv::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.Kv.value)
+}
+inline std::string* CmdResponse_Kv::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.Kv.value)
+  return _s;
+}
+inline const std::string& CmdResponse_Kv::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void CmdResponse_Kv::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Kv::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_Kv::release_value() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.Kv.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_Kv::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_value();
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.Kv.value)
 }
 
 // -------------------------------------------------------------------
@@ -2965,28 +7508,43 @@ inline void CmdResponse_Kv::set_allocated_value(::std::string* value) {
 // CmdResponse_Kvs
 
 // repeated .floyd.CmdResponse.Kv kv = 1;
+inline int CmdResponse_Kvs::_internal_kv_size() const {
+  return _impl_.kv_.size();
+}
 inline int CmdResponse_Kvs::kv_size() const {
-  return kv_.size();
+  return _internal_kv_size();
 }
 inline void CmdResponse_Kvs::clear_kv() {
-  kv_.Clear();
+  _impl_.kv_.Clear();
+}
+inline ::floyd::CmdResponse_Kv* CmdResponse_Kvs::mutable_kv(int index) {
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.Kvs.kv)
+  return _impl_.kv_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse_Kv >*
+CmdResponse_Kvs::mutable_kv() {
+  // @@protoc_insertion_point(field_mutable_list:floyd.CmdResponse.Kvs.kv)
+  return &_impl_.kv_;
+}
+inline const ::floyd::CmdResponse_Kv& CmdResponse_Kvs::_internal_kv(int index) const {
+  return _impl_.kv_.Get(index);
 }
 inline const ::floyd::CmdResponse_Kv& CmdResponse_Kvs::kv(int index) const {
-  return kv_.Get(index);
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.Kvs.kv)
+  return _internal_kv(index);
 }
-inline ::floyd::CmdResponse_Kv* CmdResponse_Kvs::mutable_kv(int index) {
-  return kv_.Mutable(index);
+inline ::floyd::CmdResponse_Kv* CmdResponse_Kvs::_internal_add_kv() {
+  return _impl_.kv_.Add();
 }
 inline ::floyd::CmdResponse_Kv* CmdResponse_Kvs::add_kv() {
-  return kv_.Add();
+  ::floyd::CmdResponse_Kv* _add = _internal_add_kv();
+  // @@protoc_insertion_point(field_add:floyd.CmdResponse.Kvs.kv)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::floyd::CmdResponse_Kv >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse_Kv >&
 CmdResponse_Kvs::kv() const {
-  return kv_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::floyd::CmdResponse_Kv >*
-CmdResponse_Kvs::mutable_kv() {
-  return &kv_;
+  // @@protoc_insertion_point(field_list:floyd.CmdResponse.Kvs.kv)
+  return _impl_.kv_;
 }
 
 // -------------------------------------------------------------------
@@ -2994,47 +7552,59 @@ CmdResponse_Kvs::mutable_kv() {
 // CmdResponse_RequestVoteResponse
 
 // required uint64 term = 1;
+inline bool CmdResponse_RequestVoteResponse::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool CmdResponse_RequestVoteResponse::has_term() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_term();
 }
-inline void CmdResponse_RequestVoteResponse::set_has_term() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdResponse_RequestVoteResponse::clear_term() {
+  _impl_.term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdResponse_RequestVoteResponse::clear_has_term() {
-  _has_bits_[0] &= ~0x00000001u;
+inline uint64_t CmdResponse_RequestVoteResponse::_internal_term() const {
+  return _impl_.term_;
 }
-inline void CmdResponse_RequestVoteResponse::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
-  clear_has_term();
+inline uint64_t CmdResponse_RequestVoteResponse::term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.RequestVoteResponse.term)
+  return _internal_term();
 }
-inline ::google::protobuf::uint64 CmdResponse_RequestVoteResponse::term() const {
-  return term_;
+inline void CmdResponse_RequestVoteResponse::_internal_set_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.term_ = value;
 }
-inline void CmdResponse_RequestVoteResponse::set_term(::google::protobuf::uint64 value) {
-  set_has_term();
-  term_ = value;
+inline void CmdResponse_RequestVoteResponse::set_term(uint64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.RequestVoteResponse.term)
 }
 
 // required bool vote_granted = 2;
-inline bool CmdResponse_RequestVoteResponse::has_vote_granted() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CmdResponse_RequestVoteResponse::set_has_vote_granted() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdResponse_RequestVoteResponse::_internal_has_vote_granted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdResponse_RequestVoteResponse::clear_has_vote_granted() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CmdResponse_RequestVoteResponse::has_vote_granted() const {
+  return _internal_has_vote_granted();
 }
 inline void CmdResponse_RequestVoteResponse::clear_vote_granted() {
-  vote_granted_ = false;
-  clear_has_vote_granted();
+  _impl_.vote_granted_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool CmdResponse_RequestVoteResponse::_internal_vote_granted() const {
+  return _impl_.vote_granted_;
 }
 inline bool CmdResponse_RequestVoteResponse::vote_granted() const {
-  return vote_granted_;
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.RequestVoteResponse.vote_granted)
+  return _internal_vote_granted();
+}
+inline void CmdResponse_RequestVoteResponse::_internal_set_vote_granted(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.vote_granted_ = value;
 }
 inline void CmdResponse_RequestVoteResponse::set_vote_granted(bool value) {
-  set_has_vote_granted();
-  vote_granted_ = value;
+  _internal_set_vote_granted(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.RequestVoteResponse.vote_granted)
 }
 
 // -------------------------------------------------------------------
@@ -3042,69 +7612,87 @@ inline void CmdResponse_RequestVoteResponse::set_vote_granted(bool value) {
 // CmdResponse_AppendEntriesResponse
 
 // required uint64 term = 1;
+inline bool CmdResponse_AppendEntriesResponse::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool CmdResponse_AppendEntriesResponse::has_term() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_term();
 }
-inline void CmdResponse_AppendEntriesResponse::set_has_term() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdResponse_AppendEntriesResponse::clear_term() {
+  _impl_.term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void CmdResponse_AppendEntriesResponse::clear_has_term() {
-  _has_bits_[0] &= ~0x00000001u;
+inline uint64_t CmdResponse_AppendEntriesResponse::_internal_term() const {
+  return _impl_.term_;
 }
-inline void CmdResponse_AppendEntriesResponse::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
-  clear_has_term();
+inline uint64_t CmdResponse_AppendEntriesResponse::term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.AppendEntriesResponse.term)
+  return _internal_term();
 }
-inline ::google::protobuf::uint64 CmdResponse_AppendEntriesResponse::term() const {
-  return term_;
+inline void CmdResponse_AppendEntriesResponse::_internal_set_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.term_ = value;
 }
-inline void CmdResponse_AppendEntriesResponse::set_term(::google::protobuf::uint64 value) {
-  set_has_term();
-  term_ = value;
+inline void CmdResponse_AppendEntriesResponse::set_term(uint64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.AppendEntriesResponse.term)
 }
 
 // required bool success = 2;
-inline bool CmdResponse_AppendEntriesResponse::has_success() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void CmdResponse_AppendEntriesResponse::set_has_success() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool CmdResponse_AppendEntriesResponse::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void CmdResponse_AppendEntriesResponse::clear_has_success() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CmdResponse_AppendEntriesResponse::has_success() const {
+  return _internal_has_success();
 }
 inline void CmdResponse_AppendEntriesResponse::clear_success() {
-  success_ = false;
-  clear_has_success();
+  _impl_.success_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool CmdResponse_AppendEntriesResponse::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool CmdResponse_AppendEntriesResponse::success() const {
-  return success_;
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.AppendEntriesResponse.success)
+  return _internal_success();
+}
+inline void CmdResponse_AppendEntriesResponse::_internal_set_success(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.success_ = value;
 }
 inline void CmdResponse_AppendEntriesResponse::set_success(bool value) {
-  set_has_success();
-  success_ = value;
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.AppendEntriesResponse.success)
 }
 
 // optional uint64 last_log_index = 3;
+inline bool CmdResponse_AppendEntriesResponse::_internal_has_last_log_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool CmdResponse_AppendEntriesResponse::has_last_log_index() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_last_log_index();
 }
-inline void CmdResponse_AppendEntriesResponse::set_has_last_log_index() {
-  _has_bits_[0] |= 0x00000004u;
+inline void CmdResponse_AppendEntriesResponse::clear_last_log_index() {
+  _impl_.last_log_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void CmdResponse_AppendEntriesResponse::clear_has_last_log_index() {
-  _has_bits_[0] &= ~0x00000004u;
+inline uint64_t CmdResponse_AppendEntriesResponse::_internal_last_log_index() const {
+  return _impl_.last_log_index_;
 }
-inline void CmdResponse_AppendEntriesResponse::clear_last_log_index() {
-  last_log_index_ = GOOGLE_ULONGLONG(0);
-  clear_has_last_log_index();
+inline uint64_t CmdResponse_AppendEntriesResponse::last_log_index() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.AppendEntriesResponse.last_log_index)
+  return _internal_last_log_index();
 }
-inline ::google::protobuf::uint64 CmdResponse_AppendEntriesResponse::last_log_index() const {
-  return last_log_index_;
+inline void CmdResponse_AppendEntriesResponse::_internal_set_last_log_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.last_log_index_ = value;
 }
-inline void CmdResponse_AppendEntriesResponse::set_last_log_index(::google::protobuf::uint64 value) {
-  set_has_last_log_index();
-  last_log_index_ = value;
+inline void CmdResponse_AppendEntriesResponse::set_last_log_index(uint64_t value) {
+  _internal_set_last_log_index(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.AppendEntriesResponse.last_log_index)
 }
 
 // -------------------------------------------------------------------
@@ -3112,367 +7700,495 @@ inline void CmdResponse_AppendEntriesResponse::set_last_log_index(::google::prot
 // CmdResponse_ServerStatus
 
 // required uint64 term = 1;
+inline bool CmdResponse_ServerStatus::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool CmdResponse_ServerStatus::has_term() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_term();
 }
-inline void CmdResponse_ServerStatus::set_has_term() {
-  _has_bits_[0] |= 0x00000001u;
+inline void CmdResponse_ServerStatus::clear_term() {
+  _impl_.term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void CmdResponse_ServerStatus::clear_has_term() {
-  _has_bits_[0] &= ~0x00000001u;
+inline uint64_t CmdResponse_ServerStatus::_internal_term() const {
+  return _impl_.term_;
 }
-inline void CmdResponse_ServerStatus::clear_term() {
-  term_ = GOOGLE_ULONGLONG(0);
-  clear_has_term();
+inline uint64_t CmdResponse_ServerStatus::term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.term)
+  return _internal_term();
 }
-inline ::google::protobuf::uint64 CmdResponse_ServerStatus::term() const {
-  return term_;
+inline void CmdResponse_ServerStatus::_internal_set_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.term_ = value;
 }
-inline void CmdResponse_ServerStatus::set_term(::google::protobuf::uint64 value) {
-  set_has_term();
-  term_ = value;
+inline void CmdResponse_ServerStatus::set_term(uint64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.term)
 }
 
 // required uint64 commit_index = 2;
+inline bool CmdResponse_ServerStatus::_internal_has_commit_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool CmdResponse_ServerStatus::has_commit_index() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_commit_index();
 }
-inline void CmdResponse_ServerStatus::set_has_commit_index() {
-  _has_bits_[0] |= 0x00000002u;
+inline void CmdResponse_ServerStatus::clear_commit_index() {
+  _impl_.commit_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void CmdResponse_ServerStatus::clear_has_commit_index() {
-  _has_bits_[0] &= ~0x00000002u;
+inline uint64_t CmdResponse_ServerStatus::_internal_commit_index() const {
+  return _impl_.commit_index_;
 }
-inline void CmdResponse_ServerStatus::clear_commit_index() {
-  commit_index_ = GOOGLE_ULONGLONG(0);
-  clear_has_commit_index();
+inline uint64_t CmdResponse_ServerStatus::commit_index() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.commit_index)
+  return _internal_commit_index();
 }
-inline ::google::protobuf::uint64 CmdResponse_ServerStatus::commit_index() const {
-  return commit_index_;
+inline void CmdResponse_ServerStatus::_internal_set_commit_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.commit_index_ = value;
 }
-inline void CmdResponse_ServerStatus::set_commit_index(::google::protobuf::uint64 value) {
-  set_has_commit_index();
-  commit_index_ = value;
+inline void CmdResponse_ServerStatus::set_commit_index(uint64_t value) {
+  _internal_set_commit_index(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.commit_index)
 }
 
 // required bytes role = 3;
-inline bool CmdResponse_ServerStatus::has_role() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void CmdResponse_ServerStatus::set_has_role() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdResponse_ServerStatus::_internal_has_role() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CmdResponse_ServerStatus::clear_has_role() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool CmdResponse_ServerStatus::has_role() const {
+  return _internal_has_role();
 }
 inline void CmdResponse_ServerStatus::clear_role() {
-  if (role_ != &::google::protobuf::internal::kEmptyString) {
-    role_->clear();
-  }
-  clear_has_role();
-}
-inline const ::std::string& CmdResponse_ServerStatus::role() const {
-  return *role_;
-}
-inline void CmdResponse_ServerStatus::set_role(const ::std::string& value) {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
-  }
-  role_->assign(value);
-}
-inline void CmdResponse_ServerStatus::set_role(const char* value) {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
-  }
-  role_->assign(value);
-}
-inline void CmdResponse_ServerStatus::set_role(const void* value, size_t size) {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
-  }
-  role_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* CmdResponse_ServerStatus::mutable_role() {
-  set_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    role_ = new ::std::string;
-  }
-  return role_;
-}
-inline ::std::string* CmdResponse_ServerStatus::release_role() {
-  clear_has_role();
-  if (role_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.role_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse_ServerStatus::role() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.role)
+  return _internal_role();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_ServerStatus::set_role(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.role_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.role)
+}
+inline std::string* CmdResponse_ServerStatus::mutable_role() {
+  std::string* _s = _internal_mutable_role();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.ServerStatus.role)
+  return _s;
+}
+inline const std::string& CmdResponse_ServerStatus::_internal_role() const {
+  return _impl_.role_.Get();
+}
+inline void CmdResponse_ServerStatus::_internal_set_role(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.role_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_ServerStatus::_internal_mutable_role() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.role_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_ServerStatus::release_role() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.ServerStatus.role)
+  if (!_internal_has_role()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.role_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.role_.IsDefault()) {
+    _impl_.role_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_ServerStatus::set_allocated_role(std::string* role) {
+  if (role != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = role_;
-    role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void CmdResponse_ServerStatus::set_allocated_role(::std::string* role) {
-  if (role_ != &::google::protobuf::internal::kEmptyString) {
-    delete role_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (role) {
-    set_has_role();
-    role_ = role;
-  } else {
-    clear_has_role();
-    role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.role_.SetAllocated(role, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.role_.IsDefault()) {
+    _impl_.role_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.ServerStatus.role)
 }
 
 // optional bytes leader_ip = 4;
-inline bool CmdResponse_ServerStatus::has_leader_ip() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void CmdResponse_ServerStatus::set_has_leader_ip() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void CmdResponse_ServerStatus::clear_has_leader_ip() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool CmdResponse_ServerStatus::_internal_has_leader_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CmdResponse_ServerStatus::clear_leader_ip() {
-  if (leader_ip_ != &::google::protobuf::internal::kEmptyString) {
-    leader_ip_->clear();
-  }
-  clear_has_leader_ip();
-}
-inline const ::std::string& CmdResponse_ServerStatus::leader_ip() const {
-  return *leader_ip_;
-}
-inline void CmdResponse_ServerStatus::set_leader_ip(const ::std::string& value) {
-  set_has_leader_ip();
-  if (leader_ip_ == &::google::protobuf::internal::kEmptyString) {
-    leader_ip_ = new ::std::string;
-  }
-  leader_ip_->assign(value);
-}
-inline void CmdResponse_ServerStatus::set_leader_ip(const char* value) {
-  set_has_leader_ip();
-  if (leader_ip_ == &::google::protobuf::internal::kEmptyString) {
-    leader_ip_ = new ::std::string;
-  }
-  leader_ip_->assign(value);
-}
-inline void CmdResponse_ServerStatus::set_leader_ip(const void* value, size_t size) {
-  set_has_leader_ip();
-  if (leader_ip_ == &::google::protobuf::internal::kEmptyString) {
-    leader_ip_ = new ::std::string;
-  }
-  leader_ip_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* CmdResponse_ServerStatus::mutable_leader_ip() {
-  set_has_leader_ip();
-  if (leader_ip_ == &::google::protobuf::internal::kEmptyString) {
-    leader_ip_ = new ::std::string;
-  }
-  return leader_ip_;
-}
-inline ::std::string* CmdResponse_ServerStatus::release_leader_ip() {
-  clear_has_leader_ip();
-  if (leader_ip_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = leader_ip_;
-    leader_ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline bool CmdResponse_ServerStatus::has_leader_ip() const {
+  return _internal_has_leader_ip();
 }
-inline void CmdResponse_ServerStatus::set_allocated_leader_ip(::std::string* leader_ip) {
-  if (leader_ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete leader_ip_;
-  }
-  if (leader_ip) {
-    set_has_leader_ip();
-    leader_ip_ = leader_ip;
+inline void CmdResponse_ServerStatus::clear_leader_ip() {
+  _impl_.leader_ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CmdResponse_ServerStatus::leader_ip() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.leader_ip)
+  return _internal_leader_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_ServerStatus::set_leader_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.leader_ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.leader_ip)
+}
+inline std::string* CmdResponse_ServerStatus::mutable_leader_ip() {
+  std::string* _s = _internal_mutable_leader_ip();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.ServerStatus.leader_ip)
+  return _s;
+}
+inline const std::string& CmdResponse_ServerStatus::_internal_leader_ip() const {
+  return _impl_.leader_ip_.Get();
+}
+inline void CmdResponse_ServerStatus::_internal_set_leader_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.leader_ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_ServerStatus::_internal_mutable_leader_ip() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.leader_ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_ServerStatus::release_leader_ip() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.ServerStatus.leader_ip)
+  if (!_internal_has_leader_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.leader_ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_ip_.IsDefault()) {
+    _impl_.leader_ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_ServerStatus::set_allocated_leader_ip(std::string* leader_ip) {
+  if (leader_ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_leader_ip();
-    leader_ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.leader_ip_.SetAllocated(leader_ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.leader_ip_.IsDefault()) {
+    _impl_.leader_ip_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.ServerStatus.leader_ip)
 }
 
 // optional int32 leader_port = 5;
+inline bool CmdResponse_ServerStatus::_internal_has_leader_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool CmdResponse_ServerStatus::has_leader_port() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_leader_port();
 }
-inline void CmdResponse_ServerStatus::set_has_leader_port() {
-  _has_bits_[0] |= 0x00000010u;
+inline void CmdResponse_ServerStatus::clear_leader_port() {
+  _impl_.leader_port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void CmdResponse_ServerStatus::clear_has_leader_port() {
-  _has_bits_[0] &= ~0x00000010u;
+inline int32_t CmdResponse_ServerStatus::_internal_leader_port() const {
+  return _impl_.leader_port_;
 }
-inline void CmdResponse_ServerStatus::clear_leader_port() {
-  leader_port_ = 0;
-  clear_has_leader_port();
+inline int32_t CmdResponse_ServerStatus::leader_port() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.leader_port)
+  return _internal_leader_port();
 }
-inline ::google::protobuf::int32 CmdResponse_ServerStatus::leader_port() const {
-  return leader_port_;
+inline void CmdResponse_ServerStatus::_internal_set_leader_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.leader_port_ = value;
 }
-inline void CmdResponse_ServerStatus::set_leader_port(::google::protobuf::int32 value) {
-  set_has_leader_port();
-  leader_port_ = value;
+inline void CmdResponse_ServerStatus::set_leader_port(int32_t value) {
+  _internal_set_leader_port(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.leader_port)
 }
 
 // optional bytes voted_for_ip = 6;
-inline bool CmdResponse_ServerStatus::has_voted_for_ip() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool CmdResponse_ServerStatus::_internal_has_voted_for_ip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void CmdResponse_ServerStatus::set_has_voted_for_ip() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void CmdResponse_ServerStatus::clear_has_voted_for_ip() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool CmdResponse_ServerStatus::has_voted_for_ip() const {
+  return _internal_has_voted_for_ip();
 }
 inline void CmdResponse_ServerStatus::clear_voted_for_ip() {
-  if (voted_for_ip_ != &::google::protobuf::internal::kEmptyString) {
-    voted_for_ip_->clear();
-  }
-  clear_has_voted_for_ip();
-}
-inline const ::std::string& CmdResponse_ServerStatus::voted_for_ip() const {
-  return *voted_for_ip_;
-}
-inline void CmdResponse_ServerStatus::set_voted_for_ip(const ::std::string& value) {
-  set_has_voted_for_ip();
-  if (voted_for_ip_ == &::google::protobuf::internal::kEmptyString) {
-    voted_for_ip_ = new ::std::string;
-  }
-  voted_for_ip_->assign(value);
-}
-inline void CmdResponse_ServerStatus::set_voted_for_ip(const char* value) {
-  set_has_voted_for_ip();
-  if (voted_for_ip_ == &::google::protobuf::internal::kEmptyString) {
-    voted_for_ip_ = new ::std::string;
-  }
-  voted_for_ip_->assign(value);
-}
-inline void CmdResponse_ServerStatus::set_voted_for_ip(const void* value, size_t size) {
-  set_has_voted_for_ip();
-  if (voted_for_ip_ == &::google::protobuf::internal::kEmptyString) {
-    voted_for_ip_ = new ::std::string;
-  }
-  voted_for_ip_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* CmdResponse_ServerStatus::mutable_voted_for_ip() {
-  set_has_voted_for_ip();
-  if (voted_for_ip_ == &::google::protobuf::internal::kEmptyString) {
-    voted_for_ip_ = new ::std::string;
-  }
-  return voted_for_ip_;
-}
-inline ::std::string* CmdResponse_ServerStatus::release_voted_for_ip() {
-  clear_has_voted_for_ip();
-  if (voted_for_ip_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.voted_for_ip_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CmdResponse_ServerStatus::voted_for_ip() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.voted_for_ip)
+  return _internal_voted_for_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse_ServerStatus::set_voted_for_ip(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.voted_for_ip_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.voted_for_ip)
+}
+inline std::string* CmdResponse_ServerStatus::mutable_voted_for_ip() {
+  std::string* _s = _internal_mutable_voted_for_ip();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.ServerStatus.voted_for_ip)
+  return _s;
+}
+inline const std::string& CmdResponse_ServerStatus::_internal_voted_for_ip() const {
+  return _impl_.voted_for_ip_.Get();
+}
+inline void CmdResponse_ServerStatus::_internal_set_voted_for_ip(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.voted_for_ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse_ServerStatus::_internal_mutable_voted_for_ip() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.voted_for_ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse_ServerStatus::release_voted_for_ip() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.ServerStatus.voted_for_ip)
+  if (!_internal_has_voted_for_ip()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.voted_for_ip_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.voted_for_ip_.IsDefault()) {
+    _impl_.voted_for_ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse_ServerStatus::set_allocated_voted_for_ip(std::string* voted_for_ip) {
+  if (voted_for_ip != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    ::std::string* temp = voted_for_ip_;
-    voted_for_ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void CmdResponse_ServerStatus::set_allocated_voted_for_ip(::std::string* voted_for_ip) {
-  if (voted_for_ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete voted_for_ip_;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  if (voted_for_ip) {
-    set_has_voted_for_ip();
-    voted_for_ip_ = voted_for_ip;
-  } else {
-    clear_has_voted_for_ip();
-    voted_for_ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.voted_for_ip_.SetAllocated(voted_for_ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.voted_for_ip_.IsDefault()) {
+    _impl_.voted_for_ip_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.ServerStatus.voted_for_ip)
 }
 
 // optional int32 voted_for_port = 7;
+inline bool CmdResponse_ServerStatus::_internal_has_voted_for_port() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool CmdResponse_ServerStatus::has_voted_for_port() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+  return _internal_has_voted_for_port();
 }
-inline void CmdResponse_ServerStatus::set_has_voted_for_port() {
-  _has_bits_[0] |= 0x00000040u;
+inline void CmdResponse_ServerStatus::clear_voted_for_port() {
+  _impl_.voted_for_port_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void CmdResponse_ServerStatus::clear_has_voted_for_port() {
-  _has_bits_[0] &= ~0x00000040u;
+inline int32_t CmdResponse_ServerStatus::_internal_voted_for_port() const {
+  return _impl_.voted_for_port_;
 }
-inline void CmdResponse_ServerStatus::clear_voted_for_port() {
-  voted_for_port_ = 0;
-  clear_has_voted_for_port();
+inline int32_t CmdResponse_ServerStatus::voted_for_port() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.voted_for_port)
+  return _internal_voted_for_port();
 }
-inline ::google::protobuf::int32 CmdResponse_ServerStatus::voted_for_port() const {
-  return voted_for_port_;
+inline void CmdResponse_ServerStatus::_internal_set_voted_for_port(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.voted_for_port_ = value;
 }
-inline void CmdResponse_ServerStatus::set_voted_for_port(::google::protobuf::int32 value) {
-  set_has_voted_for_port();
-  voted_for_port_ = value;
+inline void CmdResponse_ServerStatus::set_voted_for_port(int32_t value) {
+  _internal_set_voted_for_port(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.voted_for_port)
 }
 
 // optional uint64 last_log_term = 8;
+inline bool CmdResponse_ServerStatus::_internal_has_last_log_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
 inline bool CmdResponse_ServerStatus::has_last_log_term() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+  return _internal_has_last_log_term();
 }
-inline void CmdResponse_ServerStatus::set_has_last_log_term() {
-  _has_bits_[0] |= 0x00000080u;
+inline void CmdResponse_ServerStatus::clear_last_log_term() {
+  _impl_.last_log_term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline void CmdResponse_ServerStatus::clear_has_last_log_term() {
-  _has_bits_[0] &= ~0x00000080u;
+inline uint64_t CmdResponse_ServerStatus::_internal_last_log_term() const {
+  return _impl_.last_log_term_;
 }
-inline void CmdResponse_ServerStatus::clear_last_log_term() {
-  last_log_term_ = GOOGLE_ULONGLONG(0);
-  clear_has_last_log_term();
+inline uint64_t CmdResponse_ServerStatus::last_log_term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.last_log_term)
+  return _internal_last_log_term();
 }
-inline ::google::protobuf::uint64 CmdResponse_ServerStatus::last_log_term() const {
-  return last_log_term_;
+inline void CmdResponse_ServerStatus::_internal_set_last_log_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.last_log_term_ = value;
 }
-inline void CmdResponse_ServerStatus::set_last_log_term(::google::protobuf::uint64 value) {
-  set_has_last_log_term();
-  last_log_term_ = value;
+inline void CmdResponse_ServerStatus::set_last_log_term(uint64_t value) {
+  _internal_set_last_log_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.last_log_term)
 }
 
 // optional uint64 last_log_index = 9;
+inline bool CmdResponse_ServerStatus::_internal_has_last_log_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
 inline bool CmdResponse_ServerStatus::has_last_log_index() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+  return _internal_has_last_log_index();
 }
-inline void CmdResponse_ServerStatus::set_has_last_log_index() {
-  _has_bits_[0] |= 0x00000100u;
+inline void CmdResponse_ServerStatus::clear_last_log_index() {
+  _impl_.last_log_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline void CmdResponse_ServerStatus::clear_has_last_log_index() {
-  _has_bits_[0] &= ~0x00000100u;
+inline uint64_t CmdResponse_ServerStatus::_internal_last_log_index() const {
+  return _impl_.last_log_index_;
 }
-inline void CmdResponse_ServerStatus::clear_last_log_index() {
-  last_log_index_ = GOOGLE_ULONGLONG(0);
-  clear_has_last_log_index();
+inline uint64_t CmdResponse_ServerStatus::last_log_index() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.last_log_index)
+  return _internal_last_log_index();
 }
-inline ::google::protobuf::uint64 CmdResponse_ServerStatus::last_log_index() const {
-  return last_log_index_;
+inline void CmdResponse_ServerStatus::_internal_set_last_log_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.last_log_index_ = value;
 }
-inline void CmdResponse_ServerStatus::set_last_log_index(::google::protobuf::uint64 value) {
-  set_has_last_log_index();
-  last_log_index_ = value;
+inline void CmdResponse_ServerStatus::set_last_log_index(uint64_t value) {
+  _internal_set_last_log_index(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.last_log_index)
 }
 
 // optional uint64 last_applied = 10;
+inline bool CmdResponse_ServerStatus::_internal_has_last_applied() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
 inline bool CmdResponse_ServerStatus::has_last_applied() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
+  return _internal_has_last_applied();
 }
-inline void CmdResponse_ServerStatus::set_has_last_applied() {
-  _has_bits_[0] |= 0x00000200u;
+inline void CmdResponse_ServerStatus::clear_last_applied() {
+  _impl_.last_applied_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
-inline void CmdResponse_ServerStatus::clear_has_last_applied() {
-  _has_bits_[0] &= ~0x00000200u;
+inline uint64_t CmdResponse_ServerStatus::_internal_last_applied() const {
+  return _impl_.last_applied_;
 }
-inline void CmdResponse_ServerStatus::clear_last_applied() {
-  last_applied_ = GOOGLE_ULONGLONG(0);
-  clear_has_last_applied();
+inline uint64_t CmdResponse_ServerStatus::last_applied() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ServerStatus.last_applied)
+  return _internal_last_applied();
+}
+inline void CmdResponse_ServerStatus::_internal_set_last_applied(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.last_applied_ = value;
+}
+inline void CmdResponse_ServerStatus::set_last_applied(uint64_t value) {
+  _internal_set_last_applied(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ServerStatus.last_applied)
+}
+
+// -------------------------------------------------------------------
+
+// CmdResponse_ReadIndexResponse
+
+// required uint64 read_index = 1;
+inline bool CmdResponse_ReadIndexResponse::_internal_has_read_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdResponse_ReadIndexResponse::has_read_index() const {
+  return _internal_has_read_index();
+}
+inline void CmdResponse_ReadIndexResponse::clear_read_index() {
+  _impl_.read_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CmdResponse_ReadIndexResponse::_internal_read_index() const {
+  return _impl_.read_index_;
+}
+inline uint64_t CmdResponse_ReadIndexResponse::read_index() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.ReadIndexResponse.read_index)
+  return _internal_read_index();
+}
+inline void CmdResponse_ReadIndexResponse::_internal_set_read_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.read_index_ = value;
+}
+inline void CmdResponse_ReadIndexResponse::set_read_index(uint64_t value) {
+  _internal_set_read_index(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.ReadIndexResponse.read_index)
+}
+
+// -------------------------------------------------------------------
+
+// CmdResponse_InstallSnapshotResponse
+
+// required uint64 term = 1;
+inline bool CmdResponse_InstallSnapshotResponse::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CmdResponse_InstallSnapshotResponse::has_term() const {
+  return _internal_has_term();
+}
+inline void CmdResponse_InstallSnapshotResponse::clear_term() {
+  _impl_.term_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t CmdResponse_InstallSnapshotResponse::_internal_term() const {
+  return _impl_.term_;
+}
+inline uint64_t CmdResponse_InstallSnapshotResponse::term() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.InstallSnapshotResponse.term)
+  return _internal_term();
+}
+inline void CmdResponse_InstallSnapshotResponse::_internal_set_term(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.term_ = value;
+}
+inline void CmdResponse_InstallSnapshotResponse::set_term(uint64_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.InstallSnapshotResponse.term)
+}
+
+// required bool success = 2;
+inline bool CmdResponse_InstallSnapshotResponse::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CmdResponse_InstallSnapshotResponse::has_success() const {
+  return _internal_has_success();
+}
+inline void CmdResponse_InstallSnapshotResponse::clear_success() {
+  _impl_.success_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::uint64 CmdResponse_ServerStatus::last_applied() const {
-  return last_applied_;
+inline bool CmdResponse_InstallSnapshotResponse::_internal_success() const {
+  return _impl_.success_;
 }
-inline void CmdResponse_ServerStatus::set_last_applied(::google::protobuf::uint64 value) {
-  set_has_last_applied();
-  last_applied_ = value;
+inline bool CmdResponse_InstallSnapshotResponse::success() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.InstallSnapshotResponse.success)
+  return _internal_success();
+}
+inline void CmdResponse_InstallSnapshotResponse::_internal_set_success(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.success_ = value;
+}
+inline void CmdResponse_InstallSnapshotResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.InstallSnapshotResponse.success)
 }
 
 // -------------------------------------------------------------------
@@ -3480,337 +8196,868 @@ inline void CmdResponse_ServerStatus::set_last_applied(::google::protobuf::uint6
 // CmdResponse
 
 // required .floyd.Type type = 1;
-inline bool CmdResponse::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void CmdResponse::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CmdResponse::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void CmdResponse::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool CmdResponse::has_type() const {
+  return _internal_has_type();
 }
 inline void CmdResponse::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline ::floyd::Type CmdResponse::_internal_type() const {
+  return static_cast< ::floyd::Type >(_impl_.type_);
 }
 inline ::floyd::Type CmdResponse::type() const {
-  return static_cast< ::floyd::Type >(type_);
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.type)
+  return _internal_type();
 }
-inline void CmdResponse::set_type(::floyd::Type value) {
+inline void CmdResponse::_internal_set_type(::floyd::Type value) {
   assert(::floyd::Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.type_ = value;
+}
+inline void CmdResponse::set_type(::floyd::Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.type)
 }
 
 // optional .floyd.StatusCode code = 2;
-inline bool CmdResponse::has_code() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool CmdResponse::_internal_has_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void CmdResponse::set_has_code() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void CmdResponse::clear_has_code() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CmdResponse::has_code() const {
+  return _internal_has_code();
 }
 inline void CmdResponse::clear_code() {
-  code_ = 0;
-  clear_has_code();
+  _impl_.code_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline ::floyd::StatusCode CmdResponse::_internal_code() const {
+  return static_cast< ::floyd::StatusCode >(_impl_.code_);
 }
 inline ::floyd::StatusCode CmdResponse::code() const {
-  return static_cast< ::floyd::StatusCode >(code_);
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.code)
+  return _internal_code();
 }
-inline void CmdResponse::set_code(::floyd::StatusCode value) {
+inline void CmdResponse::_internal_set_code(::floyd::StatusCode value) {
   assert(::floyd::StatusCode_IsValid(value));
-  set_has_code();
-  code_ = value;
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.code_ = value;
+}
+inline void CmdResponse::set_code(::floyd::StatusCode value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.code)
 }
 
 // optional bytes msg = 3;
-inline bool CmdResponse::has_msg() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void CmdResponse::set_has_msg() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CmdResponse::_internal_has_msg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CmdResponse::clear_has_msg() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool CmdResponse::has_msg() const {
+  return _internal_has_msg();
 }
 inline void CmdResponse::clear_msg() {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    msg_->clear();
-  }
-  clear_has_msg();
-}
-inline const ::std::string& CmdResponse::msg() const {
-  return *msg_;
-}
-inline void CmdResponse::set_msg(const ::std::string& value) {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  msg_->assign(value);
-}
-inline void CmdResponse::set_msg(const char* value) {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  msg_->assign(value);
-}
-inline void CmdResponse::set_msg(const void* value, size_t size) {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  msg_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* CmdResponse::mutable_msg() {
-  set_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    msg_ = new ::std::string;
-  }
-  return msg_;
-}
-inline ::std::string* CmdResponse::release_msg() {
-  clear_has_msg();
-  if (msg_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.msg_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CmdResponse::msg() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CmdResponse::set_msg(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.msg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:floyd.CmdResponse.msg)
+}
+inline std::string* CmdResponse::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.msg)
+  return _s;
+}
+inline const std::string& CmdResponse::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void CmdResponse::_internal_set_msg(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CmdResponse::_internal_mutable_msg() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CmdResponse::release_msg() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.msg)
+  if (!_internal_has_msg()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.msg_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CmdResponse::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = msg_;
-    msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void CmdResponse::set_allocated_msg(::std::string* msg) {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    delete msg_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (msg) {
-    set_has_msg();
-    msg_ = msg;
-  } else {
-    clear_has_msg();
-    msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.msg)
 }
 
 // optional .floyd.CmdResponse.Kv kv = 4;
-inline bool CmdResponse::has_kv() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool CmdResponse::_internal_has_kv() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.kv_ != nullptr);
+  return value;
 }
-inline void CmdResponse::set_has_kv() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void CmdResponse::clear_has_kv() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool CmdResponse::has_kv() const {
+  return _internal_has_kv();
 }
 inline void CmdResponse::clear_kv() {
-  if (kv_ != NULL) kv_->::floyd::CmdResponse_Kv::Clear();
-  clear_has_kv();
+  if (_impl_.kv_ != nullptr) _impl_.kv_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::floyd::CmdResponse_Kv& CmdResponse::_internal_kv() const {
+  const ::floyd::CmdResponse_Kv* p = _impl_.kv_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdResponse_Kv&>(
+      ::floyd::_CmdResponse_Kv_default_instance_);
 }
 inline const ::floyd::CmdResponse_Kv& CmdResponse::kv() const {
-  return kv_ != NULL ? *kv_ : *default_instance_->kv_;
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.kv)
+  return _internal_kv();
 }
-inline ::floyd::CmdResponse_Kv* CmdResponse::mutable_kv() {
-  set_has_kv();
-  if (kv_ == NULL) kv_ = new ::floyd::CmdResponse_Kv;
-  return kv_;
+inline void CmdResponse::unsafe_arena_set_allocated_kv(
+    ::floyd::CmdResponse_Kv* kv) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.kv_);
+  }
+  _impl_.kv_ = kv;
+  if (kv) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdResponse.kv)
 }
 inline ::floyd::CmdResponse_Kv* CmdResponse::release_kv() {
-  clear_has_kv();
-  ::floyd::CmdResponse_Kv* temp = kv_;
-  kv_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::floyd::CmdResponse_Kv* temp = _impl_.kv_;
+  _impl_.kv_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::floyd::CmdResponse_Kv* CmdResponse::unsafe_arena_release_kv() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.kv)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::floyd::CmdResponse_Kv* temp = _impl_.kv_;
+  _impl_.kv_ = nullptr;
   return temp;
 }
+inline ::floyd::CmdResponse_Kv* CmdResponse::_internal_mutable_kv() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.kv_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdResponse_Kv>(GetArenaForAllocation());
+    _impl_.kv_ = p;
+  }
+  return _impl_.kv_;
+}
+inline ::floyd::CmdResponse_Kv* CmdResponse::mutable_kv() {
+  ::floyd::CmdResponse_Kv* _msg = _internal_mutable_kv();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.kv)
+  return _msg;
+}
 inline void CmdResponse::set_allocated_kv(::floyd::CmdResponse_Kv* kv) {
-  delete kv_;
-  kv_ = kv;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.kv_;
+  }
   if (kv) {
-    set_has_kv();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(kv);
+    if (message_arena != submessage_arena) {
+      kv = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, kv, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_kv();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.kv_ = kv;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.kv)
 }
 
 // optional .floyd.CmdResponse.Kvs kvs = 5;
-inline bool CmdResponse::has_kvs() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool CmdResponse::_internal_has_kvs() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.kvs_ != nullptr);
+  return value;
 }
-inline void CmdResponse::set_has_kvs() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void CmdResponse::clear_has_kvs() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool CmdResponse::has_kvs() const {
+  return _internal_has_kvs();
 }
 inline void CmdResponse::clear_kvs() {
-  if (kvs_ != NULL) kvs_->::floyd::CmdResponse_Kvs::Clear();
-  clear_has_kvs();
+  if (_impl_.kvs_ != nullptr) _impl_.kvs_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::floyd::CmdResponse_Kvs& CmdResponse::_internal_kvs() const {
+  const ::floyd::CmdResponse_Kvs* p = _impl_.kvs_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdResponse_Kvs&>(
+      ::floyd::_CmdResponse_Kvs_default_instance_);
 }
 inline const ::floyd::CmdResponse_Kvs& CmdResponse::kvs() const {
-  return kvs_ != NULL ? *kvs_ : *default_instance_->kvs_;
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.kvs)
+  return _internal_kvs();
 }
-inline ::floyd::CmdResponse_Kvs* CmdResponse::mutable_kvs() {
-  set_has_kvs();
-  if (kvs_ == NULL) kvs_ = new ::floyd::CmdResponse_Kvs;
-  return kvs_;
+inline void CmdResponse::unsafe_arena_set_allocated_kvs(
+    ::floyd::CmdResponse_Kvs* kvs) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.kvs_);
+  }
+  _impl_.kvs_ = kvs;
+  if (kvs) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdResponse.kvs)
 }
 inline ::floyd::CmdResponse_Kvs* CmdResponse::release_kvs() {
-  clear_has_kvs();
-  ::floyd::CmdResponse_Kvs* temp = kvs_;
-  kvs_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::floyd::CmdResponse_Kvs* temp = _impl_.kvs_;
+  _impl_.kvs_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::floyd::CmdResponse_Kvs* CmdResponse::unsafe_arena_release_kvs() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.kvs)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::floyd::CmdResponse_Kvs* temp = _impl_.kvs_;
+  _impl_.kvs_ = nullptr;
   return temp;
 }
+inline ::floyd::CmdResponse_Kvs* CmdResponse::_internal_mutable_kvs() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.kvs_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdResponse_Kvs>(GetArenaForAllocation());
+    _impl_.kvs_ = p;
+  }
+  return _impl_.kvs_;
+}
+inline ::floyd::CmdResponse_Kvs* CmdResponse::mutable_kvs() {
+  ::floyd::CmdResponse_Kvs* _msg = _internal_mutable_kvs();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.kvs)
+  return _msg;
+}
 inline void CmdResponse::set_allocated_kvs(::floyd::CmdResponse_Kvs* kvs) {
-  delete kvs_;
-  kvs_ = kvs;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.kvs_;
+  }
   if (kvs) {
-    set_has_kvs();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(kvs);
+    if (message_arena != submessage_arena) {
+      kvs = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, kvs, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_kvs();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.kvs_ = kvs;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.kvs)
 }
 
 // optional .floyd.CmdResponse.RequestVoteResponse request_vote_res = 6;
-inline bool CmdResponse::has_request_vote_res() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool CmdResponse::_internal_has_request_vote_res() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_vote_res_ != nullptr);
+  return value;
 }
-inline void CmdResponse::set_has_request_vote_res() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void CmdResponse::clear_has_request_vote_res() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool CmdResponse::has_request_vote_res() const {
+  return _internal_has_request_vote_res();
 }
 inline void CmdResponse::clear_request_vote_res() {
-  if (request_vote_res_ != NULL) request_vote_res_->::floyd::CmdResponse_RequestVoteResponse::Clear();
-  clear_has_request_vote_res();
+  if (_impl_.request_vote_res_ != nullptr) _impl_.request_vote_res_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::floyd::CmdResponse_RequestVoteResponse& CmdResponse::_internal_request_vote_res() const {
+  const ::floyd::CmdResponse_RequestVoteResponse* p = _impl_.request_vote_res_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdResponse_RequestVoteResponse&>(
+      ::floyd::_CmdResponse_RequestVoteResponse_default_instance_);
 }
 inline const ::floyd::CmdResponse_RequestVoteResponse& CmdResponse::request_vote_res() const {
-  return request_vote_res_ != NULL ? *request_vote_res_ : *default_instance_->request_vote_res_;
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.request_vote_res)
+  return _internal_request_vote_res();
 }
-inline ::floyd::CmdResponse_RequestVoteResponse* CmdResponse::mutable_request_vote_res() {
-  set_has_request_vote_res();
-  if (request_vote_res_ == NULL) request_vote_res_ = new ::floyd::CmdResponse_RequestVoteResponse;
-  return request_vote_res_;
+inline void CmdResponse::unsafe_arena_set_allocated_request_vote_res(
+    ::floyd::CmdResponse_RequestVoteResponse* request_vote_res) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_vote_res_);
+  }
+  _impl_.request_vote_res_ = request_vote_res;
+  if (request_vote_res) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdResponse.request_vote_res)
 }
 inline ::floyd::CmdResponse_RequestVoteResponse* CmdResponse::release_request_vote_res() {
-  clear_has_request_vote_res();
-  ::floyd::CmdResponse_RequestVoteResponse* temp = request_vote_res_;
-  request_vote_res_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::floyd::CmdResponse_RequestVoteResponse* temp = _impl_.request_vote_res_;
+  _impl_.request_vote_res_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::floyd::CmdResponse_RequestVoteResponse* CmdResponse::unsafe_arena_release_request_vote_res() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.request_vote_res)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::floyd::CmdResponse_RequestVoteResponse* temp = _impl_.request_vote_res_;
+  _impl_.request_vote_res_ = nullptr;
   return temp;
 }
+inline ::floyd::CmdResponse_RequestVoteResponse* CmdResponse::_internal_mutable_request_vote_res() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.request_vote_res_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdResponse_RequestVoteResponse>(GetArenaForAllocation());
+    _impl_.request_vote_res_ = p;
+  }
+  return _impl_.request_vote_res_;
+}
+inline ::floyd::CmdResponse_RequestVoteResponse* CmdResponse::mutable_request_vote_res() {
+  ::floyd::CmdResponse_RequestVoteResponse* _msg = _internal_mutable_request_vote_res();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.request_vote_res)
+  return _msg;
+}
 inline void CmdResponse::set_allocated_request_vote_res(::floyd::CmdResponse_RequestVoteResponse* request_vote_res) {
-  delete request_vote_res_;
-  request_vote_res_ = request_vote_res;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_vote_res_;
+  }
   if (request_vote_res) {
-    set_has_request_vote_res();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request_vote_res);
+    if (message_arena != submessage_arena) {
+      request_vote_res = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request_vote_res, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_request_vote_res();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.request_vote_res_ = request_vote_res;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.request_vote_res)
 }
 
 // optional .floyd.CmdResponse.AppendEntriesResponse append_entries_res = 7;
-inline bool CmdResponse::has_append_entries_res() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+inline bool CmdResponse::_internal_has_append_entries_res() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.append_entries_res_ != nullptr);
+  return value;
 }
-inline void CmdResponse::set_has_append_entries_res() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void CmdResponse::clear_has_append_entries_res() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool CmdResponse::has_append_entries_res() const {
+  return _internal_has_append_entries_res();
 }
 inline void CmdResponse::clear_append_entries_res() {
-  if (append_entries_res_ != NULL) append_entries_res_->::floyd::CmdResponse_AppendEntriesResponse::Clear();
-  clear_has_append_entries_res();
+  if (_impl_.append_entries_res_ != nullptr) _impl_.append_entries_res_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::floyd::CmdResponse_AppendEntriesResponse& CmdResponse::_internal_append_entries_res() const {
+  const ::floyd::CmdResponse_AppendEntriesResponse* p = _impl_.append_entries_res_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdResponse_AppendEntriesResponse&>(
+      ::floyd::_CmdResponse_AppendEntriesResponse_default_instance_);
 }
 inline const ::floyd::CmdResponse_AppendEntriesResponse& CmdResponse::append_entries_res() const {
-  return append_entries_res_ != NULL ? *append_entries_res_ : *default_instance_->append_entries_res_;
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.append_entries_res)
+  return _internal_append_entries_res();
 }
-inline ::floyd::CmdResponse_AppendEntriesResponse* CmdResponse::mutable_append_entries_res() {
-  set_has_append_entries_res();
-  if (append_entries_res_ == NULL) append_entries_res_ = new ::floyd::CmdResponse_AppendEntriesResponse;
-  return append_entries_res_;
+inline void CmdResponse::unsafe_arena_set_allocated_append_entries_res(
+    ::floyd::CmdResponse_AppendEntriesResponse* append_entries_res) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.append_entries_res_);
+  }
+  _impl_.append_entries_res_ = append_entries_res;
+  if (append_entries_res) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdResponse.append_entries_res)
 }
 inline ::floyd::CmdResponse_AppendEntriesResponse* CmdResponse::release_append_entries_res() {
-  clear_has_append_entries_res();
-  ::floyd::CmdResponse_AppendEntriesResponse* temp = append_entries_res_;
-  append_entries_res_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::floyd::CmdResponse_AppendEntriesResponse* temp = _impl_.append_entries_res_;
+  _impl_.append_entries_res_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::floyd::CmdResponse_AppendEntriesResponse* CmdResponse::unsafe_arena_release_append_entries_res() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.append_entries_res)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::floyd::CmdResponse_AppendEntriesResponse* temp = _impl_.append_entries_res_;
+  _impl_.append_entries_res_ = nullptr;
   return temp;
 }
+inline ::floyd::CmdResponse_AppendEntriesResponse* CmdResponse::_internal_mutable_append_entries_res() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.append_entries_res_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdResponse_AppendEntriesResponse>(GetArenaForAllocation());
+    _impl_.append_entries_res_ = p;
+  }
+  return _impl_.append_entries_res_;
+}
+inline ::floyd::CmdResponse_AppendEntriesResponse* CmdResponse::mutable_append_entries_res() {
+  ::floyd::CmdResponse_AppendEntriesResponse* _msg = _internal_mutable_append_entries_res();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.append_entries_res)
+  return _msg;
+}
 inline void CmdResponse::set_allocated_append_entries_res(::floyd::CmdResponse_AppendEntriesResponse* append_entries_res) {
-  delete append_entries_res_;
-  append_entries_res_ = append_entries_res;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.append_entries_res_;
+  }
   if (append_entries_res) {
-    set_has_append_entries_res();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(append_entries_res);
+    if (message_arena != submessage_arena) {
+      append_entries_res = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, append_entries_res, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    clear_has_append_entries_res();
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
+  _impl_.append_entries_res_ = append_entries_res;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.append_entries_res)
 }
 
 // optional .floyd.CmdResponse.ServerStatus server_status = 8;
-inline bool CmdResponse::has_server_status() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+inline bool CmdResponse::_internal_has_server_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.server_status_ != nullptr);
+  return value;
 }
-inline void CmdResponse::set_has_server_status() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void CmdResponse::clear_has_server_status() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool CmdResponse::has_server_status() const {
+  return _internal_has_server_status();
 }
 inline void CmdResponse::clear_server_status() {
-  if (server_status_ != NULL) server_status_->::floyd::CmdResponse_ServerStatus::Clear();
-  clear_has_server_status();
+  if (_impl_.server_status_ != nullptr) _impl_.server_status_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::floyd::CmdResponse_ServerStatus& CmdResponse::_internal_server_status() const {
+  const ::floyd::CmdResponse_ServerStatus* p = _impl_.server_status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdResponse_ServerStatus&>(
+      ::floyd::_CmdResponse_ServerStatus_default_instance_);
 }
 inline const ::floyd::CmdResponse_ServerStatus& CmdResponse::server_status() const {
-  return server_status_ != NULL ? *server_status_ : *default_instance_->server_status_;
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.server_status)
+  return _internal_server_status();
 }
-inline ::floyd::CmdResponse_ServerStatus* CmdResponse::mutable_server_status() {
-  set_has_server_status();
-  if (server_status_ == NULL) server_status_ = new ::floyd::CmdResponse_ServerStatus;
-  return server_status_;
+inline void CmdResponse::unsafe_arena_set_allocated_server_status(
+    ::floyd::CmdResponse_ServerStatus* server_status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.server_status_);
+  }
+  _impl_.server_status_ = server_status;
+  if (server_status) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdResponse.server_status)
 }
 inline ::floyd::CmdResponse_ServerStatus* CmdResponse::release_server_status() {
-  clear_has_server_status();
-  ::floyd::CmdResponse_ServerStatus* temp = server_status_;
-  server_status_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::floyd::CmdResponse_ServerStatus* temp = _impl_.server_status_;
+  _impl_.server_status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::floyd::CmdResponse_ServerStatus* CmdResponse::unsafe_arena_release_server_status() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.server_status)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::floyd::CmdResponse_ServerStatus* temp = _impl_.server_status_;
+  _impl_.server_status_ = nullptr;
   return temp;
 }
+inline ::floyd::CmdResponse_ServerStatus* CmdResponse::_internal_mutable_server_status() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.server_status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdResponse_ServerStatus>(GetArenaForAllocation());
+    _impl_.server_status_ = p;
+  }
+  return _impl_.server_status_;
+}
+inline ::floyd::CmdResponse_ServerStatus* CmdResponse::mutable_server_status() {
+  ::floyd::CmdResponse_ServerStatus* _msg = _internal_mutable_server_status();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.server_status)
+  return _msg;
+}
 inline void CmdResponse::set_allocated_server_status(::floyd::CmdResponse_ServerStatus* server_status) {
-  delete server_status_;
-  server_status_ = server_status;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.server_status_;
+  }
   if (server_status) {
-    set_has_server_status();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(server_status);
+    if (message_arena != submessage_arena) {
+      server_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, server_status, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.server_status_ = server_status;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.server_status)
+}
+
+// optional .floyd.CmdResponse.ReadIndexResponse read_index_res = 9;
+inline bool CmdResponse::_internal_has_read_index_res() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.read_index_res_ != nullptr);
+  return value;
+}
+inline bool CmdResponse::has_read_index_res() const {
+  return _internal_has_read_index_res();
+}
+inline void CmdResponse::clear_read_index_res() {
+  if (_impl_.read_index_res_ != nullptr) _impl_.read_index_res_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::floyd::CmdResponse_ReadIndexResponse& CmdResponse::_internal_read_index_res() const {
+  const ::floyd::CmdResponse_ReadIndexResponse* p = _impl_.read_index_res_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdResponse_ReadIndexResponse&>(
+      ::floyd::_CmdResponse_ReadIndexResponse_default_instance_);
+}
+inline const ::floyd::CmdResponse_ReadIndexResponse& CmdResponse::read_index_res() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.read_index_res)
+  return _internal_read_index_res();
+}
+inline void CmdResponse::unsafe_arena_set_allocated_read_index_res(
+    ::floyd::CmdResponse_ReadIndexResponse* read_index_res) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.read_index_res_);
+  }
+  _impl_.read_index_res_ = read_index_res;
+  if (read_index_res) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdResponse.read_index_res)
+}
+inline ::floyd::CmdResponse_ReadIndexResponse* CmdResponse::release_read_index_res() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::floyd::CmdResponse_ReadIndexResponse* temp = _impl_.read_index_res_;
+  _impl_.read_index_res_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::floyd::CmdResponse_ReadIndexResponse* CmdResponse::unsafe_arena_release_read_index_res() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.read_index_res)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::floyd::CmdResponse_ReadIndexResponse* temp = _impl_.read_index_res_;
+  _impl_.read_index_res_ = nullptr;
+  return temp;
+}
+inline ::floyd::CmdResponse_ReadIndexResponse* CmdResponse::_internal_mutable_read_index_res() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.read_index_res_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdResponse_ReadIndexResponse>(GetArenaForAllocation());
+    _impl_.read_index_res_ = p;
+  }
+  return _impl_.read_index_res_;
+}
+inline ::floyd::CmdResponse_ReadIndexResponse* CmdResponse::mutable_read_index_res() {
+  ::floyd::CmdResponse_ReadIndexResponse* _msg = _internal_mutable_read_index_res();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.read_index_res)
+  return _msg;
+}
+inline void CmdResponse::set_allocated_read_index_res(::floyd::CmdResponse_ReadIndexResponse* read_index_res) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.read_index_res_;
+  }
+  if (read_index_res) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(read_index_res);
+    if (message_arena != submessage_arena) {
+      read_index_res = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, read_index_res, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    clear_has_server_status();
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
+  _impl_.read_index_res_ = read_index_res;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.read_index_res)
 }
 
+// optional .floyd.CmdResponse.InstallSnapshotResponse install_snapshot_res = 10;
+inline bool CmdResponse::_internal_has_install_snapshot_res() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.install_snapshot_res_ != nullptr);
+  return value;
+}
+inline bool CmdResponse::has_install_snapshot_res() const {
+  return _internal_has_install_snapshot_res();
+}
+inline void CmdResponse::clear_install_snapshot_res() {
+  if (_impl_.install_snapshot_res_ != nullptr) _impl_.install_snapshot_res_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::floyd::CmdResponse_InstallSnapshotResponse& CmdResponse::_internal_install_snapshot_res() const {
+  const ::floyd::CmdResponse_InstallSnapshotResponse* p = _impl_.install_snapshot_res_;
+  return p != nullptr ? *p : reinterpret_cast<const ::floyd::CmdResponse_InstallSnapshotResponse&>(
+      ::floyd::_CmdResponse_InstallSnapshotResponse_default_instance_);
+}
+inline const ::floyd::CmdResponse_InstallSnapshotResponse& CmdResponse::install_snapshot_res() const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.install_snapshot_res)
+  return _internal_install_snapshot_res();
+}
+inline void CmdResponse::unsafe_arena_set_allocated_install_snapshot_res(
+    ::floyd::CmdResponse_InstallSnapshotResponse* install_snapshot_res) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.install_snapshot_res_);
+  }
+  _impl_.install_snapshot_res_ = install_snapshot_res;
+  if (install_snapshot_res) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:floyd.CmdResponse.install_snapshot_res)
+}
+inline ::floyd::CmdResponse_InstallSnapshotResponse* CmdResponse::release_install_snapshot_res() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::floyd::CmdResponse_InstallSnapshotResponse* temp = _impl_.install_snapshot_res_;
+  _impl_.install_snapshot_res_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::floyd::CmdResponse_InstallSnapshotResponse* CmdResponse::unsafe_arena_release_install_snapshot_res() {
+  // @@protoc_insertion_point(field_release:floyd.CmdResponse.install_snapshot_res)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::floyd::CmdResponse_InstallSnapshotResponse* temp = _impl_.install_snapshot_res_;
+  _impl_.install_snapshot_res_ = nullptr;
+  return temp;
+}
+inline ::floyd::CmdResponse_InstallSnapshotResponse* CmdResponse::_internal_mutable_install_snapshot_res() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.install_snapshot_res_ == nullptr) {
+    auto* p = CreateMaybeMessage<::floyd::CmdResponse_InstallSnapshotResponse>(GetArenaForAllocation());
+    _impl_.install_snapshot_res_ = p;
+  }
+  return _impl_.install_snapshot_res_;
+}
+inline ::floyd::CmdResponse_InstallSnapshotResponse* CmdResponse::mutable_install_snapshot_res() {
+  ::floyd::CmdResponse_InstallSnapshotResponse* _msg = _internal_mutable_install_snapshot_res();
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.install_snapshot_res)
+  return _msg;
+}
+inline void CmdResponse::set_allocated_install_snapshot_res(::floyd::CmdResponse_InstallSnapshotResponse* install_snapshot_res) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.install_snapshot_res_;
+  }
+  if (install_snapshot_res) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(install_snapshot_res);
+    if (message_arena != submessage_arena) {
+      install_snapshot_res = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, install_snapshot_res, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.install_snapshot_res_ = install_snapshot_res;
+  // @@protoc_insertion_point(field_set_allocated:floyd.CmdResponse.install_snapshot_res)
+}
+
+// repeated .floyd.CmdResponse forward_res = 11;
+inline int CmdResponse::_internal_forward_res_size() const {
+  return _impl_.forward_res_.size();
+}
+inline int CmdResponse::forward_res_size() const {
+  return _internal_forward_res_size();
+}
+inline void CmdResponse::clear_forward_res() {
+  _impl_.forward_res_.Clear();
+}
+inline ::floyd::CmdResponse* CmdResponse::mutable_forward_res(int index) {
+  // @@protoc_insertion_point(field_mutable:floyd.CmdResponse.forward_res)
+  return _impl_.forward_res_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse >*
+CmdResponse::mutable_forward_res() {
+  // @@protoc_insertion_point(field_mutable_list:floyd.CmdResponse.forward_res)
+  return &_impl_.forward_res_;
+}
+inline const ::floyd::CmdResponse& CmdResponse::_internal_forward_res(int index) const {
+  return _impl_.forward_res_.Get(index);
+}
+inline const ::floyd::CmdResponse& CmdResponse::forward_res(int index) const {
+  // @@protoc_insertion_point(field_get:floyd.CmdResponse.forward_res)
+  return _internal_forward_res(index);
+}
+inline ::floyd::CmdResponse* CmdResponse::_internal_add_forward_res() {
+  return _impl_.forward_res_.Add();
+}
+inline ::floyd::CmdResponse* CmdResponse::add_forward_res() {
+  ::floyd::CmdResponse* _add = _internal_add_forward_res();
+  // @@protoc_insertion_point(field_add:floyd.CmdResponse.forward_res)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::floyd::CmdResponse >&
+CmdResponse::forward_res() const {
+  // @@protoc_insertion_point(field_list:floyd.CmdResponse.forward_res)
+  return _impl_.forward_res_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace floyd
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::floyd::Entry_OpType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::floyd::Entry_OpType>() {
   return ::floyd::Entry_OpType_descriptor();
 }
+template <> struct is_proto_enum< ::floyd::Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::floyd::Type>() {
   return ::floyd::Type_descriptor();
 }
+template <> struct is_proto_enum< ::floyd::StatusCode> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::floyd::StatusCode>() {
   return ::floyd::StatusCode_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_floyd_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_floyd_2eproto
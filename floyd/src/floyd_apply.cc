@@ -7,29 +7,110 @@
 
 #include <google/protobuf/text_format.h>
 
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
 #include <unistd.h>
+#include <algorithm>
 #include <string>
 
+#include "slash/include/env.h"
 #include "slash/include/xdebug.h"
 
 #include "floyd/src/logger.h"
 #include "floyd/src/floyd.pb.h"
 #include "floyd/src/raft_meta.h"
 #include "floyd/src/raft_log.h"
+#include "floyd/src/kv_state_machine.h"
 
 namespace floyd {
 
-FloydApply::FloydApply(FloydContext* context, rocksdb::DB* db, RaftMeta* raft_meta,
+FloydApply::FloydApply(FloydContext* context, StateMachine* state_machine, RaftMeta* raft_meta,
     RaftLog* raft_log, Logger* info_log)
   : bg_thread_(1024 * 1024 * 1024),
     context_(context),
-    db_(db),
+    state_machine_(state_machine),
     raft_meta_(raft_meta),
     raft_log_(raft_log),
-    info_log_(info_log) {
+    info_log_(info_log),
+    expire_scheduled_(false),
+    snapshot_refs_(0),
+    applied_count_(0),
+    applied_size_(0),
+    recv_fd_(-1),
+    recv_index_(0),
+    recv_term_(0),
+    recv_count_(0),
+    installing_(false) {
+  snapshot_index_ = raft_meta_->GetSnapshotIndex();
 }
 
 FloydApply::~FloydApply() {
+  if (recv_fd_ >= 0) {
+    close(recv_fd_);
+  }
+}
+
+/*
+ * a durable state machine tells the last entry it has persisted, the entries
+ * after it are applied again from the raft log. A volatile one starts empty,
+ * it is restored from the latest snapshot and the entries after the snapshot
+ * are applied again
+ */
+Status FloydApply::RecoverStateMachine() {
+  // crashed while replacing the snapshot, the previous one is aside
+  std::string old_path = SnapshotPath() + ".old";
+  if (!slash::FileExists(SnapshotPath()) && slash::FileExists(old_path)) {
+    slash::RenameFile(old_path, SnapshotPath());
+  }
+  // the snapshot directory decides where the log begins, the log before
+  // it may have been deleted after it replaced the previous one
+  uint64_t snapshot_index, snapshot_term;
+  Status s = ReadSnapshotMeta(SnapshotPath(), &snapshot_index, &snapshot_term);
+  if (s.ok() && snapshot_index != raft_meta_->GetSnapshotIndex()) {
+    LOGV(INFO_LEVEL, info_log_, "FloydApply::RecoverStateMachine: snapshot is at index %lu term %lu",
+        snapshot_index, snapshot_term);
+    raft_meta_->SetSnapshotIndex(snapshot_index);
+    raft_meta_->SetSnapshotTerm(snapshot_term);
+    raft_log_->SetSnapshot(snapshot_index, snapshot_term);
+    snapshot_index_ = snapshot_index;
+  }
+
+  uint64_t applied_index;
+  s = state_machine_->GetAppliedIndex(&applied_index);
+  if (s.ok()) {
+    // entries up to the applied index are committed, even if the commit
+    // index written without sync is lost
+    if (context_->commit_index < applied_index) {
+      context_->commit_index = applied_index;
+      raft_meta_->SetCommitIndex(applied_index);
+    }
+    context_->last_applied = applied_index;
+    raft_meta_->SetLastApplied(applied_index);
+    LOGV(INFO_LEVEL, info_log_, "FloydApply::RecoverStateMachine: continue applying after %lu",
+        applied_index);
+    return Status::OK();
+  } else if (s.IsNotFound()) {
+    // written by older version, keep last_applied of raft meta
+    return Status::OK();
+  } else if (!s.IsNotSupported()) {
+    return s;
+  }
+
+  snapshot_index = raft_meta_->GetSnapshotIndex();
+  if (snapshot_index > 0 && slash::FileExists(SnapshotPath())) {
+    s = state_machine_->Restore(SnapshotPath());
+    if (!s.ok()) {
+      return s;
+    }
+  } else {
+    snapshot_index = 0;
+  }
+  context_->last_applied = snapshot_index;
+  raft_meta_->SetLastApplied(snapshot_index);
+  LOGV(INFO_LEVEL, info_log_, "FloydApply::RecoverStateMachine: restored state machine to snapshot at %lu",
+      snapshot_index);
+  return Status::OK();
 }
 
 int FloydApply::Start() {
@@ -56,64 +137,555 @@ void FloydApply::ApplyStateMachineWrapper(void* arg) {
   reinterpret_cast<FloydApply*>(arg)->ApplyStateMachine();
 }
 
+// entries applied in one batch at most
+static const uint64_t kApplyBatchCount = 4096;
+// a failed apply is retried later by a timer task, the apply thread
+// stays free to install snapshot meanwhile
+static const uint64_t kApplyRetryMs = 1000;
+
+/*
+ * the committed entries are read by one log scan and their commands are
+ * applied to state machine in one batch, larger range is split over
+ * several rounds
+ */
 void FloydApply::ApplyStateMachine() {
-  uint64_t last_applied = context_->last_applied;
-  // Apply as more entry as possible
+  uint64_t first_index;
+  uint64_t last_applied;
   uint64_t commit_index;
+  std::vector<uint64_t> terms;
+  {
+  slash::MutexLock l(&state_mu_);
+  last_applied = context_->last_applied;
   commit_index = context_->commit_index;
 
   LOGV(DEBUG_LEVEL, info_log_, "FloydApply::ApplyStateMachine: last_applied: %lu, commit_index: %lu",
             last_applied, commit_index);
-  Entry log_entry;
   if (last_applied >= commit_index) {
     return;
   }
-  while (last_applied < commit_index) {
-    last_applied++;
-    raft_log_->GetEntry(last_applied, &log_entry);
-    Status s = Apply(log_entry);
+  first_index = last_applied + 1;
+  uint64_t last_index = std::min(commit_index, last_applied + kApplyBatchCount);
+  std::vector<Entry> entries;
+  if (raft_log_->GetEntries(first_index, last_index, &entries) != 0) {
+    LOGV(WARN_LEVEL, info_log_, "FloydApply::ApplyStateMachine: read log entries from %lu to %lu failed",
+        first_index, last_index);
+    bg_thread_.DelaySchedule(kApplyRetryMs, &ApplyStateMachineWrapper, this);  // try once more
+    return;
+  }
+  uint64_t batch_size = 0;
+  std::vector<const std::string*> commands;
+  std::vector<std::string> legacy_commands(entries.size());
+  for (size_t i = 0; i < entries.size(); i++) {
+    const Entry& entry = entries[i];
+    terms.push_back(entry.term());
+    batch_size += entry.ByteSizeLong();
+    if (entry.optype() == Entry_OpType_kCommand) {
+      commands.push_back(&entry.command());
+    } else if (entry.optype() != Entry_OpType_kNoOp
+        && entry.optype() != Entry_OpType_kRead) {
+      // written by older version, which only knows the key value store
+      if (!KvStateMachine::EncodeLegacyEntry(entry, &legacy_commands[i])) {
+        LOGV(WARN_LEVEL, info_log_, "FloydApply::ApplyStateMachine: Unknown entry type %d at %lu",
+            entry.optype(), first_index + i);
+        bg_thread_.DelaySchedule(kApplyRetryMs, &ApplyStateMachineWrapper, this);  // try once more
+        return;
+      }
+      commands.push_back(&legacy_commands[i]);
+    }
+  }
+  if (!commands.empty()) {
+    Status s = state_machine_->ApplyBatch(last_index, commands);
     if (!s.ok()) {
-      LOGV(WARN_LEVEL, info_log_, "FloydApply::ApplyStateMachine: Apply log entry failed, at: %d, error: %s",
-          last_applied, s.ToString().c_str());
-      usleep(1000000);
-      ScheduleApply();  // try once more
+      LOGV(WARN_LEVEL, info_log_, "FloydApply::ApplyStateMachine: apply entries from %lu to %lu failed, error: %s",
+          first_index, last_index, s.ToString().c_str());
+      bg_thread_.DelaySchedule(kApplyRetryMs, &ApplyStateMachineWrapper, this);  // try once more
       return;
     }
   }
+  last_applied = last_index;
+  applied_count_ += entries.size();
+  applied_size_ += batch_size;
   context_->apply_mu.Lock();
   context_->last_applied = last_applied;
   raft_meta_->SetLastApplied(last_applied);
   context_->apply_mu.Unlock();
+  }
   context_->apply_cond.SignalAll();
+  FinishPendingCommands(first_index, terms);
+  {
+  slash::MutexLock l(&state_mu_);
+  MaybeSnapshot(last_applied, terms.back());
+  }
+  if (last_applied < commit_index) {
+    ScheduleApply();
+  }
+}
+
+void FloydApply::AddPendingCommand(uint64_t index, uint64_t term,
+                                   const std::function<void(const Status&)>& callback) {
+  {
+  slash::MutexLock l(&pending_mu_);
+  if (context_->last_applied < index) {
+    AddPending(index, true, term, callback);
+    return;
+  }
+  }
+  // applied already
+  Entry entry;
+  if (raft_log_->GetEntry(index, &entry) != 0 || entry.term() != term) {
+    callback(Status::IOError("entry is overwritten by new leader"));
+  } else {
+    callback(Status::OK());
+  }
+}
+
+void FloydApply::AddPendingRead(uint64_t index,
+                                const std::function<void(const Status&)>& callback) {
+  {
+  slash::MutexLock l(&pending_mu_);
+  if (context_->last_applied < index) {
+    AddPending(index, false, 0, callback);
+    return;
+  }
+  }
+  callback(Status::OK());
+}
+
+// how often pending_ is checked for expired commands
+static const uint64_t kPendingCheckMs = 100;
+
+void FloydApply::AddPending(uint64_t index, bool check_term, uint64_t term,
+                            const std::function<void(const Status&)>& callback) {
+  PendingCommand command;
+  command.check_term = check_term;
+  command.term = term;
+  command.deadline = slash::NowMicros() + context_->options.command_timeout_us;
+  command.callback = callback;
+  pending_.insert(std::make_pair(index, command));
+  if (!expire_scheduled_) {
+    expire_scheduled_ = true;
+    bg_thread_.DelaySchedule(kPendingCheckMs, &ExpirePendingCommandsWrapper, this);
+  }
+}
+
+void FloydApply::TruncatePendingCommands(uint64_t index) {
+  slash::MutexLock l(&pending_mu_);
+  auto iter = pending_.lower_bound(index);
+  while (iter != pending_.end()) {
+    if (iter->second.check_term) {
+      failed_.push_back(std::make_pair(iter->second.callback,
+            Status::IOError("entry is overwritten by new leader")));
+      iter = pending_.erase(iter);
+    } else {
+      iter++;
+    }
+  }
+  if (!failed_.empty()) {
+    bg_thread_.Schedule(&FailPendingCommandsWrapper, this);
+  }
+}
+
+void FloydApply::ExpirePendingCommandsWrapper(void* arg) {
+  reinterpret_cast<FloydApply*>(arg)->ExpirePendingCommands();
+}
+
+/*
+ * a command whose term is over may still be committed by the new leader,
+ * and one waiting too long may be applied later, both are failed with
+ * the result unknown
+ */
+void FloydApply::ExpirePendingCommands() {
+  uint64_t current_term;
+  {
+  slash::MutexLock l(&context_->global_mu);
+  current_term = context_->current_term;
+  }
+  uint64_t now = slash::NowMicros();
+  std::vector<std::pair<std::function<void(const Status&)>, Status> > expired;
+  {
+  slash::MutexLock l(&pending_mu_);
+  auto iter = pending_.begin();
+  while (iter != pending_.end()) {
+    if (iter->second.check_term && iter->second.term < current_term) {
+      expired.push_back(std::make_pair(iter->second.callback,
+            Status::Incomplete("leader changed, the command may still be applied")));
+    } else if (iter->second.deadline <= now) {
+      expired.push_back(std::make_pair(iter->second.callback,
+            Status::Timeout("command is not applied in time, it may still be applied")));
+    } else {
+      iter++;
+      continue;
+    }
+    iter = pending_.erase(iter);
+  }
+  expire_scheduled_ = !pending_.empty();
+  if (expire_scheduled_) {
+    bg_thread_.DelaySchedule(kPendingCheckMs, &ExpirePendingCommandsWrapper, this);
+  }
+  }
+  for (auto& command : expired) {
+    command.first(command.second);
+  }
+}
+
+void FloydApply::FailPendingCommandsWrapper(void* arg) {
+  reinterpret_cast<FloydApply*>(arg)->FailPendingCommands();
+}
+
+void FloydApply::FailPendingCommands() {
+  std::vector<std::pair<std::function<void(const Status&)>, Status> > failed;
+  {
+  slash::MutexLock l(&pending_mu_);
+  failed.swap(failed_);
+  }
+  for (auto& command : failed) {
+    command.first(command.second);
+  }
+}
+
+void FloydApply::FinishPendingCommands(uint64_t first_index, const std::vector<uint64_t>& terms) {
+  std::vector<std::pair<PendingCommand, bool> > finished;
+  {
+  slash::MutexLock l(&pending_mu_);
+  while (!pending_.empty() && pending_.begin()->first < first_index + terms.size()) {
+    uint64_t index = pending_.begin()->first;
+    // last_applied is updated before we lock pending_mu_, so commands
+    // applied in earlier rounds can't be added to pending_
+    bool match = !pending_.begin()->second.check_term
+      || (index >= first_index && terms[index - first_index] == pending_.begin()->second.term);
+    finished.push_back(std::make_pair(pending_.begin()->second, match));
+    pending_.erase(pending_.begin());
+  }
+  }
+  for (auto& command : finished) {
+    if (command.second) {
+      command.first.callback(Status::OK());
+    } else {
+      command.first.callback(Status::IOError("entry is overwritten by new leader"));
+    }
+  }
+}
+
+std::string FloydApply::SnapshotPath() {
+  return context_->options.path + "/snapshot";
+}
+
+void FloydApply::MaybeSnapshot(uint64_t last_applied, uint64_t last_applied_term) {
+  const Options& options = context_->options;
+  if ((options.snapshot_interval_count == 0 || applied_count_ < options.snapshot_interval_count)
+      && (options.snapshot_interval_size == 0 || applied_size_ < options.snapshot_interval_size)) {
+    return;
+  }
+  uint64_t prev_snapshot_index = snapshot_index_;
+  Status s = DoSnapshot(last_applied, last_applied_term);
+  if (s.IsIncomplete()) {
+    // the snapshot is being sent, try again after next apply
+    return;
+  }
+  applied_count_ = 0;
+  applied_size_ = 0;
+  if (!s.ok()) {
+    LOGV(WARN_LEVEL, info_log_, "FloydApply::MaybeSnapshot: snapshot at %lu failed, %s",
+        last_applied, s.ToString().c_str());
+    return;
+  }
+  /*
+   * keep the log after the previous snapshot, a follower lagging less than
+   * one snapshot interval still catches up from log
+   */
+  if (prev_snapshot_index > 0) {
+    raft_log_->TruncatePrefix(prev_snapshot_index);
+  }
 }
 
-Status FloydApply::Apply(const Entry& entry) {
-  rocksdb::Status ret;
-  switch (entry.optype()) {
-    case Entry_OpType_kWrite:
-      ret = db_->Put(rocksdb::WriteOptions(), entry.key(), entry.value());
-      LOGV(DEBUG_LEVEL, info_log_, "FloydApply::Apply %s, key(%s)",
-          ret.ToString().c_str(), entry.key().c_str());
-      break;
-    case Entry_OpType_kDelete:
-      ret = db_->Delete(rocksdb::WriteOptions(), entry.key());
-      break;
-    case Entry_OpType_kRead:
-      ret = rocksdb::Status::OK();
-      break;
-    default:
-      ret = rocksdb::Status::Corruption("Unknown entry type");
-  }
-  if (!ret.ok()) {
-    return Status::Corruption(ret.ToString());
+/*
+ * state machine is only updated in this thread, so the snapshot contains
+ * exactly the entries up to snapshot_index. The snapshot is written aside
+ * and replaces the previous one, unless that is being sent
+ */
+Status FloydApply::DoSnapshot(uint64_t snapshot_index, uint64_t snapshot_term) {
+  uint64_t start_time = slash::NowMicros();
+  std::string tmp_path = context_->options.path + "/snapshot.tmp";
+  slash::DeleteDirIfExist(tmp_path);
+  Status s = state_machine_->Snapshot(tmp_path);
+  if (s.ok()) {
+    s = WriteSnapshotMeta(tmp_path, snapshot_index, snapshot_term);
   }
+  if (!s.ok()) {
+    slash::DeleteDirIfExist(tmp_path);
+    return s;
+  }
+  {
+  slash::MutexLock l(&snapshot_mu_);
+  if (snapshot_refs_ > 0) {
+    slash::DeleteDirIfExist(tmp_path);
+    return Status::Incomplete("snapshot is in use");
+  }
+  s = ReplaceSnapshot(tmp_path);
+  if (!s.ok()) {
+    slash::DeleteDirIfExist(tmp_path);
+    return s;
+  }
+  raft_meta_->SetSnapshotIndex(snapshot_index);
+  raft_meta_->SetSnapshotTerm(snapshot_term);
+  }
+  snapshot_index_ = snapshot_index;
+  LOGV(INFO_LEVEL, info_log_, "FloydApply::DoSnapshot: snapshot at index %lu term %lu, takes %lu us",
+      snapshot_index, snapshot_term, slash::NowMicros() - start_time);
+  return Status::OK();
+}
+
+static void SyncDir(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    fsync(fd);
+    close(fd);
+  }
+}
+
+/*
+ * the previous snapshot is renamed aside before the new one takes its place,
+ * and deleted only after that, so a complete snapshot is always on disk
+ */
+Status FloydApply::ReplaceSnapshot(const std::string& path) {
+  std::string old_path = SnapshotPath() + ".old";
+  slash::DeleteDirIfExist(old_path);
+  if (slash::FileExists(SnapshotPath())
+      && slash::RenameFile(SnapshotPath(), old_path) != 0) {
+    return Status::IOError("rename previous snapshot failed", strerror(errno));
+  }
+  if (slash::RenameFile(path, SnapshotPath()) != 0) {
+    Status s = Status::IOError("rename snapshot failed", strerror(errno));
+    slash::RenameFile(old_path, SnapshotPath());
+    return s;
+  }
+  SyncDir(context_->options.path);
+  slash::DeleteDirIfExist(old_path);
+  return Status::OK();
+}
+
+bool FloydApply::AcquireSnapshot(uint64_t* snapshot_index, uint64_t* snapshot_term) {
+  slash::MutexLock l(&snapshot_mu_);
+  if (!ReadSnapshotMeta(SnapshotPath(), snapshot_index, snapshot_term).ok()) {
+    // taken by older version
+    *snapshot_index = raft_meta_->GetSnapshotIndex();
+    *snapshot_term = raft_meta_->GetSnapshotTerm();
+  }
+  if (*snapshot_index == 0 || !slash::FileExists(SnapshotPath())) {
+    return false;
+  }
+  snapshot_refs_++;
+  return true;
+}
+
+void FloydApply::ReleaseSnapshot() {
+  slash::MutexLock l(&snapshot_mu_);
+  snapshot_refs_--;
+}
+
+static Status WriteAll(int fd, const std::string& data) {
+  size_t done = 0;
+  while (done < data.size()) {
+    ssize_t n = write(fd, data.data() + done, data.size() - done);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return Status::IOError("write snapshot file failed", strerror(errno));
+    }
+    done += n;
+  }
+  return Status::OK();
+}
+
+static const char* kSnapshotMetaFile = "/FLOYD_SNAPSHOT";
+
+Status FloydApply::WriteSnapshotMeta(const std::string& path,
+                                     uint64_t snapshot_index, uint64_t snapshot_term) {
+  std::string file = path + kSnapshotMetaFile;
+  int fd = open(file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    return Status::IOError("open " + file + " failed", strerror(errno));
+  }
+  Status s = WriteAll(fd, std::to_string(snapshot_index) + " " + std::to_string(snapshot_term) + "\n");
+  if (s.ok() && fdatasync(fd) != 0) {
+    s = Status::IOError("sync " + file + " failed", strerror(errno));
+  }
+  close(fd);
+  return s;
+}
+
+Status FloydApply::ReadSnapshotMeta(const std::string& path,
+                                    uint64_t* snapshot_index, uint64_t* snapshot_term) {
+  std::string file = path + kSnapshotMetaFile;
+  FILE* fp = fopen(file.c_str(), "r");
+  if (fp == NULL) {
+    return Status::NotFound("open " + file + " failed", strerror(errno));
+  }
+  unsigned long long index, term;
+  int n = fscanf(fp, "%llu %llu", &index, &term);
+  fclose(fp);
+  if (n != 2) {
+    return Status::Corruption("invalid " + file);
+  }
+  *snapshot_index = index;
+  *snapshot_term = term;
+  return Status::OK();
+}
+
+Status FloydApply::CloseRecvFile() {
+  if (recv_fd_ < 0) {
+    return Status::OK();
+  }
+  int ret = fdatasync(recv_fd_);
+  close(recv_fd_);
+  recv_fd_ = -1;
+  if (ret != 0) {
+    return Status::IOError("sync snapshot file " + recv_file_ + " failed", strerror(errno));
+  }
+  return Status::OK();
+}
+
+/*
+ * the files are written under path/snapshot.recv/ as they arrive, and
+ * restored to state machine after the last chunk
+ */
+Status FloydApply::ReceiveSnapshot(const CmdRequest_InstallSnapshot& chunk) {
+  std::string recv_path = context_->options.path + "/snapshot.recv";
+  slash::MutexLock l(&recv_mu_);
+  if (installing_) {
+    return Status::Incomplete("the previous snapshot is being installed");
+  }
+  if (chunk.offset() == 0) {
+    CloseRecvFile();
+    slash::DeleteDirIfExist(recv_path);
+    if (slash::CreatePath(recv_path) != 0) {
+      return Status::IOError("create " + recv_path + " failed", strerror(errno));
+    }
+    recv_index_ = chunk.last_included_index();
+    recv_term_ = chunk.last_included_term();
+    recv_count_ = 0;
+    LOGV(INFO_LEVEL, info_log_, "FloydApply::ReceiveSnapshot: begin to receive snapshot at index %lu term %lu",
+        recv_index_, recv_term_);
+  } else if (chunk.offset() != recv_count_ || chunk.last_included_index() != recv_index_
+      || chunk.last_included_term() != recv_term_) {
+    return Status::Incomplete("snapshot chunk out of order");
+  }
+
+  if (chunk.has_file_name()) {
+    if (recv_fd_ < 0 || chunk.file_name() != recv_file_) {
+      Status s = CloseRecvFile();
+      if (!s.ok()) {
+        return s;
+      }
+      if (chunk.file_name().empty() || chunk.file_name().find('/') != std::string::npos) {
+        return Status::Corruption("invalid snapshot file name " + chunk.file_name());
+      }
+      recv_file_ = chunk.file_name();
+      recv_fd_ = open((recv_path + "/" + recv_file_).c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (recv_fd_ < 0) {
+        return Status::IOError("open snapshot file " + recv_file_ + " failed", strerror(errno));
+      }
+    }
+    Status s = WriteAll(recv_fd_, chunk.data());
+    if (!s.ok()) {
+      return s;
+    }
+  }
+  recv_count_ += chunk.data().size();
+  if (!chunk.done()) {
+    return Status::OK();
+  }
+
+  Status s = CloseRecvFile();
+  if (!s.ok()) {
+    return s;
+  }
+  LOGV(INFO_LEVEL, info_log_, "FloydApply::ReceiveSnapshot: received %lu bytes of snapshot at index %lu",
+      recv_count_, recv_index_);
+  installing_ = true;
+  bg_thread_.Schedule(&InstallSnapshotWrapper, this);
+  return Status::OK();
+}
+
+void FloydApply::InstallSnapshotWrapper(void* arg) {
+  reinterpret_cast<FloydApply*>(arg)->InstallSnapshot();
+}
+
+/*
+ * restoring may take long, it runs in the apply thread instead of holding
+ * global_mu in the rpc thread. recv_index_ and recv_term_ are not changed
+ * until installing_ is cleared
+ */
+void FloydApply::InstallSnapshot() {
+  std::string recv_path = context_->options.path + "/snapshot.recv";
+  Status s = DoInstallSnapshot(recv_path, recv_index_, recv_term_);
+  if (!s.ok()) {
+    LOGV(WARN_LEVEL, info_log_, "FloydApply::InstallSnapshot: install snapshot at index %lu failed, %s",
+        recv_index_, s.ToString().c_str());
+    slash::DeleteDirIfExist(recv_path);
+  }
+  slash::MutexLock l(&recv_mu_);
+  installing_ = false;
+}
+
+Status FloydApply::DoInstallSnapshot(const std::string& path,
+                                     uint64_t snapshot_index, uint64_t snapshot_term) {
+  slash::MutexLock l(&state_mu_);
+  if (snapshot_index <= context_->last_applied) {
+    LOGV(INFO_LEVEL, info_log_, "FloydApply::DoInstallSnapshot: snapshot index %lu is not after last_applied %lu",
+        snapshot_index, context_->last_applied.load());
+    slash::DeleteDirIfExist(path);
+    return Status::OK();
+  }
+  Status s = state_machine_->Restore(path);
+  if (!s.ok()) {
+    return Status::Corruption("install snapshot failed, " + s.ToString());
+  }
+
+  // the received snapshot becomes my own before the log before it is
+  // deleted, and in case I become leader
+  {
+  slash::MutexLock sl(&snapshot_mu_);
+  if (snapshot_refs_ == 0) {
+    s = WriteSnapshotMeta(path, snapshot_index, snapshot_term);
+    if (s.ok()) {
+      s = ReplaceSnapshot(path);
+    }
+    if (s.ok()) {
+      raft_meta_->SetSnapshotIndex(snapshot_index);
+      raft_meta_->SetSnapshotTerm(snapshot_term);
+      snapshot_index_ = snapshot_index;
+    } else {
+      LOGV(WARN_LEVEL, info_log_, "FloydApply::DoInstallSnapshot: keep snapshot at %lu failed, %s",
+          snapshot_index, s.ToString().c_str());
+    }
+  }
+  }
+
+  {
+  // the log is changed by AppendEntries with global_mu held
+  slash::MutexLock gl(&context_->global_mu);
+  if (raft_log_->InstallSnapshot(snapshot_index, snapshot_term) != 0) {
+    return Status::IOError("reset log to snapshot failed");
+  }
+  if (context_->commit_index < snapshot_index) {
+    context_->commit_index = snapshot_index;
+    raft_meta_->SetCommitIndex(snapshot_index);
+  }
+  }
+  context_->apply_mu.Lock();
+  context_->last_applied = snapshot_index;
+  raft_meta_->SetLastApplied(snapshot_index);
+  context_->apply_mu.Unlock();
+  context_->apply_cond.SignalAll();
+
+  applied_count_ = 0;
+  applied_size_ = 0;
+  slash::DeleteDirIfExist(path);
+  LOGV(INFO_LEVEL, info_log_, "FloydApply::DoInstallSnapshot: installed snapshot at index %lu term %lu",
+      snapshot_index, snapshot_term);
   return Status::OK();
-  /* TODO wangkang-xy
-  // case CmdRequest::ReadAll:
-  // case CmdRequest::TryLock:
-  // case CmdRequest::UnLock:
-  // case CmdRequest::DeleteUser:
-  */
 }
 
 } // namespace floyd
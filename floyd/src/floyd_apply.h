@@ -6,9 +6,16 @@
 #ifndef FLOYD_SRC_FLOYD_APPLY_H_
 #define FLOYD_SRC_FLOYD_APPLY_H_
 
+#include <map>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "floyd/include/floyd_state_machine.h"
 #include "floyd/src/floyd_context.h"
 
 #include "slash/include/slash_status.h"
+#include "slash/include/slash_mutex.h"
 #include "pink/include/bg_thread.h"
 
 namespace floyd {
@@ -18,25 +25,113 @@ using slash::Status;
 class RaftMeta;
 class RaftLog;
 class Logger;
+class CmdRequest_InstallSnapshot;
 
 class FloydApply  {
  public:
-  FloydApply(FloydContext* context, rocksdb::DB* db, RaftMeta* raft_meta, RaftLog* raft_log, Logger* info_log);
+  FloydApply(FloydContext* context, StateMachine* state_machine, RaftMeta* raft_meta,
+             RaftLog* raft_log, Logger* info_log);
   ~FloydApply();
   int Start();
   int Stop();
   void ScheduleApply();
+  // decide where to continue applying, a volatile state machine is brought
+  // back to the latest snapshot. called before Start
+  Status RecoverStateMachine();
+
+  // callback will be invoked after the entry at index is applied,
+  // with error if it is not the entry of term we appended, if the term
+  // changes, or after command_timeout_us
+  void AddPendingCommand(uint64_t index, uint64_t term,
+                         const std::function<void(const Status&)>& callback);
+  // callback will be invoked after the entry at index is applied,
+  // or after command_timeout_us
+  void AddPendingRead(uint64_t index, const std::function<void(const Status&)>& callback);
+  // the entries from index are removed from log, fail the commands waiting
+  // for them. callbacks are invoked by the apply thread
+  void TruncatePendingCommands(uint64_t index);
+
+  // directory of the latest snapshot
+  std::string SnapshotPath();
+  // hold the snapshot at SnapshotPath() from being replaced while it is sent,
+  // return false if there is no snapshot
+  bool AcquireSnapshot(uint64_t* snapshot_index, uint64_t* snapshot_term);
+  void ReleaseSnapshot();
+  // follower receives a chunk of snapshot from leader, the snapshot is
+  // installed by the apply thread after the last chunk, and chunks are
+  // refused until that finishes
+  Status ReceiveSnapshot(const CmdRequest_InstallSnapshot& chunk);
 
  private:
+  struct PendingCommand {
+    bool check_term;
+    uint64_t term;
+    uint64_t deadline;
+    std::function<void(const Status&)> callback;
+  };
+
   pink::BGThread bg_thread_;
   FloydContext* context_;
-  rocksdb::DB* db_;
+  StateMachine* state_machine_;
   RaftMeta* raft_meta_;
   RaftLog* raft_log_;
   Logger* info_log_;
+  // protect pending_, log index -> command waiting to be applied
+  slash::Mutex pending_mu_;
+  std::multimap<uint64_t, PendingCommand> pending_;
+  // removed from pending_ and waiting for the apply thread to fail them
+  std::vector<std::pair<std::function<void(const Status&)>, Status> > failed_;
+  // a timer task checks pending_ while it is not empty
+  bool expire_scheduled_;
+
+  // serialize applying entries and installing snapshot
+  slash::Mutex state_mu_;
+  // protect snapshot_refs_ and the snapshot directory
+  slash::Mutex snapshot_mu_;
+  int snapshot_refs_;
+
+  // protected by state_mu_
+  uint64_t snapshot_index_;
+  // entries and bytes applied since the latest snapshot
+  uint64_t applied_count_;
+  uint64_t applied_size_;
+
+  // protect the snapshot being received and installing_
+  slash::Mutex recv_mu_;
+  int recv_fd_;
+  std::string recv_file_;
+  uint64_t recv_index_;
+  uint64_t recv_term_;
+  uint64_t recv_count_;
+  // the received snapshot is waiting to be installed
+  bool installing_;
+
   static void ApplyStateMachineWrapper(void* arg);
   void ApplyStateMachine();
-  Status Apply(const Entry& log_entry);
+  void FinishPendingCommands(uint64_t first_index, const std::vector<uint64_t>& terms);
+  // called with pending_mu_ held
+  void AddPending(uint64_t index, bool check_term, uint64_t term,
+                  const std::function<void(const Status&)>& callback);
+  static void ExpirePendingCommandsWrapper(void* arg);
+  void ExpirePendingCommands();
+  static void FailPendingCommandsWrapper(void* arg);
+  void FailPendingCommands();
+  void MaybeSnapshot(uint64_t last_applied, uint64_t last_applied_term);
+  Status DoSnapshot(uint64_t snapshot_index, uint64_t snapshot_term);
+  // move the snapshot under path to SnapshotPath(), called with snapshot_mu_ held
+  Status ReplaceSnapshot(const std::string& path);
+  // index and term of a snapshot are kept in a file under its directory,
+  // so they are replaced together with the snapshot
+  static Status WriteSnapshotMeta(const std::string& path,
+                                  uint64_t snapshot_index, uint64_t snapshot_term);
+  static Status ReadSnapshotMeta(const std::string& path,
+                                 uint64_t* snapshot_index, uint64_t* snapshot_term);
+  Status CloseRecvFile();
+  static void InstallSnapshotWrapper(void* arg);
+  void InstallSnapshot();
+  // restore state machine from the snapshot under path, then reset the log
+  Status DoInstallSnapshot(const std::string& path,
+                           uint64_t snapshot_index, uint64_t snapshot_term);
 };
 
 }  // namespace floyd
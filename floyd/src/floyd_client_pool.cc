@@ -9,6 +9,7 @@
 #include "floyd/src/logger.h"
 #include "floyd/include/floyd_options.h"
 
+#include "slash/include/env.h"
 #include "slash/include/slash_string.h"
 
 namespace floyd {
@@ -32,6 +33,10 @@ static std::string CmdType(const CmdRequest& cmd) {
       ret = "Delete";
       break;
     }
+    case Type::kWriteBatch: {
+      ret = "WriteBatch";
+      break;
+    }
     case Type::kRequestVote: {
       ret = "RequestVote";
       break;
@@ -44,6 +49,22 @@ static std::string CmdType(const CmdRequest& cmd) {
       ret = "ServerStatus";
       break;
     }
+    case Type::kReadIndex: {
+      ret = "ReadIndex";
+      break;
+    }
+    case Type::kInstallSnapshot: {
+      ret = "InstallSnapshot";
+      break;
+    }
+    case Type::kCommand: {
+      ret = "Command";
+      break;
+    }
+    case Type::kForwardBatch: {
+      ret = "ForwardBatch";
+      break;
+    }
     default:
       ret = "UnknownCmd";
   }
@@ -51,10 +72,12 @@ static std::string CmdType(const CmdRequest& cmd) {
 }
 
 
-ClientPool::ClientPool(Logger* info_log, int timeout_ms, int retry)
+ClientPool::ClientPool(Logger* info_log, int timeout_ms, int retry, int max_conns)
   : info_log_(info_log),
     timeout_ms_(timeout_ms),
-    retry_(retry) {
+    retry_(retry),
+    max_conns_(max_conns < 1 ? 1 : max_conns),
+    idle_cv_(&mu_) {
 }
 
 Status ClientPool::SendAndRecv(const std::string& server, const CmdRequest& req, CmdResponse* res) {
@@ -69,10 +92,22 @@ Status ClientPool::SendAndRecv(const std::string& server, const CmdRequest& req,
    */
   LOGV(DEBUG_LEVEL, info_log_, "ClientPool::SendAndRecv Send %s command to server %s", CmdType(req).c_str(), server.c_str());
   Client *client = GetClient(server);
+  if (client == NULL) {
+    LOGV(WARN_LEVEL, info_log_, "ClientPool::SendAndRecv no idle connection to %s in %d ms,"
+        " Request type %s", server.c_str(), timeout_ms_, CmdType(req).c_str());
+    return Status::Timeout("no idle connection to " + server);
+  }
+  Status ret = SendAndRecv(client, server, req, res);
+  ReleaseClient(server, client);
+  return ret;
+}
+
+// client is taken by the caller alone
+Status ClientPool::SendAndRecv(Client* client, const std::string& server,
+                               const CmdRequest& req, CmdResponse* res) {
   pink::PinkCli* cli = client->cli;
 
   Status ret = Status::Incomplete("Not send");
-  slash::MutexLock l(&client->mu);
   ret = UpHoldCli(client);
   if (!ret.ok()) {
     if (req.type() == kAppendEntries) {
@@ -126,24 +161,41 @@ Status ClientPool::SendAndRecv(const std::string& server, const CmdRequest& req,
 ClientPool::~ClientPool() {
   slash::MutexLock l(&mu_);
   for (auto& iter : client_map_) {
-    delete iter.second;
+    for (auto client : iter.second.all) {
+      delete client;
+    }
   }
   LOGV(DEBUG_LEVEL, info_log_, "ClientPool dtor");
 }
 
 Client* ClientPool::GetClient(const std::string& server) {
+  uint64_t deadline = slash::NowMicros() + timeout_ms_ * 1000LL;
   slash::MutexLock l(&mu_);
-  auto iter = client_map_.find(server);
-  if (iter == client_map_.end()) {
-    std::string ip;
-    int port;
-    slash::ParseIpPortString(server, ip, port);
-    Client* client = new Client(ip, port);
-    client_map_[server] = client;
-    return client;
-  } else {
-    return iter->second;
+  ServerClients& clients = client_map_[server];
+  while (clients.idle.empty()) {
+    if (clients.all.size() < static_cast<size_t>(max_conns_)) {
+      std::string ip;
+      int port;
+      slash::ParseIpPortString(server, ip, port);
+      Client* client = new Client(ip, port);
+      clients.all.push_back(client);
+      return client;
+    }
+    uint64_t now = slash::NowMicros();
+    if (now >= deadline) {
+      return NULL;
+    }
+    idle_cv_.TimedWait((deadline - now) / 1000 + 1);
   }
+  Client* client = clients.idle.back();
+  clients.idle.pop_back();
+  return client;
+}
+
+void ClientPool::ReleaseClient(const std::string& server, Client* client) {
+  slash::MutexLock l(&mu_);
+  client_map_[server].idle.push_back(client);
+  idle_cv_.SignalAll();
 }
 
 Status ClientPool::UpHoldCli(Client *client) {
@@ -24,15 +24,26 @@ class Logger;
 
 struct Client {
   pink::PinkCli* cli;
-  slash::Mutex mu;
 
   Client(const std::string& ip, int port) {
     cli = pink::NewPbCli(ip, port);
   }
+
+  ~Client() {
+    cli->Close();
+    delete cli;
+  }
 };
+/*
+ * ClientPool keeps up to max_conns connections to each server, a request
+ * takes an idle one or opens a new one, so the requests to the same server
+ * are sent concurrently. It waits up to timeout_ms for a connection to
+ * become idle once max_conns are busy
+ */
 class ClientPool {
  public:
-  explicit ClientPool(Logger* info_log_, int timeout_ms = 2000, int retry = 0);
+  explicit ClientPool(Logger* info_log_, int timeout_ms = 2000, int retry = 0,
+                      int max_conns = 1);
   ~ClientPool();
 
   // Each try consists of Connect, Send and Recv;
@@ -42,13 +53,25 @@ class ClientPool {
   Status UpHoldCli(Client* client);
 
  private:
+  struct ServerClients {
+    std::vector<Client*> all;
+    std::vector<Client*> idle;
+  };
+
   Logger* info_log_;
   int timeout_ms_;
   int retry_;
+  int max_conns_;
   slash::Mutex mu_;
-  std::map<std::string, Client*> client_map_;
+  // signaled when a client is put back
+  slash::CondVar idle_cv_;
+  std::map<std::string, ServerClients> client_map_;
 
+  Status SendAndRecv(Client* client, const std::string& server,
+                     const CmdRequest& req, CmdResponse* res);
+  // return NULL if none becomes idle in timeout_ms_
   Client* GetClient(const std::string& server);
+  void ReleaseClient(const std::string& server, Client* client);
 
   ClientPool(const ClientPool&);
   bool operator=(const ClientPool&);
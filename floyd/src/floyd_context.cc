@@ -54,4 +54,10 @@ void FloydContext::BecomeLeader() {
   leader_ip = options.local_ip;
   leader_port = options.local_port;
 }
+
+void FloydContext::StepDown() {
+  role = Role::kFollower;
+  leader_ip.clear();
+  leader_port = 0;
+}
 }  // namespace floyd
@@ -41,6 +41,9 @@ struct FloydContext {
       commit_index(0),
       last_applied(0),
       last_op_time(0),
+      leader_op_time(0),
+      term_start_index(0),
+      read_round(0),
       apply_cond(&apply_mu) {}
 
   void RecoverInit(RaftMeta *raft);
@@ -48,6 +51,8 @@ struct FloydContext {
       const std::string leader_ip = "", int port = 0);
   void BecomeCandidate();
   void BecomeLeader();
+  // leader gives up leadership in current term, keeping the vote
+  void StepDown();
 
   Options options;
   // Role related
@@ -63,6 +68,15 @@ struct FloydContext {
   uint64_t commit_index;
   std::atomic<uint64_t> last_applied;
   uint64_t last_op_time;
+  // last time a living leader contacted me, used to refuse votes in lease mode
+  uint64_t leader_op_time;
+
+  // index of the first entry appended in leader's term, read index can't
+  // be served before it is committed
+  uint64_t term_start_index;
+  // bumped every time leader sends AppendEntries, a read is confirmed by
+  // the acknowledgement of a round started after the read
+  uint64_t read_round;
 
   // mutex protect commit_index
   // used in floyd_apply thread and floyd_peer thread
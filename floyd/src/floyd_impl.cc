@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 #include <algorithm>
+#include <memory>
 
 #include "pink/include/bg_thread.h"
 #include "slash/include/env.h"
@@ -20,29 +21,59 @@
 #include "floyd/src/floyd_apply.h"
 #include "floyd/src/floyd_worker.h"
 #include "floyd/src/raft_log.h"
+#include "floyd/src/file_log.h"
 #include "floyd/src/floyd_peer_thread.h"
 #include "floyd/src/floyd_primary_thread.h"
 #include "floyd/src/floyd_client_pool.h"
 #include "floyd/src/logger.h"
 #include "floyd/src/floyd.pb.h"
 #include "floyd/src/raft_meta.h"
+#include "floyd/src/kv_state_machine.h"
 
 namespace floyd {
 
+// a thread forwarding commands to leader, one batch in flight
+struct ForwardCmdThread {
+  FloydImpl* floyd;
+  pink::BGThread thread;
+
+  explicit ForwardCmdThread(FloydImpl* f)
+    : floyd(f) {}
+};
+
 FloydImpl::FloydImpl(const Options& options)
-  : db_(NULL),
+  : kv_(NULL),
+    state_machine_(NULL),
     log_and_meta_(NULL),
+    meta_cf_(NULL),
+    log_cf_(NULL),
     options_(options),
-    info_log_(NULL) {
+    info_log_(NULL),
+    consensus_worker_(NULL),
+    read_index_forwarding_(false) {
 }
 
 FloydImpl::~FloydImpl() {
   // worker will use floyd, delete worker first
   worker_->Stop();
+  if (consensus_worker_ != NULL) {
+    consensus_worker_->Stop();
+  }
+  forward_thread_.StopThread();
+  for (auto thread : forward_cmd_threads_) {
+    thread->thread.StopThread();
+  }
+  commit_thread_.StopThread();
+  raft_log_->set_durable_callback(nullptr);
   primary_->Stop();
   apply_->Stop();
   delete worker_;
+  delete consensus_worker_;
+  for (auto thread : forward_cmd_threads_) {
+    delete thread;
+  }
   delete worker_client_pool_;
+  delete peer_client_pool_;
   delete primary_;
   delete apply_;
   for (auto& pt : peers_) {
@@ -53,10 +84,97 @@ FloydImpl::~FloydImpl() {
   delete raft_meta_;
   delete raft_log_;
   delete info_log_;
-  delete db_;
+  delete kv_;
+  delete meta_cf_;
+  delete log_cf_;
   delete log_and_meta_;
 }
 
+static const std::string kMetaColumnFamily = "meta";
+static const std::string kLogColumnFamily = "log";
+
+// keys moved from default column family in one batch, bounded by bytes
+static const uint64_t kMoveBatchCount = 4096;
+static const uint64_t kMoveBatchSize = 4 * 1024 * 1024;
+
+/*
+ * meta column family is small and updated frequently, log column family
+ * takes the sequential appended entries with large memtable and files.
+ * the data directory written by older version keeps both in default column
+ * family, they are moved to their own column family when opened
+ */
+Status FloydImpl::OpenLogAndMeta() {
+  rocksdb::DBOptions db_options;
+  db_options.create_if_missing = true;
+  db_options.create_missing_column_families = true;
+  db_options.max_background_flushes = 8;
+
+  rocksdb::ColumnFamilyOptions meta_options;
+  meta_options.write_buffer_size = 4 * 1024 * 1024;
+  meta_options.max_write_buffer_number = 2;
+
+  rocksdb::ColumnFamilyOptions log_options;
+  log_options.write_buffer_size = 1024 * 1024 * 1024;
+  log_options.max_write_buffer_number = 4;
+  log_options.target_file_size_base = 256 * 1024 * 1024;
+  log_options.level0_file_num_compaction_trigger = 8;
+
+  std::vector<rocksdb::ColumnFamilyDescriptor> column_families;
+  column_families.push_back(rocksdb::ColumnFamilyDescriptor(
+        rocksdb::kDefaultColumnFamilyName, rocksdb::ColumnFamilyOptions()));
+  column_families.push_back(rocksdb::ColumnFamilyDescriptor(kMetaColumnFamily, meta_options));
+  column_families.push_back(rocksdb::ColumnFamilyDescriptor(kLogColumnFamily, log_options));
+  std::vector<rocksdb::ColumnFamilyHandle*> handles;
+  rocksdb::Status s = rocksdb::DB::Open(db_options, options_.path + "/log/",
+      column_families, &handles, &log_and_meta_);
+  if (!s.ok()) {
+    return Status::Corruption("Open DB log_and_meta failed, " + s.ToString());
+  }
+  rocksdb::ColumnFamilyHandle* default_cf = handles[0];
+  meta_cf_ = handles[1];
+  log_cf_ = handles[2];
+
+  // move the entries and meta data of older version, log keys are 8 bytes.
+  // Each batch puts and deletes the same keys, so a restart continues with
+  // the keys left in default column family
+  rocksdb::WriteOptions write_options;
+  write_options.sync = true;
+  rocksdb::WriteBatch wb;
+  uint64_t moved = 0;
+  rocksdb::Iterator* it = log_and_meta_->NewIterator(rocksdb::ReadOptions(), default_cf);
+  for (it->SeekToFirst(); s.ok() && it->Valid(); it->Next()) {
+    if (it->key().size() == sizeof(uint64_t)) {
+      wb.Put(log_cf_, it->key(), it->value());
+    } else {
+      wb.Put(meta_cf_, it->key(), it->value());
+    }
+    wb.Delete(default_cf, it->key());
+    if (static_cast<uint64_t>(wb.Count()) >= kMoveBatchCount * 2
+        || wb.GetDataSize() >= kMoveBatchSize) {
+      moved += wb.Count() / 2;
+      s = log_and_meta_->Write(write_options, &wb);
+      wb.Clear();
+    }
+  }
+  if (s.ok() && !it->status().ok()) {
+    s = it->status();
+  }
+  delete it;
+  if (s.ok() && wb.Count() > 0) {
+    moved += wb.Count() / 2;
+    s = log_and_meta_->Write(write_options, &wb);
+  }
+  if (moved > 0) {
+    LOGV(INFO_LEVEL, info_log_, "FloydImpl::OpenLogAndMeta move %lu keys from default column family, %s",
+         moved, s.ToString().c_str());
+  }
+  delete default_cf;
+  if (!s.ok()) {
+    return Status::Corruption("Move log and meta to column families failed, " + s.ToString());
+  }
+  return Status::OK();
+}
+
 bool FloydImpl::IsSelf(const std::string& ip_port) {
   return (ip_port == slash::IpPortString(options_.local_ip, options_.local_port));
 }
@@ -110,47 +228,78 @@ Status FloydImpl::Init() {
   }
 
   // TODO(anan) set timeout and retry
-  worker_client_pool_ = new ClientPool(info_log_);
-
-  // Create DB
-  rocksdb::Options options;
-  options.create_if_missing = true;
-  // options.disableDataSync = true;
-  options.write_buffer_size = 1024 * 1024 * 1024;
-  options.max_background_flushes = 8;
-  rocksdb::Status s = rocksdb::DB::Open(options, options_.path + "/db/", &db_);
-  if (!s.ok()) {
-    LOGV(ERROR_LEVEL, info_log_, "Open db failed! path: %s", options_.path.c_str());
-    return Status::Corruption("Open DB failed, " + s.ToString());
+  worker_client_pool_ = new ClientPool(info_log_, 2000, 0, options_.max_conns_per_member);
+  peer_client_pool_ = new ClientPool(info_log_, 2000, 0, options_.max_conns_per_member);
+
+  // Create state machine
+  if (options_.state_machine == NULL) {
+    kv_ = new KvStateMachine(options_.path + "/db", options_.disable_kv_wal, info_log_);
+    Status s = kv_->Open();
+    if (!s.ok()) {
+      LOGV(ERROR_LEVEL, info_log_, "Open db failed! path: %s", options_.path.c_str());
+      return s;
+    }
+    state_machine_ = kv_;
+  } else {
+    state_machine_ = options_.state_machine;
   }
 
-  s = rocksdb::DB::Open(options, options_.path + "/log/", &log_and_meta_);
-  if (!s.ok()) {
+  Status open_status = OpenLogAndMeta();
+  if (!open_status.ok()) {
     LOGV(ERROR_LEVEL, info_log_, "Open DB log_and_meta failed! path: %s", options_.path.c_str());
-    return Status::Corruption("Open DB log_and_meta failed, " + s.ToString());
+    return open_status;
   }
 
   // Recover Context
-  raft_log_ = new RaftLog(log_and_meta_, info_log_);
-  raft_meta_ = new RaftMeta(log_and_meta_, info_log_);
+  if (options_.use_file_log) {
+    FileLog* file_log = new FileLog(options_.path + "/filelog/",
+        options_.file_log_segment_size, info_log_);
+    open_status = file_log->Open();
+    if (!open_status.ok()) {
+      delete file_log;
+      LOGV(ERROR_LEVEL, info_log_, "Open file log failed! path: %s", options_.path.c_str());
+      return Status::Corruption("Open file log failed, " + open_status.ToString());
+    }
+    raft_log_ = new RaftLog(file_log, info_log_, options_.log_cache_size,
+        options_.log_sync_mode);
+  } else {
+    raft_log_ = new RaftLog(new RocksdbLogStorage(log_and_meta_, log_cf_, info_log_),
+        info_log_, options_.log_cache_size, options_.log_sync_mode);
+  }
+  raft_meta_ = new RaftMeta(log_and_meta_, meta_cf_, info_log_);
   raft_meta_->Init();
+  raft_log_->SetSnapshot(raft_meta_->GetSnapshotIndex(), raft_meta_->GetSnapshotTerm());
   context_ = new FloydContext(options_);
   context_->RecoverInit(raft_meta_);
 
   // Create Apply threads
-  apply_ = new FloydApply(context_, db_, raft_meta_, raft_log_, info_log_);
+  apply_ = new FloydApply(context_, state_machine_, raft_meta_, raft_log_, info_log_);
+  open_status = apply_->RecoverStateMachine();
+  if (!open_status.ok()) {
+    LOGV(ERROR_LEVEL, info_log_, "Recover state machine failed, %s", open_status.ToString().c_str());
+    return open_status;
+  }
   apply_->Start();
 
   // peers and primary refer to each other
   // Create PrimaryThread before Peers
-  primary_ = new FloydPrimary(context_, raft_meta_, options_, info_log_);
+  primary_ = new FloydPrimary(context_, raft_meta_, raft_log_, apply_, options_, info_log_);
+  if (options_.log_sync_mode == kSyncGroup) {
+    FloydPrimary* primary = primary_;
+    raft_log_->set_durable_callback([primary](uint64_t index) {
+      primary->AddTask(kLogDurable);
+    });
+  }
+  primary_->set_noop_callback([this](uint64_t term) {
+    AppendNoOpEntry(term);
+  });
 
   // Create peer threads
   // peers_.clear();
   for (auto iter = options_.members.begin(); iter != options_.members.end(); iter++) {
     if (!IsSelf(*iter)) {
       Peer* pt = new Peer(*iter, context_, primary_, raft_meta_, raft_log_,
-          worker_client_pool_, apply_, options_, info_log_);
+          peer_client_pool_, apply_, options_, info_log_);
       peers_.insert(std::pair<std::string, Peer*>(*iter, pt));
     }
   }
@@ -167,12 +316,46 @@ Status FloydImpl::Init() {
   }
   LOGV(INFO_LEVEL, info_log_, "Floyd start %d peer thread", peers_.size());
 
+  commit_thread_.set_thread_name("FloydCommit");
+  if ((ret = commit_thread_.StartThread()) != 0) {
+    LOGV(ERROR_LEVEL, info_log_, "FloydImpl commit thread failed to start, ret is %d", ret);
+    return Status::Corruption("failed to start commit thread, return " + std::to_string(ret));
+  }
+  forward_thread_.set_thread_name("FloydForward");
+  if ((ret = forward_thread_.StartThread()) != 0) {
+    LOGV(ERROR_LEVEL, info_log_, "FloydImpl forward thread failed to start, ret is %d", ret);
+    return Status::Corruption("failed to start forward thread, return " + std::to_string(ret));
+  }
+  for (int i = 0; i < std::max(options_.max_conns_per_member, 1); i++) {
+    ForwardCmdThread* thread = new ForwardCmdThread(this);
+    forward_cmd_threads_.push_back(thread);
+    thread->thread.set_thread_name("FloydForwardCmd");
+    if ((ret = thread->thread.StartThread()) != 0) {
+      LOGV(ERROR_LEVEL, info_log_, "FloydImpl forward command thread failed to start, ret is %d", ret);
+      return Status::Corruption("failed to start forward command thread, return " + std::to_string(ret));
+    }
+    idle_forward_cmd_threads_.push_back(thread);
+  }
+
   // Start worker thread after Peers, because WorkerHandle will check peers
-  worker_ = new FloydWorker(options_.local_port, 1000, this);
+  worker_ = new FloydWorker(options_.local_port, options_.worker_thread_num, 1000,
+      options_.worker_queue_limit, this);
   if ((ret = worker_->Start()) != 0) {
     LOGV(ERROR_LEVEL, info_log_, "FloydImpl worker thread failed to start, ret is %d", ret);
     return Status::Corruption("failed to start worker, return " + std::to_string(ret));
   }
+  if (options_.consensus_port_offset > 0) {
+    // a thread for the connection of each peer, so one waiting for its
+    // entries to be durable or writing a snapshot chunk delays no other
+    int consensus_thread_num = std::max(static_cast<int>(options_.members.size()) - 1, 1);
+    consensus_worker_ = new FloydWorker(
+        options_.local_port + options_.consensus_port_offset, consensus_thread_num, 1000,
+        options_.worker_queue_limit, this, true);
+    if ((ret = consensus_worker_->Start()) != 0) {
+      LOGV(ERROR_LEVEL, info_log_, "FloydImpl consensus worker failed to start, ret is %d", ret);
+      return Status::Corruption("failed to start consensus worker, return " + std::to_string(ret));
+    }
+  }
 
   // Set and Start PrimaryThread
   primary_->set_peers(peers_);
@@ -241,6 +424,21 @@ static void BuildDeleteRequest(const std::string& key, CmdRequest* cmd) {
   kv->set_key(key);
 }
 
+static void BuildWriteBatchRequest(const WriteBatch& batch, CmdRequest* cmd) {
+  cmd->set_type(Type::kWriteBatch);
+  CmdRequest_WriteBatch* write_batch = cmd->mutable_write_batch();
+  for (auto& op : batch.ops()) {
+    Entry_Operation* operation = write_batch->add_ops();
+    if (op.type == WriteBatch::kPut) {
+      operation->set_optype(Entry_OpType_kWrite);
+      operation->set_value(op.value);
+    } else {
+      operation->set_optype(Entry_OpType_kDelete);
+    }
+    operation->set_key(op.key);
+  }
+}
+
 static void BuildRequestVoteResponse(uint64_t term, bool granted,
                                      CmdResponse* response) {
   response->set_type(Type::kRequestVote);
@@ -249,6 +447,14 @@ static void BuildRequestVoteResponse(uint64_t term, bool granted,
   request_vote_res->set_vote_granted(granted);
 }
 
+static void BuildInstallSnapshotResponse(bool succ, uint64_t term,
+                                         CmdResponse* response) {
+  response->set_type(Type::kInstallSnapshot);
+  CmdResponse_InstallSnapshotResponse* install_snapshot_res = response->mutable_install_snapshot_res();
+  install_snapshot_res->set_term(term);
+  install_snapshot_res->set_success(succ);
+}
+
 static void BuildAppendEntriesResponse(bool succ, uint64_t term,
                                        uint64_t log_index,
                                        CmdResponse* response) {
@@ -259,17 +465,38 @@ static void BuildAppendEntriesResponse(bool succ, uint64_t term,
   append_entries_res->set_success(succ);
 }
 
+static void BuildCommandRequest(const std::string& command, CmdRequest* cmd) {
+  cmd->set_type(Type::kCommand);
+  cmd->set_command(command);
+}
+
+// key value commands are appended as KvCommand of the built-in state machine
 static void BuildLogEntry(const CmdRequest& cmd, uint64_t current_term, Entry* entry) {
   entry->set_term(current_term);
-  entry->set_key(cmd.kv().key());
-  entry->set_value(cmd.kv().value());
+  entry->set_key("");
   if (cmd.type() == Type::kRead) {
     entry->set_optype(Entry_OpType_kRead);
-  } else if (cmd.type() == Type::kWrite || cmd.type() == Type::kDirtyWrite) {
-    entry->set_optype(Entry_OpType_kWrite);
+    return;
+  }
+  entry->set_optype(Entry_OpType_kCommand);
+  if (cmd.type() == Type::kCommand) {
+    entry->set_command(cmd.command());
+    return;
+  }
+  KvCommand kv_command;
+  if (cmd.type() == Type::kWrite || cmd.type() == Type::kDirtyWrite) {
+    Entry_Operation* op = kv_command.add_ops();
+    op->set_optype(Entry_OpType_kWrite);
+    op->set_key(cmd.kv().key());
+    op->set_value(cmd.kv().value());
   } else if (cmd.type() == Type::kDelete) {
-    entry->set_optype(Entry_OpType_kDelete);
+    Entry_Operation* op = kv_command.add_ops();
+    op->set_optype(Entry_OpType_kDelete);
+    op->set_key(cmd.kv().key());
+  } else if (cmd.type() == Type::kWriteBatch) {
+    kv_command.mutable_ops()->CopyFrom(cmd.write_batch().ops());
   }
+  kv_command.SerializeToString(entry->mutable_command());
 }
 
 Status FloydImpl::Write(const std::string& key, const std::string& value) {
@@ -289,11 +516,34 @@ Status FloydImpl::Write(const std::string& key, const std::string& value) {
   return Status::Corruption("Write Error");
 }
 
+Status FloydImpl::Write(const WriteBatch& batch) {
+  if (!HasLeader()) {
+    return Status::Incomplete("no leader node!");
+  }
+  CmdRequest cmd;
+  BuildWriteBatchRequest(batch, &cmd);
+  CmdResponse response;
+  Status s = DoCommand(cmd, &response);
+  if (!s.ok()) {
+    return s;
+  }
+  if (response.code() == StatusCode::kOk) {
+    return Status::OK();
+  }
+  return Status::Corruption("WriteBatch Error");
+}
+
 Status FloydImpl::DirtyWrite(const std::string& key, const std::string& value) {
+  if (kv_ == NULL) {
+    return Status::NotSupported("key value interface without built-in state machine");
+  }
+  if (KvStateMachine::IsReservedKey(key)) {
+    return Status::InvalidArgument("the key is reserved by floyd");
+  }
   // Write myself first
-  rocksdb::Status rs = db_->Put(rocksdb::WriteOptions(), key, value);
-  if (!rs.ok()) {
-    return Status::IOError("DirtyWrite failed, " + rs.ToString());
+  Status ws = kv_->Put(key, value);
+  if (!ws.ok()) {
+    return Status::IOError("DirtyWrite failed, " + ws.ToString());
   }
 
   // Sync to other nodes without response
@@ -352,13 +602,123 @@ Status FloydImpl::Read(const std::string& key, std::string* value) {
 }
 
 Status FloydImpl::DirtyRead(const std::string& key, std::string* value) {
-  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), key, value);
-  if (s.ok()) {
+  if (kv_ == NULL) {
+    return Status::NotSupported("key value interface without built-in state machine");
+  }
+  if (KvStateMachine::IsReservedKey(key)) {
+    return Status::InvalidArgument("the key is reserved by floyd");
+  }
+  return kv_->Get(key, value);
+}
+
+void FloydImpl::AsyncWrite(const std::string& key, const std::string& value,
+                           const WriteCallback& callback) {
+  if (!HasLeader()) {
+    callback(Status::Incomplete("no leader node!"));
+    return;
+  }
+  CmdRequest cmd;
+  BuildWriteRequest(key, value, &cmd);
+  AsyncDoCommand(cmd, [callback](const Status& s, const CmdResponse& response) {
+    if (!s.ok()) {
+      callback(s);
+    } else if (response.code() == StatusCode::kOk) {
+      callback(Status::OK());
+    } else {
+      callback(Status::Corruption("Write Error"));
+    }
+  });
+}
+
+void FloydImpl::AsyncWrite(const WriteBatch& batch, const WriteCallback& callback) {
+  if (!HasLeader()) {
+    callback(Status::Incomplete("no leader node!"));
+    return;
+  }
+  CmdRequest cmd;
+  BuildWriteBatchRequest(batch, &cmd);
+  AsyncDoCommand(cmd, [callback](const Status& s, const CmdResponse& response) {
+    if (!s.ok()) {
+      callback(s);
+    } else if (response.code() == StatusCode::kOk) {
+      callback(Status::OK());
+    } else {
+      callback(Status::Corruption("WriteBatch Error"));
+    }
+  });
+}
+
+void FloydImpl::AsyncDelete(const std::string& key, const WriteCallback& callback) {
+  if (!HasLeader()) {
+    callback(Status::Incomplete("no leader node!"));
+    return;
+  }
+  CmdRequest cmd;
+  BuildDeleteRequest(key, &cmd);
+  AsyncDoCommand(cmd, [callback](const Status& s, const CmdResponse& response) {
+    if (!s.ok()) {
+      callback(s);
+    } else if (response.code() == StatusCode::kOk) {
+      callback(Status::OK());
+    } else {
+      callback(Status::Corruption("Delete Error"));
+    }
+  });
+}
+
+void FloydImpl::AsyncRead(const std::string& key, const ReadCallback& callback) {
+  if (!HasLeader()) {
+    callback(Status::Incomplete("no leader node!"), "");
+    return;
+  }
+  CmdRequest cmd;
+  BuildReadRequest(key, &cmd);
+  AsyncDoCommand(cmd, [callback](const Status& s, const CmdResponse& response) {
+    if (!s.ok()) {
+      callback(s, "");
+    } else if (response.code() == StatusCode::kOk) {
+      callback(Status::OK(), response.kv().value());
+    } else if (response.code() == StatusCode::kNotFound) {
+      callback(Status::NotFound(""), "");
+    } else {
+      callback(Status::Corruption("Read Error"), "");
+    }
+  });
+}
+
+Status FloydImpl::Execute(const std::string& command) {
+  if (!HasLeader()) {
+    return Status::Incomplete("no leader node!");
+  }
+  CmdRequest cmd;
+  BuildCommandRequest(command, &cmd);
+  CmdResponse response;
+  Status s = DoCommand(cmd, &response);
+  if (!s.ok()) {
+    return s;
+  }
+  if (response.code() == StatusCode::kOk) {
     return Status::OK();
-  } else if (s.IsNotFound()) {
-    return Status::NotFound("");
   }
-  return Status::Corruption(s.ToString());
+  return Status::Corruption("Execute Error");
+}
+
+void FloydImpl::AsyncExecute(const std::string& command, const WriteCallback& callback) {
+  if (!HasLeader()) {
+    callback(Status::Incomplete("no leader node!"));
+    return;
+  }
+  CmdRequest cmd;
+  BuildCommandRequest(command, &cmd);
+  AsyncDoCommand(cmd, [callback](const Status& s, const CmdResponse& response) {
+    if (!s.ok()) {
+      callback(s);
+    } else if (response.code() == StatusCode::kOk) {
+      callback(Status::OK());
+    } else {
+      callback(Status::Corruption("Execute Error"));
+    }
+  });
 }
 
 bool FloydImpl::GetServerStatus(std::string* msg) {
@@ -409,7 +769,53 @@ bool FloydImpl::GetServerStatus(std::string* msg) {
   return true;
 }
 
+struct CommandWaiter {
+  slash::Mutex mu;
+  slash::CondVar cond;
+  bool done;
+  Status s;
+  CmdResponse response;
+
+  CommandWaiter()
+    : cond(&mu),
+      done(false) {}
+};
+
+struct ForwardBatchWaiter {
+  slash::Mutex mu;
+  slash::CondVar cond;
+  size_t remaining;
+  std::vector<CmdResponse> responses;
+
+  explicit ForwardBatchWaiter(size_t n)
+    : cond(&mu),
+      remaining(n),
+      responses(n) {}
+};
+
+static bool HasReservedKey(const CmdRequest& cmd) {
+  if (cmd.type() == Type::kWriteBatch) {
+    for (int i = 0; i < cmd.write_batch().ops_size(); i++) {
+      if (KvStateMachine::IsReservedKey(cmd.write_batch().ops(i).key())) {
+        return true;
+      }
+    }
+    return false;
+  }
+  return cmd.type() != Type::kCommand && KvStateMachine::IsReservedKey(cmd.kv().key());
+}
+
 Status FloydImpl::DoCommand(const CmdRequest& cmd, CmdResponse *response) {
+  if (kv_ == NULL && cmd.type() != Type::kCommand) {
+    return Status::NotSupported("key value interface without built-in state machine");
+  }
+  if (HasReservedKey(cmd)) {
+    return Status::InvalidArgument("the key is reserved by floyd");
+  }
+  // Read is served locally after the read index is applied
+  if (cmd.type() == Type::kRead) {
+    return ExecuteRead(cmd, response);
+  }
   // Execute if is leader
   std::string leader_ip;
   int leader_port;
@@ -422,18 +828,188 @@ Status FloydImpl::DoCommand(const CmdRequest& cmd, CmdResponse *response) {
     return ExecuteCommand(cmd, response);
   }
   // Redirect to leader
-  return worker_client_pool_->SendAndRecv(
-      slash::IpPortString(leader_ip, leader_port),
-      cmd, response);
+  std::shared_ptr<CommandWaiter> waiter = std::make_shared<CommandWaiter>();
+  ForwardCommand(cmd, [waiter](const Status& s, const CmdResponse& res) {
+    slash::MutexLock l(&waiter->mu);
+    waiter->s = s;
+    waiter->response = res;
+    waiter->done = true;
+    waiter->cond.Signal();
+  });
+  // the command may wait for an idle forward thread before the RPC
+  uint64_t deadline = slash::NowMicros() + options_.command_timeout_us;
+  slash::MutexLock l(&waiter->mu);
+  while (!waiter->done) {
+    uint64_t now = slash::NowMicros();
+    if (now >= deadline) {
+      return Status::Timeout("forward command to leader timeout, it may still be applied");
+    }
+    waiter->cond.TimedWait((deadline - now + 999) / 1000);
+  }
+  response->Swap(&waiter->response);
+  return waiter->s;
+}
+
+void FloydImpl::AsyncDoCommand(const CmdRequest& cmd, const CommandCallback& callback) {
+  if (kv_ == NULL && cmd.type() != Type::kCommand) {
+    callback(Status::NotSupported("key value interface without built-in state machine"), CmdResponse());
+    return;
+  }
+  if (HasReservedKey(cmd)) {
+    callback(Status::InvalidArgument("the key is reserved by floyd"), CmdResponse());
+    return;
+  }
+  if (cmd.type() == Type::kRead) {
+    // Read don't go through raft log, it waits for read index to be applied
+    auto read = [this, cmd, callback](const Status& s, uint64_t read_index) {
+      if (!s.ok()) {
+        callback(s, CmdResponse());
+        return;
+      }
+      apply_->AddPendingRead(read_index, [this, cmd, callback](const Status& s) {
+        CmdResponse response;
+        response.set_type(cmd.type());
+        response.set_code(StatusCode::kError);
+        if (!s.ok()) {
+          callback(s, response);
+          return;
+        }
+        Status ret = CompleteCommand(cmd, &response);
+        callback(ret, response);
+      });
+    };
+    uint64_t read_index = 0;
+    if (LocalReadIndex(&read_index)) {
+      read(Status::OK(), read_index);
+    } else {
+      AsyncReadIndex(read);
+    }
+    return;
+  }
+
+  if (!IsLeader()) {
+    ForwardCommand(cmd, callback);
+    return;
+  }
+
+  Entry* entry = new Entry();
+  BuildLogEntry(cmd, context_->current_term, entry);
+  uint64_t term = entry->term();
+  AsyncGroupCommit(entry, [this, cmd, term, callback](const Status& s, uint64_t index) {
+    if (!s.ok()) {
+      callback(s, CmdResponse());
+      return;
+    }
+    apply_->AddPendingCommand(index, term, [this, cmd, callback](const Status& s) {
+      CmdResponse response;
+      response.set_type(cmd.type());
+      response.set_code(StatusCode::kError);
+      if (!s.ok()) {
+        callback(s, response);
+        return;
+      }
+      Status ret = CompleteCommand(cmd, &response);
+      callback(ret, response);
+    });
+  });
+}
+
+struct ForwardingCommand {
+  CmdRequest cmd;
+  CommandCallback callback;
+};
+
+void FloydImpl::ForwardCommand(const CmdRequest& cmd, const CommandCallback& callback) {
+  ForwardingCommand* forwarding = new ForwardingCommand;
+  forwarding->cmd = cmd;
+  forwarding->callback = callback;
+  slash::MutexLock l(&forward_mu_);
+  forward_waiting_.push_back(forwarding);
+  if (!idle_forward_cmd_threads_.empty()) {
+    ForwardCmdThread* thread = idle_forward_cmd_threads_.back();
+    idle_forward_cmd_threads_.pop_back();
+    thread->thread.Schedule(&ForwardCommandsWrapper, thread);
+  }
+}
+
+void FloydImpl::ForwardCommandsWrapper(void* arg) {
+  ForwardCmdThread* thread = reinterpret_cast<ForwardCmdThread*>(arg);
+  thread->floyd->ForwardCommands(thread);
+}
+
+/*
+ * the commands arrived while every forward thread is busy are sent in one
+ * kForwardBatch, which the leader appends to log in one group commit.
+ * Commands forwarded concurrently by async callers may be appended in
+ * different order than they are forwarded
+ */
+void FloydImpl::ForwardCommands(ForwardCmdThread* thread) {
+  while (true) {
+    std::vector<ForwardingCommand*> forwardings;
+    {
+    slash::MutexLock l(&forward_mu_);
+    if (forward_waiting_.empty()) {
+      idle_forward_cmd_threads_.push_back(thread);
+      return;
+    }
+    forwardings.swap(forward_waiting_);
+    }
+
+    std::string leader_ip;
+    int leader_port;
+    {
+    slash::MutexLock l(&context_->global_mu);
+    leader_ip = context_->leader_ip;
+    leader_port = context_->leader_port;
+    }
+    std::string leader = slash::IpPortString(leader_ip, leader_port);
+    Status s;
+    CmdResponse response;
+    if (leader_ip == "" || leader_port == 0) {
+      s = Status::Incomplete("no leader node!");
+    } else if (forwardings.size() == 1) {
+      s = worker_client_pool_->SendAndRecv(leader, forwardings[0]->cmd, &response);
+    } else {
+      CmdRequest cmd;
+      cmd.set_type(Type::kForwardBatch);
+      for (auto forwarding : forwardings) {
+        cmd.add_forward_cmds()->Swap(&forwarding->cmd);
+      }
+      s = worker_client_pool_->SendAndRecv(leader, cmd, &response);
+      if (s.ok() && (response.code() != StatusCode::kOk
+            || response.forward_res_size() != static_cast<int>(forwardings.size()))) {
+        s = Status::Incomplete("ForwardBatch failed, " + response.msg());
+      }
+    }
+    LOGV(DEBUG_LEVEL, info_log_, "FloydImpl::ForwardCommands: forward %lu commands to %s, %s",
+        forwardings.size(), leader.c_str(), s.ToString().c_str());
+
+    for (size_t i = 0; i < forwardings.size(); i++) {
+      if (!s.ok()) {
+        forwardings[i]->callback(s, CmdResponse());
+      } else if (forwardings.size() == 1) {
+        forwardings[i]->callback(s, response);
+      } else {
+        forwardings[i]->callback(s, response.forward_res(i));
+      }
+      delete forwardings[i];
+    }
+  }
 }
 
 Status FloydImpl::ReplyExecuteDirtyCommand(const CmdRequest& cmd,
                                       CmdResponse *response) {
   std::string value;
-  rocksdb::Status rs;
+  Status rs;
   switch (cmd.type()) {
   case Type::kDirtyWrite: {
-    rs = db_->Put(rocksdb::WriteOptions(), cmd.kv().key(), cmd.kv().value());
+    if (kv_ == NULL) {
+      rs = Status::NotSupported("key value interface without built-in state machine");
+    } else if (KvStateMachine::IsReservedKey(cmd.kv().key())) {
+      rs = Status::InvalidArgument("the key is reserved by floyd");
+    } else {
+      rs = kv_->Put(cmd.kv().key(), cmd.kv().value());
+    }
     // TODO(anan) add response type or reorganize proto
     // response->set_type(CmdResponse::DirtyWrite);
     response->set_type(Type::kWrite);
@@ -517,25 +1093,16 @@ bool FloydImpl::DoGetServerStatus(CmdResponse_ServerStatus* res) {
 
 Status FloydImpl::ExecuteCommand(const CmdRequest& request,
                                  CmdResponse *response) {
-  // Append entry local
-  std::vector<const Entry*> entries;
+  // Append entry local, replication is notified by the group commit leader
   Entry entry;
   BuildLogEntry(request, context_->current_term, &entry);
-  entries.push_back(&entry);
-
-  uint64_t last_log_index = raft_log_->Append(entries);
-  if (last_log_index <= 0) {
-    return Status::IOError("Append Entry failed");
+  uint64_t last_log_index;
+  Status s = GroupCommit(entry, &last_log_index);
+  if (!s.ok()) {
+    return s;
   }
 
-  // Notify primary then wait for apply
-  if (options_.single_mode) {
-    context_->commit_index = last_log_index;
-    raft_meta_->SetCommitIndex(context_->commit_index);
-    apply_->ScheduleApply();
-  } else {
-    primary_->AddTask(kNewCommand);
-  }
+  // Wait for apply
   response->set_type(request.type());
   response->set_code(StatusCode::kError);
 
@@ -547,10 +1114,154 @@ Status FloydImpl::ExecuteCommand(const CmdRequest& request,
     }
   }
   }
+  return CompleteCommand(request, response);
+}
+
+struct ReadIndexWaiter {
+  slash::Mutex mu;
+  slash::CondVar cond;
+  bool done;
+  Status s;
+  uint64_t read_index;
+
+  ReadIndexWaiter()
+    : cond(&mu),
+      done(false),
+      read_index(0) {}
+};
+
+bool FloydImpl::LocalReadIndex(uint64_t* read_index) {
+  if (options_.single_mode) {
+    slash::MutexLock l(&context_->global_mu);
+    *read_index = context_->commit_index;
+    return true;
+  }
+  if (options_.lease_read) {
+    return primary_->LeaseReadIndex(read_index);
+  }
+  return false;
+}
+
+Status FloydImpl::ReadIndex(uint64_t* read_index) {
+  if (LocalReadIndex(read_index)) {
+    return Status::OK();
+  }
+
+  std::shared_ptr<ReadIndexWaiter> waiter = std::make_shared<ReadIndexWaiter>();
+  AsyncReadIndex([waiter](const Status& s, uint64_t index) {
+    slash::MutexLock l(&waiter->mu);
+    waiter->s = s;
+    waiter->read_index = index;
+    waiter->done = true;
+    waiter->cond.Signal();
+  });
+
+  slash::MutexLock l(&waiter->mu);
+  while (!waiter->done) {
+    if (!waiter->cond.TimedWait(1000)) {
+      return Status::Timeout("FloydImpl::ReadIndex Timeout");
+    }
+  }
+  if (!waiter->s.ok()) {
+    return waiter->s;
+  }
+  *read_index = waiter->read_index;
+  return Status::OK();
+}
+
+void FloydImpl::AsyncReadIndex(const ReadIndexCallback& callback) {
+  if (IsLeader()) {
+    primary_->AddReadIndex(callback);
+    return;
+  }
+  slash::MutexLock l(&read_index_mu_);
+  read_index_waiting_.push_back(callback);
+  if (!read_index_forwarding_) {
+    read_index_forwarding_ = true;
+    forward_thread_.Schedule(&ForwardReadIndexWrapper, this);
+  }
+}
+
+void FloydImpl::ForwardReadIndexWrapper(void* arg) {
+  reinterpret_cast<FloydImpl*>(arg)->ForwardReadIndex();
+}
+
+// the requests arrived during one kReadIndex RPC are batched into the next
+void FloydImpl::ForwardReadIndex() {
+  while (true) {
+    std::vector<ReadIndexCallback> callbacks;
+    {
+    slash::MutexLock l(&read_index_mu_);
+    if (read_index_waiting_.empty()) {
+      read_index_forwarding_ = false;
+      return;
+    }
+    callbacks.swap(read_index_waiting_);
+    }
+
+    std::string leader_ip;
+    int leader_port;
+    {
+    slash::MutexLock l(&context_->global_mu);
+    leader_ip = context_->leader_ip;
+    leader_port = context_->leader_port;
+    }
+    Status s;
+    uint64_t read_index = 0;
+    if (leader_ip == "" || leader_port == 0) {
+      s = Status::Incomplete("no leader node!");
+    } else {
+      CmdRequest cmd;
+      cmd.set_type(Type::kReadIndex);
+      CmdResponse response;
+      s = worker_client_pool_->SendAndRecv(
+          slash::IpPortString(leader_ip, leader_port), cmd, &response);
+      if (s.ok()) {
+        if (response.code() == StatusCode::kOk) {
+          read_index = response.read_index_res().read_index();
+        } else {
+          s = Status::Incomplete("ReadIndex failed, " + response.msg());
+        }
+      }
+    }
+    LOGV(DEBUG_LEVEL, info_log_, "FloydImpl::ForwardReadIndex: %lu reads get read index %lu from %s:%d, %s",
+        callbacks.size(), read_index, leader_ip.c_str(), leader_port, s.ToString().c_str());
+    for (auto& callback : callbacks) {
+      callback(s, read_index);
+    }
+  }
+}
+
+Status FloydImpl::ExecuteRead(const CmdRequest& request,
+                              CmdResponse *response) {
+  response->set_type(request.type());
+  response->set_code(StatusCode::kError);
+
+  uint64_t read_index = 0;
+  Status s = ReadIndex(&read_index);
+  if (!s.ok()) {
+    return s;
+  }
+
+  // Wait for apply, a follower may learn the commit index from the
+  // next heartbeat, so wait longer than heartbeat_us
+  uint64_t deadline = slash::NowMicros() + options_.heartbeat_us + 1000000;
+  {
+  slash::MutexLock l(&context_->apply_mu);
+  while (context_->last_applied < read_index) {
+    if (!context_->apply_cond.TimedWait(1000) && slash::NowMicros() > deadline) {
+      return Status::Timeout("FloydImpl::ExecuteRead Timeout");
+    }
+  }
+  }
+  return CompleteCommand(request, response);
+}
 
+Status FloydImpl::CompleteCommand(const CmdRequest& request,
+                                  CmdResponse *response) {
   // Complete CmdRequest if needed
   std::string value;
-  rocksdb::Status rs;
+  Status rs;
   switch (request.type()) {
   case Type::kWrite: {
     response->set_code(StatusCode::kOk);
@@ -560,8 +1271,16 @@ Status FloydImpl::ExecuteCommand(const CmdRequest& request,
     response->set_code(StatusCode::kOk);
     break;
   }
+  case Type::kWriteBatch: {
+    response->set_code(StatusCode::kOk);
+    break;
+  }
+  case Type::kCommand: {
+    response->set_code(StatusCode::kOk);
+    break;
+  }
   case Type::kRead: {
-    rs = db_->Get(rocksdb::ReadOptions(), request.kv().key(), &value);
+    rs = kv_->Get(request.kv().key(), &value);
     if (rs.ok()) {
       BuildReadResponse(request.kv().key(), value, StatusCode::kOk, response);
     } else if (rs.IsNotFound()) {
@@ -569,7 +1288,7 @@ Status FloydImpl::ExecuteCommand(const CmdRequest& request,
     } else {
       BuildReadResponse(request.kv().key(), value, StatusCode::kError, response);
     }
-    LOGV(DEBUG_LEVEL, info_log_, "FloydImpl::ExecuteCommand Read %s, key(%s) value(%s)",
+    LOGV(DEBUG_LEVEL, info_log_, "FloydImpl::CompleteCommand Read %s, key(%s) value(%s)",
          rs.ToString().c_str(), request.kv().key().c_str(), value.c_str());
     break;
   }
@@ -580,6 +1299,173 @@ Status FloydImpl::ExecuteCommand(const CmdRequest& request,
   return Status::OK();
 }
 
+Status FloydImpl::GroupCommit(const Entry& entry, uint64_t* index) {
+  GroupCommitWriter w(&commit_mu_, &entry);
+  std::vector<GroupCommitWriter*> async_writers;
+  {
+  slash::MutexLock l(&commit_mu_);
+  writers_.push_back(&w);
+  while (!w.done && &w != writers_.front()) {
+    w.cv.Wait();
+  }
+  if (!w.done) {
+    // I am the front writer, append the batch for all waiting writers
+    DoGroupCommit(&async_writers);
+  }
+  }
+  FinishAsyncWriters(async_writers);
+  *index = w.index;
+  return w.s;
+}
+
+void FloydImpl::AsyncGroupCommit(const Entry* entry,
+                                 const std::function<void(const Status&, uint64_t)>& callback) {
+  GroupCommitWriter* w = new GroupCommitWriter(&commit_mu_, entry);
+  w->callback = callback;
+  slash::MutexLock l(&commit_mu_);
+  writers_.push_back(w);
+  if (writers_.size() == 1) {
+    // nobody is leading the group commit, let commit thread do it
+    commit_thread_.Schedule(&GroupCommitWrapper, this);
+  }
+}
+
+void FloydImpl::GroupCommitWrapper(void* arg) {
+  FloydImpl* floyd = reinterpret_cast<FloydImpl*>(arg);
+  std::vector<GroupCommitWriter*> async_writers;
+  {
+  slash::MutexLock l(&floyd->commit_mu_);
+  floyd->DoGroupCommit(&async_writers);
+  }
+  floyd->FinishAsyncWriters(async_writers);
+}
+
+void FloydImpl::DoGroupCommit(std::vector<GroupCommitWriter*>* async_writers) {
+  // wait a moment for more writers to come, then append all of them in one batch
+  if (options_.group_commit_window_us > 0) {
+    commit_mu_.Unlock();
+    slash::SleepForMicroseconds(options_.group_commit_window_us);
+    commit_mu_.Lock();
+  }
+  std::vector<const Entry*> entries;
+  uint64_t batch_size = 0;
+  for (auto iter = writers_.begin(); iter != writers_.end(); iter++) {
+    entries.push_back((*iter)->entry);
+    batch_size += (*iter)->entry->ByteSizeLong();
+    if (entries.size() >= options_.group_commit_count_once
+        || batch_size >= options_.group_commit_size_once) {
+      break;
+    }
+  }
+
+  // new writers only push back, so the first entries.size() writers
+  // stay the same while appending without lock
+  commit_mu_.Unlock();
+  // stage under global_mu, so that a step down and the new leader's
+  // entries appended by ReplyAppendEntries are ordered with it
+  uint64_t last_log_index = 0;
+  Status s;
+  {
+  slash::MutexLock l(&context_->global_mu);
+  bool still_leader = context_->role == Role::kLeader;
+  for (size_t i = 0; still_leader && i < entries.size(); i++) {
+    still_leader = entries[i]->term() == context_->current_term;
+  }
+  if (still_leader) {
+    last_log_index = raft_log_->Stage(entries);
+  } else {
+    LOGV(WARN_LEVEL, info_log_, "FloydImpl::DoGroupCommit: no longer leader at term %lu, "
+         "drop %lu entries", context_->current_term, entries.size());
+    s = Status::IOError("Append Entry failed, not leader");
+  }
+  }
+  if (last_log_index != 0 && !options_.single_mode) {
+    // Notify primary once for the whole batch
+    primary_->AddTask(kNewCommand);
+  }
+  // replicate the staged entries while writing them to local log,
+  // I count myself in the quorum once they are durable
+  if (last_log_index != 0 && !raft_log_->Persist(last_log_index)) {
+    // the entries may have been replicated and be committed by the next
+    // leader, they stay staged and are written with the next append. Step
+    // down so that no more entries follow them in this term, and tell the
+    // writers the result is unknown
+    LOGV(ERROR_LEVEL, info_log_, "FloydImpl::DoGroupCommit: persist entries up to %lu failed, "
+         "step down", last_log_index);
+    {
+    slash::MutexLock l(&context_->global_mu);
+    if (context_->role == Role::kLeader && context_->current_term == entries[0]->term()) {
+      context_->StepDown();
+    }
+    }
+    last_log_index = 0;
+    s = Status::Incomplete("Append Entry is not persisted, it may still be committed");
+  } else if (last_log_index != 0) {
+    // in group sync mode the entries are committed after sync, by kLogDurable
+    if (options_.single_mode && options_.log_sync_mode != kSyncGroup) {
+      context_->commit_index = last_log_index;
+      raft_meta_->SetCommitIndex(context_->commit_index);
+      apply_->ScheduleApply();
+    } else {
+      slash::MutexLock l(&context_->global_mu);
+      primary_->AdvanceCommitIndex();
+    }
+  }
+  commit_mu_.Lock();
+  LOGV(DEBUG_LEVEL, info_log_, "FloydImpl::DoGroupCommit: append %lu entries, last_log_index %lu",
+       entries.size(), last_log_index);
+
+  uint64_t index = last_log_index == 0 ? 0 : last_log_index - entries.size() + 1;
+  for (size_t i = 0; i < entries.size(); i++) {
+    GroupCommitWriter* writer = writers_.front();
+    writers_.pop_front();
+    writer->index = index == 0 ? 0 : index + i;
+    writer->s = s;
+    writer->done = true;
+    if (writer->callback) {
+      async_writers->push_back(writer);
+    } else {
+      writer->cv.Signal();
+    }
+  }
+  // hand over to the next batch
+  if (!writers_.empty()) {
+    if (writers_.front()->callback) {
+      commit_thread_.Schedule(&GroupCommitWrapper, this);
+    } else {
+      writers_.front()->cv.Signal();
+    }
+  }
+}
+
+void FloydImpl::AppendNoOpEntry(uint64_t term) {
+  Entry* entry = new Entry();
+  entry->set_term(term);
+  entry->set_key("");
+  entry->set_optype(Entry_OpType_kNoOp);
+  AsyncGroupCommit(entry, [this, term](const Status& s, uint64_t index) {
+    slash::MutexLock l(&context_->global_mu);
+    if (context_->role != Role::kLeader || context_->current_term != term) {
+      return;
+    }
+    if (!s.ok()) {
+      LOGV(WARN_LEVEL, info_log_, "FloydImpl::AppendNoOpEntry: append no-op entry failed at term %lu, "
+          "retry later", term);
+      primary_->AddTask(kNoOpEntry);
+      return;
+    }
+    context_->term_start_index = index;
+  });
+}
+
+void FloydImpl::FinishAsyncWriters(const std::vector<GroupCommitWriter*>& async_writers) {
+  for (auto writer : async_writers) {
+    writer->callback(writer->s, writer->index);
+    delete writer->entry;
+    delete writer;
+  }
+}
+
 // Peer ask my vote with it's ip, port, log_term and log_index
 void FloydImpl::GrantVote(uint64_t term, const std::string ip, int port) {
   // Got my vote
@@ -603,6 +1489,17 @@ void FloydImpl::ReplyRequestVote(const CmdRequest& request, CmdResponse* respons
     BuildRequestVoteResponse(context_->current_term, granted, response);
     return;
   }
+  // in lease mode, the leader may serve read locally until check_leader_us
+  // after my last acknowledgement, so I can't help to elect another one
+  if (options_.lease_read && context_->role == Role::kFollower && context_->leader_ip != ""
+      && context_->leader_op_time + options_.check_leader_us > slash::NowMicros()) {
+    LOGV(INFO_LEVEL, info_log_, "FloydImpl::ReplyRequestVote: %s:%d refuse to vote for %s:%d at term %lu,"
+        " since leader %s:%d is still alive", options_.local_ip.c_str(), options_.local_port,
+        request_vote.ip().c_str(), request_vote.port(), request_vote.term(),
+        context_->leader_ip.c_str(), context_->leader_port);
+    BuildRequestVoteResponse(context_->current_term, granted, response);
+    return;
+  }
   uint64_t my_last_log_term = 0;
   uint64_t my_last_log_index = 0;
   raft_log_->GetLastLogTermAndIndex(&my_last_log_term, &my_last_log_index);
@@ -632,31 +1529,55 @@ void FloydImpl::ReplyRequestVote(const CmdRequest& request, CmdResponse* respons
       " commit_index(%lu) last_applied(%lu)", request_vote.ip().c_str(), request_vote.port(),
       context_->current_term, request_vote.last_log_term(), my_last_log_index, context_->last_applied.load());
   context_->BecomeFollower(request_vote.term());
-  raft_meta_->SetCurrentTerm(context_->current_term);
-  raft_meta_->SetVotedForIp(context_->voted_for_ip);
-  raft_meta_->SetVotedForPort(context_->voted_for_port);
-  // Got my vote
+  // Got my vote, it is durable before the response
   GrantVote(request_vote.term(), request_vote.ip(), request_vote.port());
+  raft_meta_->SetTermAndVote(context_->current_term, context_->voted_for_ip,
+      context_->voted_for_port);
   granted = true;
   LOGV(INFO_LEVEL, info_log_, "FloydImpl::ReplyRequestVote: Grant my vote to %s:%d at term %lu",
       context_->voted_for_ip.c_str(), context_->voted_for_port, context_->current_term);
   BuildRequestVoteResponse(context_->current_term, granted, response);
 }
 
-bool FloydImpl::AdvanceFollowerCommitIndex(uint64_t leader_commit) {
+void FloydImpl::ReplyReadIndex(const CmdRequest& request, CmdResponse* response) {
+  response->set_type(Type::kReadIndex);
+  response->set_code(StatusCode::kError);
+  if (!IsLeader()) {
+    response->set_msg("not leader");
+    return;
+  }
+  uint64_t read_index = 0;
+  Status s = ReadIndex(&read_index);
+  if (!s.ok()) {
+    response->set_msg(s.ToString());
+    return;
+  }
+  response->set_code(StatusCode::kOk);
+  response->mutable_read_index_res()->set_read_index(read_index);
+}
+
+bool FloydImpl::AdvanceFollowerCommitIndex(uint64_t leader_commit, uint64_t last_new_index) {
   // Update log commit index
   /*
    * If leaderCommit > commitIndex, set commitIndex =
    *   min(leaderCommit, index of last new entry)
+   * the entries not durable yet in kSyncGroup mode are not committed here
    */
-  context_->commit_index = std::min(leader_commit, raft_log_->GetLastLogIndex());
+  uint64_t commit_index = std::min(leader_commit,
+      std::min(last_new_index, raft_log_->GetDurableIndex()));
+  if (commit_index <= context_->commit_index) {
+    return false;
+  }
+  context_->commit_index = commit_index;
   raft_meta_->SetCommitIndex(context_->commit_index);
   return true;
 }
 
 void FloydImpl::ReplyAppendEntries(const CmdRequest& request, CmdResponse* response) {
   bool success = false;
-  CmdRequest_AppendEntries append_entries = request.append_entries();
+  const CmdRequest_AppendEntries& append_entries = request.append_entries();
+  uint64_t last_log_index = 0;
+  {
   slash::MutexLock l(&context_->global_mu);
   // update last_op_time to avoid another leader election
   context_->last_op_time = slash::NowMicros();
@@ -677,10 +1598,10 @@ void FloydImpl::ReplyAppendEntries(const CmdRequest& request, CmdResponse* respo
         context_->current_term, context_->role, context_->leader_ip.c_str(), context_->leader_port);
     context_->BecomeFollower(append_entries.term(),
         append_entries.ip(), append_entries.port());
-    raft_meta_->SetCurrentTerm(context_->current_term);
-    raft_meta_->SetVotedForIp(context_->voted_for_ip);
-    raft_meta_->SetVotedForPort(context_->voted_for_port);
+    raft_meta_->SetTermAndVote(context_->current_term, context_->voted_for_ip,
+        context_->voted_for_port);
   }
+  context_->leader_op_time = slash::NowMicros();
 
   if (append_entries.prev_log_index() > raft_log_->GetLastLogIndex()) {
     LOGV(INFO_LEVEL, info_log_, "FloydImpl::ReplyAppendEntries: Leader %s:%d prev_log_index %lu is larger than my %s:%d last_log_index %lu",
@@ -697,18 +1618,15 @@ void FloydImpl::ReplyAppendEntries(const CmdRequest& request, CmdResponse* respo
         append_entries.prev_log_term(), append_entries.prev_log_index(), raft_log_->GetLastLogIndex(),
         append_entries.prev_log_index() + 1);
     raft_log_->TruncateSuffix(append_entries.prev_log_index() + 1);
+    apply_->TruncatePendingCommands(append_entries.prev_log_index() + 1);
   }
 
   // we compare peer's prev index and term with my last log index and term
   uint64_t my_last_log_term = 0;
-  Entry entry;
   LOGV(DEBUG_LEVEL, info_log_, "FloydImpl::ReplyAppendEntries "
       "prev_log_index: %lu\n", append_entries.prev_log_index());
-  if (append_entries.prev_log_index() == 0) {
-    my_last_log_term = 0;
-  } else if (raft_log_->GetEntry(append_entries.prev_log_index(), &entry) == 0) {
-    my_last_log_term = entry.term();
-  } else {
+  // the prev entry may be the last one in snapshot
+  if (raft_log_->GetTerm(append_entries.prev_log_index(), &my_last_log_term) != 0) {
     LOGV(WARN_LEVEL, info_log_, "FloydImple::ReplyAppentries: can't "
         "get Entry from raft_log prev_log_index %llu", append_entries.prev_log_index());
     BuildAppendEntriesResponse(success, context_->current_term, raft_log_->GetLastLogIndex(), response);
@@ -722,11 +1640,13 @@ void FloydImpl::ReplyAppendEntries(const CmdRequest& request, CmdResponse* respo
          append_entries.prev_log_index());
     // TruncateSuffix [prev_log_index, last_log_index)
     raft_log_->TruncateSuffix(append_entries.prev_log_index());
+    apply_->TruncatePendingCommands(append_entries.prev_log_index());
     BuildAppendEntriesResponse(success, context_->current_term, raft_log_->GetLastLogIndex(), response);
     return;
   }
 
-  std::vector<const Entry*> entries;
+  // write the serialized entries into log verbatim
+  std::vector<const std::string*> entries;
   for (int i = 0; i < append_entries.entries().size(); i++) {
     entries.push_back(&append_entries.entries(i));
   }
@@ -739,7 +1659,8 @@ void FloydImpl::ReplyAppendEntries(const CmdRequest& request, CmdResponse* respo
     LOGV(DEBUG_LEVEL, info_log_, "FloydImpl::ReplyAppendEntries: Leader %s:%d will append %u entries from "
          " prev_log_index %lu", append_entries.ip().c_str(), append_entries.port(),
          append_entries.entries().size(), append_entries.prev_log_index());
-    if (raft_log_->Append(entries) <= 0) {
+    last_log_index = raft_log_->AppendSerialized(entries);
+    if (last_log_index == 0) {
       LOGV(ERROR_LEVEL, info_log_, "FloydImpl::ReplyAppendEntries: Leader %s:%d ppend %u entries from "
           " prev_log_index %lu error at term %lu", append_entries.ip().c_str(), append_entries.port(),
           append_entries.entries().size(), append_entries.prev_log_index(), append_entries.term());
@@ -750,11 +1671,23 @@ void FloydImpl::ReplyAppendEntries(const CmdRequest& request, CmdResponse* respo
     LOGV(INFO_LEVEL, info_log_, "FloydImpl::ReplyAppendEntries: Receive PingPong AppendEntries from %s:%d at term %lu",
         append_entries.ip().c_str(), append_entries.port(), append_entries.term());
   }
-  if (append_entries.leader_commit() != context_->commit_index) {
-    AdvanceFollowerCommitIndex(append_entries.leader_commit());
+  }
+
+  /*
+   * the entries are acknowledged after they are durable, wait without
+   * global_mu so that votes and heartbeats go on during the fsync
+   */
+  success = last_log_index == 0 || raft_log_->WaitDurable(last_log_index);
+  slash::MutexLock l(&context_->global_mu);
+  // a newer leader may have truncated the entries during the wait
+  if (context_->current_term != append_entries.term()) {
+    success = false;
+  }
+  // a heartbeat only confirms the log up to prev_log_index
+  uint64_t last_new_index = last_log_index == 0 ? append_entries.prev_log_index() : last_log_index;
+  if (success && AdvanceFollowerCommitIndex(append_entries.leader_commit(), last_new_index)) {
     apply_->ScheduleApply();
   }
-  success = true;
   // only when follower successfully do appendentries, we will update commit index
   LOGV(DEBUG_LEVEL, info_log_, "FloydImpl::ReplyAppendEntries server %s:%d Apply %d entries from Leader %s:%d"
       " prev_log_index %lu, leader commit %lu at term %lu", options_.local_ip.c_str(),
@@ -764,4 +1697,95 @@ void FloydImpl::ReplyAppendEntries(const CmdRequest& request, CmdResponse* respo
   BuildAppendEntriesResponse(success, context_->current_term, raft_log_->GetLastLogIndex(), response);
 }
 
+void FloydImpl::ReplyInstallSnapshot(const CmdRequest& request, CmdResponse* response) {
+  const CmdRequest_InstallSnapshot& install_snapshot = request.install_snapshot();
+  uint64_t current_term;
+  {
+  slash::MutexLock l(&context_->global_mu);
+  context_->last_op_time = slash::NowMicros();
+  if (install_snapshot.term() < context_->current_term) {
+    LOGV(INFO_LEVEL, info_log_, "FloydImpl::ReplyInstallSnapshot: Leader %s:%d term %lu is smaller than my current term %lu",
+        install_snapshot.ip().c_str(), install_snapshot.port(), install_snapshot.term(), context_->current_term);
+    BuildInstallSnapshotResponse(false, context_->current_term, response);
+    return;
+  } else if ((install_snapshot.term() > context_->current_term)
+      || (context_->role == kCandidate || (context_->role == kFollower && context_->leader_ip == ""))) {
+    context_->BecomeFollower(install_snapshot.term(),
+        install_snapshot.ip(), install_snapshot.port());
+    raft_meta_->SetTermAndVote(context_->current_term, context_->voted_for_ip,
+        context_->voted_for_port);
+  }
+  context_->leader_op_time = slash::NowMicros();
+  current_term = context_->current_term;
+  }
+
+  // the chunk is written without global_mu, not to hold up AppendEntries
+  // and elections
+  Status s = apply_->ReceiveSnapshot(install_snapshot);
+  if (!s.ok()) {
+    LOGV(WARN_LEVEL, info_log_, "FloydImpl::ReplyInstallSnapshot: receive snapshot at index %lu offset %lu from %s:%d"
+        " failed, %s", install_snapshot.last_included_index(), install_snapshot.offset(),
+        install_snapshot.ip().c_str(), install_snapshot.port(), s.ToString().c_str());
+    BuildInstallSnapshotResponse(false, current_term, response);
+    return;
+  }
+  BuildInstallSnapshotResponse(true, current_term, response);
+}
+
+static const uint64_t kForwardBatchTimeoutUs = 1000000;
+
+/*
+ * the forwarded commands are appended through the group commit queue
+ * together, the reply waits until all of them are applied like DoCommand
+ */
+void FloydImpl::ReplyForwardBatch(const CmdRequest& request, CmdResponse* response) {
+  response->set_type(Type::kForwardBatch);
+  response->set_code(StatusCode::kError);
+  if (!IsLeader()) {
+    response->set_msg("not leader");
+    return;
+  }
+  int n = request.forward_cmds_size();
+  std::shared_ptr<ForwardBatchWaiter> waiter = std::make_shared<ForwardBatchWaiter>(n);
+  for (int i = 0; i < n; i++) {
+    const CmdRequest& cmd = request.forward_cmds(i);
+    Type type = cmd.type();
+    AsyncDoCommand(cmd, [waiter, i, type](const Status& s, const CmdResponse& res) {
+      slash::MutexLock l(&waiter->mu);
+      CmdResponse& slot = waiter->responses[i];
+      slot = res;
+      if (!s.ok()) {
+        slot.set_type(type);
+        slot.set_code(StatusCode::kError);
+        slot.set_msg(s.ToString());
+      }
+      waiter->remaining--;
+      waiter->cond.Signal();
+    });
+  }
+
+  // one deadline for the whole batch, the forwarder gives up after the
+  // timeout of ClientPool anyway
+  uint64_t deadline = slash::NowMicros() + kForwardBatchTimeoutUs;
+  slash::MutexLock l(&waiter->mu);
+  while (waiter->remaining > 0) {
+    uint64_t now = slash::NowMicros();
+    if (now >= deadline) {
+      break;
+    }
+    waiter->cond.TimedWait((deadline - now) / 1000 + 1);
+  }
+  for (int i = 0; i < n; i++) {
+    CmdResponse* res = response->add_forward_res();
+    if (waiter->responses[i].has_type()) {
+      res->CopyFrom(waiter->responses[i]);
+    } else {
+      res->set_type(request.forward_cmds(i).type());
+      res->set_code(StatusCode::kError);
+      res->set_msg("FloydImpl::ReplyForwardBatch Timeout");
+    }
+  }
+  response->set_code(StatusCode::kOk);
+}
+
 }  // namespace floyd
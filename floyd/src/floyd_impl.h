@@ -10,6 +10,8 @@
 #include <vector>
 #include <utility>
 #include <map>
+#include <deque>
+#include <functional>
 
 #include "slash/include/slash_mutex.h"
 #include "slash/include/slash_status.h"
@@ -31,12 +33,39 @@ class FloydApply;
 class FloydWorker;
 class FloydWorkerConn;
 class FloydContext;
+class KvStateMachine;
 class Logger;
 class CmdRequest;
 class CmdResponse;
+struct ForwardingCommand;
+struct ForwardCmdThread;
 class CmdResponse_ServerStatus;
+class Entry;
 
 typedef std::map<std::string, Peer*> PeersSet;
+typedef std::function<void(const Status& s, const CmdResponse& response)> CommandCallback;
+typedef std::function<void(const Status& s, uint64_t read_index)> ReadIndexCallback;
+
+/*
+ * a client command waiting in the leader's group commit queue,
+ * the writer in the front of the queue appends the whole batch for others
+ */
+struct GroupCommitWriter {
+  const Entry* entry;
+  uint64_t index;  // log index assigned to entry, 0 if append failed
+  Status s;        // why the append failed
+  bool done;
+  slash::CondVar cv;
+  // only set by async writers, which own the entry and are not waited on,
+  // the callback is invoked with the result instead
+  std::function<void(const Status& s, uint64_t index)> callback;
+
+  GroupCommitWriter(slash::Mutex* mu, const Entry* _entry)
+    : entry(_entry),
+      index(0),
+      done(false),
+      cv(mu) {}
+};
 
 class FloydImpl : public Floyd  {
  public:
@@ -46,11 +75,21 @@ class FloydImpl : public Floyd  {
   Status Init();
 
   virtual Status Write(const std::string& key, const std::string& value);
+  virtual Status Write(const WriteBatch& batch);
   virtual Status DirtyWrite(const std::string& key, const std::string& value);
   virtual Status Delete(const std::string& key);
   virtual Status Read(const std::string& key, std::string* value);
   virtual Status DirtyRead(const std::string& key, std::string* value);
 
+  virtual void AsyncWrite(const std::string& key, const std::string& value,
+                          const WriteCallback& callback);
+  virtual void AsyncWrite(const WriteBatch& batch, const WriteCallback& callback);
+  virtual void AsyncDelete(const std::string& key, const WriteCallback& callback);
+  virtual void AsyncRead(const std::string& key, const ReadCallback& callback);
+
+  virtual Status Execute(const std::string& command);
+  virtual void AsyncExecute(const std::string& command, const WriteCallback& callback);
+
   // return true if leader has been elected
   virtual bool GetLeader(std::string* ip_port);
   virtual bool GetLeader(std::string* ip, int* port);
@@ -68,10 +107,14 @@ class FloydImpl : public Floyd  {
   friend class FloydWorkerHandle;
   friend class Peer;
 
-  rocksdb::DB* db_;
-  // state machine db point
+  // the built-in key value store, NULL if a user state machine is given
+  KvStateMachine* kv_;
+  StateMachine* state_machine_;
   // raft log
   rocksdb::DB* log_and_meta_;  // used to store logs and meta data
+  // logs and meta data are kept in separate column families
+  rocksdb::ColumnFamilyHandle* meta_cf_;
+  rocksdb::ColumnFamilyHandle* log_cf_;
   RaftLog* raft_log_;
   RaftMeta* raft_meta_;
 
@@ -82,17 +125,73 @@ class FloydImpl : public Floyd  {
   FloydContext* context_;
 
   FloydWorker* worker_;
+  // NULL if consensus_port_offset is 0
+  FloydWorker* consensus_worker_;
   FloydApply* apply_;
   FloydPrimary* primary_;
   PeersSet peers_;
   ClientPool* worker_client_pool_;
+  // connections of peers, apart from those forwarding client commands
+  ClientPool* peer_client_pool_;
 
   std::map<int64_t, std::pair<std::string, int> > vote_for_;
 
+  // group commit queue, protected by commit_mu_
+  slash::Mutex commit_mu_;
+  std::deque<GroupCommitWriter*> writers_;
+  // lead the group commit when the front writer is an async one
+  pink::BGThread commit_thread_;
+  // forward read index requests to leader
+  pink::BGThread forward_thread_;
+  // forward commands to leader, apart from read index which is not blocked
+  // by applying. Each of them sends one batch at a time, up to
+  // max_conns_per_member batches are in flight
+  std::vector<ForwardCmdThread*> forward_cmd_threads_;
+
+  // follower side read index requests waiting for the next kReadIndex RPC,
+  // all of them share one RPC, protected by read_index_mu_
+  slash::Mutex read_index_mu_;
+  std::vector<ReadIndexCallback> read_index_waiting_;
+  bool read_index_forwarding_;
+
+  // follower side commands waiting for the next kForwardBatch RPC, and the
+  // forward_cmd_threads_ not sending one, protected by forward_mu_
+  slash::Mutex forward_mu_;
+  std::vector<ForwardingCommand*> forward_waiting_;
+  std::vector<ForwardCmdThread*> idle_forward_cmd_threads_;
+
   bool IsSelf(const std::string& ip_port);
+  Status OpenLogAndMeta();
 
   Status DoCommand(const CmdRequest& cmd, CmdResponse *cmd_res);
   Status ExecuteCommand(const CmdRequest& cmd, CmdResponse *cmd_res);
+  // linearizable read without appending to raft log
+  Status ExecuteRead(const CmdRequest& cmd, CmdResponse *cmd_res);
+  Status ReadIndex(uint64_t* read_index);
+  // read index known without network round trip, in single mode or lease mode
+  bool LocalReadIndex(uint64_t* read_index);
+  // leader confirms its leadership, follower asks leader for the read index
+  void AsyncReadIndex(const ReadIndexCallback& callback);
+  static void ForwardReadIndexWrapper(void* arg);
+  void ForwardReadIndex();
+  // complete response after the command has been applied
+  Status CompleteCommand(const CmdRequest& cmd, CmdResponse *cmd_res);
+  void AsyncDoCommand(const CmdRequest& cmd, const CommandCallback& callback);
+  // send command to leader together with others arriving meanwhile
+  void ForwardCommand(const CmdRequest& cmd, const CommandCallback& callback);
+  static void ForwardCommandsWrapper(void* arg);
+  void ForwardCommands(ForwardCmdThread* thread);
+
+  // append entry through the group commit queue and set its log index.
+  // Incomplete means it is staged but not written, it may still be committed
+  Status GroupCommit(const Entry& entry, uint64_t* index);
+  // take the ownership of entry, callback with the result of GroupCommit
+  void AsyncGroupCommit(const Entry* entry,
+                        const std::function<void(const Status&, uint64_t)>& callback);
+  static void GroupCommitWrapper(void* arg);
+  // called with commit_mu_ held by the front writer of writers_
+  void DoGroupCommit(std::vector<GroupCommitWriter*>* async_writers);
+  void FinishAsyncWriters(const std::vector<GroupCommitWriter*>& async_writers);
   Status ReplyExecuteDirtyCommand(const CmdRequest& cmd, CmdResponse *cmd_res);
   bool DoGetServerStatus(CmdResponse_ServerStatus* res);
   void GrantVote(uint64_t term, const std::string ip, int port);
@@ -102,8 +201,15 @@ class FloydImpl : public Floyd  {
    */
   void ReplyRequestVote(const CmdRequest& cmd, CmdResponse* cmd_res);
   void ReplyAppendEntries(const CmdRequest& cmd, CmdResponse* cmd_res);
-
-  bool AdvanceFollowerCommitIndex(uint64_t new_commit_index);
+  void ReplyReadIndex(const CmdRequest& cmd, CmdResponse* cmd_res);
+  void ReplyInstallSnapshot(const CmdRequest& cmd, CmdResponse* cmd_res);
+  void ReplyForwardBatch(const CmdRequest& cmd, CmdResponse* cmd_res);
+  // a new leader appends an empty entry of its term, once it is committed
+  // all entries of former terms are committed, and read index can be served
+  void AppendNoOpEntry(uint64_t term);
+
+  // last_new_index is the last entry known to match leader's log
+  bool AdvanceFollowerCommitIndex(uint64_t leader_commit, uint64_t last_new_index);
 
   // No coping allowed
   FloydImpl(const FloydImpl&);
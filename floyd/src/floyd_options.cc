@@ -45,6 +45,26 @@ void Options::Dump() {
           "             heartbeat_us : %ld\n"
           " append_entries_size_once : %ld\n"
           "append_entries_count_once : %lu\n"
+          "    append_entries_window : %lu\n"
+          "           log_cache_size : %lu\n"
+          "             use_file_log : %s\n"
+          "    file_log_segment_size : %lu\n"
+          "            log_sync_mode : %d\n"
+          "   group_commit_window_us : %lu\n"
+          "   group_commit_size_once : %lu\n"
+          "  group_commit_count_once : %lu\n"
+          "               lease_read : %s\n"
+          "           lease_drift_us : %lu\n"
+          "  snapshot_interval_count : %lu\n"
+          "   snapshot_interval_size : %lu\n"
+          "install_snapshot_chunk_size : %lu\n"
+          "            state_machine : %s\n"
+          "           disable_kv_wal : %s\n"
+          "        worker_thread_num : %d\n"
+          "       worker_queue_limit : %d\n"
+          "    consensus_port_offset : %d\n"
+          "     max_conns_per_member : %d\n"
+          "       command_timeout_us : %lu\n"
           "              single_mode : %s\n",
             local_ip.c_str(),
             local_port,
@@ -53,22 +73,62 @@ void Options::Dump() {
             heartbeat_us,
             append_entries_size_once,
             append_entries_count_once,
+            append_entries_window,
+            log_cache_size,
+            use_file_log ? "true" : "false",
+            file_log_segment_size,
+            log_sync_mode,
+            group_commit_window_us,
+            group_commit_size_once,
+            group_commit_count_once,
+            lease_read ? "true" : "false",
+            lease_drift_us,
+            snapshot_interval_count,
+            snapshot_interval_size,
+            install_snapshot_chunk_size,
+            state_machine == NULL ? "rocksdb" : "user",
+            disable_kv_wal ? "true" : "false",
+            worker_thread_num,
+            worker_queue_limit,
+            consensus_port_offset,
+            max_conns_per_member,
+            command_timeout_us,
             single_mode ? "true" : "false");
 }
 
 std::string Options::ToString() {
-  char str[1024];
+  char str[2048];
   int len = 0;
   for (size_t i = 0; i < members.size(); i++) {
-    len += snprintf(str + len, sizeof(str), "                 member %lu : %s\n", i, members[i].c_str());
+    len += snprintf(str + len, sizeof(str) - len, "                 member %lu : %s\n", i, members[i].c_str());
   }
-  snprintf(str + len, sizeof(str), "                 local_ip : %s\n"
+  snprintf(str + len, sizeof(str) - len, "                 local_ip : %s\n"
           "               local_port : %d\n"
           "                     path : %s\n"
           "          check_leader_us : %ld\n"
           "             heartbeat_us : %ld\n"
           " append_entries_size_once : %ld\n"
           "append_entries_count_once : %lu\n"
+          "    append_entries_window : %lu\n"
+          "           log_cache_size : %lu\n"
+          "             use_file_log : %s\n"
+          "    file_log_segment_size : %lu\n"
+          "            log_sync_mode : %d\n"
+          "   group_commit_window_us : %lu\n"
+          "   group_commit_size_once : %lu\n"
+          "  group_commit_count_once : %lu\n"
+          "               lease_read : %s\n"
+          "           lease_drift_us : %lu\n"
+          "  snapshot_interval_count : %lu\n"
+          "   snapshot_interval_size : %lu\n"
+          "install_snapshot_chunk_size : %lu\n"
+          "            state_machine : %s\n"
+          "           disable_kv_wal : %s\n"
+          "        worker_thread_num : %d\n"
+          "       worker_queue_limit : %d\n"
+          "    consensus_port_offset : %d\n"
+          "     max_conns_per_member : %d\n"
+          "       command_timeout_us : %lu\n"
           "              single_mode : %s\n",
             local_ip.c_str(),
             local_port,
@@ -77,6 +137,26 @@ std::string Options::ToString() {
             heartbeat_us,
             append_entries_size_once,
             append_entries_count_once,
+            append_entries_window,
+            log_cache_size,
+            use_file_log ? "true" : "false",
+            file_log_segment_size,
+            log_sync_mode,
+            group_commit_window_us,
+            group_commit_size_once,
+            group_commit_count_once,
+            lease_read ? "true" : "false",
+            lease_drift_us,
+            snapshot_interval_count,
+            snapshot_interval_size,
+            install_snapshot_chunk_size,
+            state_machine == NULL ? "rocksdb" : "user",
+            disable_kv_wal ? "true" : "false",
+            worker_thread_num,
+            worker_queue_limit,
+            consensus_port_offset,
+            max_conns_per_member,
+            command_timeout_us,
             single_mode ? "true" : "false");
   return str;
 }
@@ -89,6 +169,26 @@ Options::Options()
     heartbeat_us(3000000),
     append_entries_size_once(1024000),
     append_entries_count_once(128),
+    append_entries_window(1),
+    log_cache_size(64 * 1024 * 1024),
+    use_file_log(false),
+    file_log_segment_size(64 * 1024 * 1024),
+    log_sync_mode(kSyncNone),
+    group_commit_window_us(0),
+    group_commit_size_once(1024000),
+    group_commit_count_once(1024),
+    lease_read(false),
+    lease_drift_us(2000000),
+    snapshot_interval_count(0),
+    snapshot_interval_size(0),
+    install_snapshot_chunk_size(1024 * 1024),
+    state_machine(NULL),
+    disable_kv_wal(false),
+    worker_thread_num(4),
+    worker_queue_limit(1000),
+    consensus_port_offset(0),
+    max_conns_per_member(8),
+    command_timeout_us(10000000),
     single_mode(false) {
     }
 
@@ -102,6 +202,26 @@ Options::Options(const std::string& cluster_string,
     heartbeat_us(3000000),
     append_entries_size_once(1024000),
     append_entries_count_once(128),
+    append_entries_window(1),
+    log_cache_size(64 * 1024 * 1024),
+    use_file_log(false),
+    file_log_segment_size(64 * 1024 * 1024),
+    log_sync_mode(kSyncNone),
+    group_commit_window_us(0),
+    group_commit_size_once(1024000),
+    group_commit_count_once(1024),
+    lease_read(false),
+    lease_drift_us(2000000),
+    snapshot_interval_count(0),
+    snapshot_interval_size(0),
+    install_snapshot_chunk_size(1024 * 1024),
+    state_machine(NULL),
+    disable_kv_wal(false),
+    worker_thread_num(4),
+    worker_queue_limit(1000),
+    consensus_port_offset(0),
+    max_conns_per_member(8),
+    command_timeout_us(10000000),
     single_mode(false) {
   std::srand(slash::NowMicros());
   // the default check_leader is [3s, 5s)
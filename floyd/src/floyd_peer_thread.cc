@@ -7,12 +7,19 @@
 
 #include <google/protobuf/text_format.h>
 
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
 #include <algorithm>
 #include <climits>
+#include <string>
 #include <vector>
 
 #include "slash/include/env.h"
 #include "slash/include/slash_mutex.h"
+#include "slash/include/slash_string.h"
 #include "slash/include/xdebug.h"
 
 #include "floyd/src/floyd_primary_thread.h"
@@ -29,6 +36,7 @@ namespace floyd {
 Peer::Peer(std::string server, FloydContext* context, FloydPrimary* primary, RaftMeta* raft_meta,
     RaftLog* raft_log, ClientPool* pool, FloydApply* apply, const Options& options, Logger* info_log)
   : peer_addr_(server),
+    rpc_addr_(server),
     context_(context),
     primary_(primary),
     raft_meta_(raft_meta),
@@ -40,9 +48,26 @@ Peer::Peer(std::string server, FloydContext* context, FloydPrimary* primary, Raf
     next_index_(1),
     match_index_(0),
     peer_last_op_time(0),
+    acked_round_(0),
+    acked_time_(0),
+    pipeline_client_(NULL),
+    epoch_(0),
+    probing_(false),
+    install_snapshot_(false),
+    snapshot_sent_index_(0),
+    snapshot_sent_time_(0),
+    append_entries_scheduled_(false),
     bg_thread_(1024 * 1024 * 256) {
       next_index_ = raft_log_->GetLastLogIndex() + 1;
       match_index_ = raft_meta_->GetLastApplied();
+      std::string ip;
+      int port;
+      slash::ParseIpPortString(peer_addr_, ip, port);
+      port += options_.consensus_port_offset;
+      rpc_addr_ = ip + ":" + std::to_string(port);
+      if (options_.append_entries_window > 1) {
+        pipeline_client_ = new Client(ip, port);
+      }
 }
 
 int Peer::Start() {
@@ -51,6 +76,7 @@ int Peer::Start() {
 }
 
 Peer::~Peer() {
+  delete pipeline_client_;
   LOGV(INFO_LEVEL, info_log_, "Peer(%s) exit!!!", peer_addr_.c_str());
 }
 
@@ -69,6 +95,8 @@ void Peer::UpdatePeerInfo() {
   for (auto& pt : peers_) {
     pt.second->set_next_index(raft_log_->GetLastLogIndex() + 1);
     pt.second->set_match_index(0);
+    pt.second->set_acked_time(0);
+    pt.second->set_probing(true);
   }
 }
 
@@ -106,7 +134,7 @@ void Peer::RequestVoteRPC() {
   }
 
   CmdResponse res;
-  Status result = pool_->SendAndRecv(peer_addr_, req, &res);
+  Status result = pool_->SendAndRecv(rpc_addr_, req, &res);
 
   if (!result.ok()) {
     LOGV(DEBUG_LEVEL, info_log_, "Peer::RequestVoteRPC: RequestVote to %s failed %s",
@@ -129,9 +157,8 @@ void Peer::RequestVoteRPC() {
         " request_vote_res.term()=%lu, current_term=%lu", options_.local_ip.c_str(), options_.local_port,
         peer_addr_.c_str(), res.request_vote_res().term(), context_->current_term);
     context_->BecomeFollower(res.request_vote_res().term());
-    raft_meta_->SetCurrentTerm(context_->current_term);
-    raft_meta_->SetVotedForIp(context_->voted_for_ip);
-    raft_meta_->SetVotedForPort(context_->voted_for_port);
+    raft_meta_->SetTermAndVote(context_->current_term, context_->voted_for_ip,
+        context_->voted_for_port);
     return;
   }
   if (context_->role == Role::kCandidate) {
@@ -144,6 +171,10 @@ void Peer::RequestVoteRPC() {
       if (CheckAndVote(res.request_vote_res().term())) {
         context_->BecomeLeader();
         UpdatePeerInfo();
+        // any entry after my log is of my term, the no-op entry refines it
+        // with its own index once appended
+        context_->term_start_index = raft_log_->GetLastLogIndex() + 1;
+        primary_->AddTask(kNoOpEntry, false);
         LOGV(INFO_LEVEL, info_log_, "Peer::RequestVoteRPC: %s:%d become leader at term %d",
             options_.local_ip.c_str(), options_.local_port, context_->current_term);
         primary_->AddTask(kHeartBeat, false);
@@ -163,34 +194,6 @@ void Peer::RequestVoteRPC() {
   return;
 }
 
-uint64_t Peer::QuorumMatchIndex() {
-  std::vector<uint64_t> values;
-  std::map<std::string, Peer*>::iterator iter;
-  for (iter = peers_.begin(); iter != peers_.end(); iter++) {
-    if (iter->first == peer_addr_) {
-      values.push_back(match_index_);
-      continue;
-    }
-    values.push_back(iter->second->match_index());
-  }
-  LOGV(DEBUG_LEVEL, info_log_, "Peer::QuorumMatchIndex: Get peers match_index %d %d %d %d",
-      values[0], values[1], values[2], values[3]);
-  std::sort(values.begin(), values.end());
-  return values.at(values.size() / 2);
-}
-
-// only leader will call AdvanceCommitIndex
-// follower only need set commit as leader's
-void Peer::AdvanceLeaderCommitIndex() {
-  Entry entry;
-  uint64_t new_commit_index = QuorumMatchIndex();
-  if (context_->commit_index < new_commit_index) {
-    context_->commit_index = new_commit_index;
-    raft_meta_->SetCommitIndex(context_->commit_index);
-  }
-  return;
-}
-
 void Peer::AddAppendEntriesTask() {
   /*
    * int timer_queue_size, queue_size;
@@ -198,69 +201,129 @@ void Peer::AddAppendEntriesTask() {
    * LOGV(INFO_LEVEL, info_log_, "Peer::AddAppendEntriesTask peer_addr %s timer_queue size %d queue_size %d",
    *     peer_addr_.c_str(),timer_queue_size, queue_size);
    */
+  if (append_entries_scheduled_.exchange(true)) {
+    return;
+  }
   bg_thread_.Schedule(&AppendEntriesRPCWrapper, this);
 }
 
 void Peer::AppendEntriesRPCWrapper(void *arg) {
-  reinterpret_cast<Peer*>(arg)->AppendEntriesRPC();
+  Peer* peer = reinterpret_cast<Peer*>(arg);
+  // cleared before building the request, so an entry appended afterwards
+  // schedules another round
+  peer->append_entries_scheduled_ = false;
+  peer->AppendEntriesRPC();
 }
 
+// keep sending until the peer catches up with the log
 void Peer::AppendEntriesRPC() {
-  uint64_t prev_log_index = 0;
+  if (options_.append_entries_window > 1) {
+    PipelineAppendEntries();
+    return;
+  }
+  while (true) {
+    CmdRequest req;
+    AppendEntriesState state;
+    bool install = false;
+    {
+    slash::MutexLock l(&context_->global_mu);
+    if (context_->role != Role::kLeader) {
+      return;
+    }
+    if (!BuildAppendEntries(&req, &state)) {
+      if (!install_snapshot_) {
+        return;
+      }
+      install_snapshot_ = false;
+      install = true;
+    }
+    }
+    if (install) {
+      InstallSnapshotRPC();
+      return;
+    }
+
+    CmdResponse res;
+    Status result = pool_->SendAndRecv(rpc_addr_, req, &res);
+
+    slash::MutexLock l(&context_->global_mu);
+    if (!result.ok()) {
+      std::string text_format;
+      google::protobuf::TextFormat::PrintToString(req, &text_format);
+      LOGV(WARN_LEVEL, info_log_, "Peer::AppendEntries: Leader %s:%d SendAndRecv to %s failed %s, \nThe error message is %s",
+           options_.local_ip.c_str(), options_.local_port, peer_addr_.c_str(), result.ToString().c_str(), text_format.c_str());
+      return;
+    }
+    HandleAppendEntriesResponse(state, res);
+    // a rejection schedules the retry itself once next_index_ is adjusted
+    if (!res.append_entries_res().success()) {
+      return;
+    }
+  }
+  return;
+}
+
+bool Peer::BuildAppendEntries(CmdRequest* req, AppendEntriesState* state) {
+  uint64_t prev_log_index = next_index_ - 1;
   uint64_t num_entries = 0;
   uint64_t prev_log_term = 0;
-  uint64_t last_log_index = 0;
-  CmdRequest req;
-  CmdRequest_AppendEntries* append_entries = req.mutable_append_entries();
-  {
-  slash::MutexLock l(&context_->global_mu);
-  prev_log_index = next_index_ - 1;
-  last_log_index = raft_log_->GetLastLogIndex();
+  uint64_t last_log_index = raft_log_->GetLastLogIndex();
   /*
    * LOGV(INFO_LEVEL, info_log_, "Peer::AppendEntriesRPC: next_index_ %d last_log_index %d peer_last_op_time %lu nowmicros %lu",
    *     next_index_.load(), last_log_index, peer_last_op_time, slash::NowMicros());
    */
-  if (next_index_ > last_log_index && peer_last_op_time + options_.heartbeat_us > slash::NowMicros()) {
-    return;
+  // the pending read round may be confirmed by an in flight AppendEntries
+  uint64_t sent_round = in_flight_.empty() ? acked_round_ : in_flight_.back().read_round;
+  if (next_index_ > last_log_index && peer_last_op_time + options_.heartbeat_us > slash::NowMicros()
+      && std::max(acked_round_, sent_round) >= primary_->read_pending_round()) {
+    return false;
   }
-  peer_last_op_time = slash::NowMicros();
-
-  if (prev_log_index != 0) {
-    Entry entry;
-    if (raft_log_->GetEntry(prev_log_index, &entry) != 0) {
-      LOGV(WARN_LEVEL, info_log_, "Peer::AppendEntriesRPC: Get my(%s:%d) Entry index %llu "
-          "not found", options_.local_ip.c_str(), options_.local_port, prev_log_index);
-    } else {
-      prev_log_term = entry.term();
-    }
+  // the entries peer needs have been compacted, send snapshot instead
+  if (raft_log_->GetTerm(prev_log_index, &prev_log_term) != 0) {
+    LOGV(WARN_LEVEL, info_log_, "Peer::AppendEntriesRPC: Get my(%s:%d) Entry index %llu "
+        "not found, install snapshot to %s", options_.local_ip.c_str(), options_.local_port,
+        prev_log_index, peer_addr_.c_str());
+    install_snapshot_ = true;
+    return false;
   }
+  peer_last_op_time = slash::NowMicros();
+  state->send_time = peer_last_op_time;
+  state->read_round = ++context_->read_round;
 
-  req.set_type(Type::kAppendEntries);
+  CmdRequest_AppendEntries* append_entries = req->mutable_append_entries();
+  req->set_type(Type::kAppendEntries);
   append_entries->set_ip(options_.local_ip);
   append_entries->set_port(options_.local_port);
   append_entries->set_term(context_->current_term);
   append_entries->set_prev_log_index(prev_log_index);
   append_entries->set_prev_log_term(prev_log_term);
   append_entries->set_leader_commit(context_->commit_index);
-  Entry *tmp_entry = new Entry();
+  // entries are copied into request as serialized in log
+  uint64_t batch_size = 0;
   for (uint64_t index = next_index_; index <= last_log_index; index++) {
-    if (raft_log_->GetEntry(index, tmp_entry) == 0) {
-      // TODO(ba0tiao) how to avoid memory copy here
-      Entry *entry = append_entries->add_entries();
-      *entry = *tmp_entry;
-    } else {
+    std::string* buf = append_entries->add_entries();
+    if (raft_log_->GetSerializedEntry(index, buf) != 0) {
+      append_entries->mutable_entries()->RemoveLast();
       LOGV(WARN_LEVEL, info_log_, "Peer::AppendEntriesRPC: peer_addr %s can't get Entry "
           "from raft_log, index %lld", peer_addr_.c_str(), index);
-      break;
+      if (num_entries > 0) {
+        break;
+      }
+      // nothing to send, sending heartbeats instead would spin. Send snapshot
+      // if the entry has been compacted, otherwise retry on next heartbeat
+      if (index <= raft_meta_->GetSnapshotIndex()) {
+        install_snapshot_ = true;
+      }
+      return false;
     }
 
     num_entries++;
+    batch_size += buf->size();
     if (num_entries >= options_.append_entries_count_once
-        || (uint64_t)append_entries->ByteSize() >= options_.append_entries_size_once) {
+        || batch_size >= options_.append_entries_size_once) {
       break;
     }
   }
-  delete tmp_entry;
   LOGV(DEBUG_LEVEL, info_log_, "Peer::AppendEntriesRPC: peer_addr(%s)'s next_index_ %llu, my last_log_index %llu"
       " AppendEntriesRPC will send %d iterm", peer_addr_.c_str(), next_index_.load(), last_log_index, num_entries);
   // if the AppendEntries don't contain any log item
@@ -268,24 +331,25 @@ void Peer::AppendEntriesRPC() {
     LOGV(INFO_LEVEL, info_log_, "Peer::AppendEntryRpc server %s:%d Send pingpong appendEntries message to %s at term %d",
         options_.local_ip.c_str(), options_.local_port, peer_addr_.c_str(), context_->current_term);
   }
-  }
 
-  CmdResponse res;
-  Status result = pool_->SendAndRecv(peer_addr_, req, &res);
-
-  {
-  slash::MutexLock l(&context_->global_mu);
-  if (!result.ok()) {
-    std::string text_format;
-    google::protobuf::TextFormat::PrintToString(req, &text_format);
-    LOGV(WARN_LEVEL, info_log_, "Peer::AppendEntries: Leader %s:%d SendAndRecv to %s failed %s, \nThe error message is %s",
-         options_.local_ip.c_str(), options_.local_port, peer_addr_.c_str(), result.ToString().c_str(), text_format.c_str());
-    return;
-  }
+  state->term = context_->current_term;
+  state->prev_log_index = prev_log_index;
+  state->num_entries = num_entries;
+  state->epoch = epoch_;
+  return true;
+}
 
+void Peer::HandleAppendEntriesResponse(const AppendEntriesState& state, const CmdResponse& res) {
   // here we may get a larger term, and transfer to follower
   // so we need to judge the role here
   if (context_->role == Role::kLeader) {
+    if (res.append_entries_res().term() == context_->current_term
+        && state.term == context_->current_term) {
+      // peer still accepts me as leader, no matter whether the log matches
+      acked_round_ = std::max(acked_round_, state.read_round);
+      acked_time_ = std::max(acked_time_, state.send_time);
+      primary_->AdvanceReadIndex();
+    }
     /*
      * receiver has higer term than myself, so turn from candidate to follower
      */
@@ -294,27 +358,35 @@ void Peer::AppendEntriesRPC() {
           "from peer %s, local term is %d, peer term is %d", options_.local_ip.c_str(), options_.local_port,
           peer_addr_.c_str(), context_->current_term, res.append_entries_res().term());
       context_->BecomeFollower(res.append_entries_res().term());
-      raft_meta_->SetCurrentTerm(context_->current_term);
-      raft_meta_->SetVotedForIp(context_->voted_for_ip);
-      raft_meta_->SetVotedForPort(context_->voted_for_port);
+      raft_meta_->SetTermAndVote(context_->current_term, context_->voted_for_ip,
+          context_->voted_for_port);
     } else if (res.append_entries_res().success() == true) {
-      if (num_entries > 0) {
-        match_index_ = prev_log_index + num_entries;
-        // only log entries from the leader's current term are committed
-        // by counting replicas
-        if (append_entries->entries(num_entries - 1).term() == context_->current_term) {
-          AdvanceLeaderCommitIndex();
-          apply_->ScheduleApply();
+      probing_ = false;
+      snapshot_sent_index_ = 0;
+      if (state.num_entries > 0) {
+        match_index_ = state.prev_log_index + state.num_entries;
+        primary_->AdvanceCommitIndex();
+        // in pipelined mode next_index_ has been advanced when sending
+        if (next_index_ < state.prev_log_index + state.num_entries + 1) {
+          next_index_ = state.prev_log_index + state.num_entries + 1;
         }
-        next_index_ = prev_log_index + num_entries + 1;
       }
     } else {
       LOGV(INFO_LEVEL, info_log_, "Peer::AppEntriesRPC: peer_addr %s Send AppEntriesRPC failed,"
           "peer's last_log_index %lu, peer's next_index_ %lu",
           peer_addr_.c_str(), res.append_entries_res().last_log_index(), next_index_.load());
       uint64_t adjust_index = std::min(res.append_entries_res().last_log_index() + 1,
-                                       next_index_ - 1);
-      if (adjust_index > 0) {
+                                       state.prev_log_index);
+      // the AppendEntries sent after this one are based on a wrong next_index_,
+      // ignore their responses and probe one by one until log matches
+      epoch_++;
+      probing_ = true;
+      if (res.append_entries_res().last_log_index() < snapshot_sent_index_
+          && slash::NowMicros() < snapshot_sent_time_ + options_.check_leader_us) {
+        // peer is still installing the snapshot, probe again on next heartbeat
+        // rather than sending the snapshot once more
+        next_index_ = snapshot_sent_index_ + 1;
+      } else if (adjust_index > 0) {
         // Prev log don't match, so we retry with more prev one according to
         // response
         next_index_ = adjust_index;
@@ -331,8 +403,212 @@ void Peer::AppendEntriesRPC() {
     LOGV(INFO_LEVEL, info_log_, "Peer::AppEntriesRPC: Server %s:%d have transformed to candidate when doing AppEntriesRPC, "
         "new term is %lu", options_.local_ip.c_str(), options_.local_port, context_->current_term);
   }
+}
+
+/*
+ * Pipelined replication, keep at most append_entries_window AppendEntries
+ * outstanding on a dedicated connection, next_index_ is advanced
+ * optimistically once an AppendEntries is sent. The follower handles the
+ * requests of one connection in order, so responses come back in order.
+ */
+void Peer::PipelineAppendEntries() {
+  while (true) {
+    CmdRequest req;
+    AppendEntriesState state;
+    bool send = false;
+    bool install = false;
+    {
+    slash::MutexLock l(&context_->global_mu);
+    if (context_->role != Role::kLeader) {
+      if (!in_flight_.empty()) {
+        ResetPipeline();
+      }
+      return;
+    }
+    // only one AppendEntries is outstanding in probe mode
+    size_t window = probing_ ? 1 : options_.append_entries_window;
+    if (in_flight_.size() < window) {
+      send = BuildAppendEntries(&req, &state);
+    }
+    if (send) {
+      next_index_ = state.prev_log_index + state.num_entries + 1;
+      in_flight_.push_back(state);
+    } else if (in_flight_.empty()) {
+      if (!install_snapshot_) {
+        return;
+      }
+      install_snapshot_ = false;
+      install = true;
+    }
+    }
+
+    if (install) {
+      InstallSnapshotRPC();
+      return;
+    }
+
+    Status result;
+    if (send) {
+      result = pool_->UpHoldCli(pipeline_client_);
+      if (result.ok()) {
+        result = pipeline_client_->cli->Send(&req);
+      }
+      if (!result.ok()) {
+        slash::MutexLock l(&context_->global_mu);
+        LOGV(WARN_LEVEL, info_log_, "Peer::PipelineAppendEntries: Leader %s:%d Send to %s failed %s",
+            options_.local_ip.c_str(), options_.local_port, peer_addr_.c_str(), result.ToString().c_str());
+        ResetPipeline();
+        return;
+      }
+      // fill the window before waiting for response
+      continue;
+    }
+
+    CmdResponse res;
+    result = pipeline_client_->cli->Recv(&res);
+    slash::MutexLock l(&context_->global_mu);
+    if (!result.ok()) {
+      LOGV(WARN_LEVEL, info_log_, "Peer::PipelineAppendEntries: Leader %s:%d Recv from %s failed %s",
+          options_.local_ip.c_str(), options_.local_port, peer_addr_.c_str(), result.ToString().c_str());
+      ResetPipeline();
+      return;
+    }
+    state = in_flight_.front();
+    in_flight_.pop_front();
+    if (state.epoch == epoch_) {
+      HandleAppendEntriesResponse(state, res);
+    }
   }
-  return;
+}
+
+// the responses of in flight AppendEntries are lost with the connection,
+// resend from the oldest one of current epoch
+void Peer::ResetPipeline() {
+  pipeline_client_->cli->Close();
+  for (auto& state : in_flight_) {
+    if (state.epoch == epoch_) {
+      next_index_ = state.prev_log_index + 1;
+      break;
+    }
+  }
+  in_flight_.clear();
+  epoch_++;
+}
+
+/*
+ * stream the files of the latest snapshot to peer in chunks,
+ * peer's log continues from the snapshot after the last chunk is accepted
+ */
+void Peer::InstallSnapshotRPC() {
+  uint64_t term;
+  {
+  slash::MutexLock l(&context_->global_mu);
+  if (context_->role != Role::kLeader) {
+    return;
+  }
+  term = context_->current_term;
+  }
+  uint64_t snapshot_index, snapshot_term;
+  if (!apply_->AcquireSnapshot(&snapshot_index, &snapshot_term)) {
+    LOGV(WARN_LEVEL, info_log_, "Peer::InstallSnapshotRPC: no snapshot to send to %s", peer_addr_.c_str());
+    return;
+  }
+  std::string snapshot_path = apply_->SnapshotPath();
+  std::vector<std::string> files;
+  if (slash::GetChildren(snapshot_path, files) != 0) {
+    LOGV(WARN_LEVEL, info_log_, "Peer::InstallSnapshotRPC: list snapshot failed, %s", strerror(errno));
+    apply_->ReleaseSnapshot();
+    return;
+  }
+  LOGV(INFO_LEVEL, info_log_, "Peer::InstallSnapshotRPC: begin to send snapshot at index %lu term %lu to %s",
+      snapshot_index, snapshot_term, peer_addr_.c_str());
+  uint64_t start_time = slash::NowMicros();
+  uint64_t offset = 0;
+  // the file being sent and the offset in it
+  size_t file_i = 0;
+  int fd = -1;
+  uint64_t file_offset = 0;
+  while (true) {
+    CmdRequest req;
+    req.set_type(Type::kInstallSnapshot);
+    CmdRequest_InstallSnapshot* install_snapshot = req.mutable_install_snapshot();
+    install_snapshot->set_term(term);
+    install_snapshot->set_ip(options_.local_ip);
+    install_snapshot->set_port(options_.local_port);
+    install_snapshot->set_last_included_index(snapshot_index);
+    install_snapshot->set_last_included_term(snapshot_term);
+    install_snapshot->set_offset(offset);
+    bool read_error = false;
+    if (file_i < files.size()) {
+      if (fd < 0) {
+        fd = open((snapshot_path + "/" + files[file_i]).c_str(), O_RDONLY);
+        file_offset = 0;
+      }
+      std::string* data = install_snapshot->mutable_data();
+      data->resize(options_.install_snapshot_chunk_size);
+      ssize_t n = fd < 0 ? -1 : pread(fd, &(*data)[0], data->size(), file_offset);
+      if (n < 0) {
+        read_error = true;
+      } else {
+        data->resize(n);
+        install_snapshot->set_file_name(files[file_i]);
+        file_offset += n;
+        // a chunk shorter than requested ends the file
+        if (static_cast<uint64_t>(n) < options_.install_snapshot_chunk_size) {
+          close(fd);
+          fd = -1;
+          file_i++;
+        }
+      }
+    }
+    if (read_error) {
+      LOGV(WARN_LEVEL, info_log_, "Peer::InstallSnapshotRPC: read snapshot file %s failed, %s",
+          files[file_i].c_str(), strerror(errno));
+      break;
+    }
+    install_snapshot->set_done(file_i == files.size());
+
+    CmdResponse res;
+    Status result = pool_->SendAndRecv(rpc_addr_, req, &res);
+    slash::MutexLock l(&context_->global_mu);
+    if (!result.ok()) {
+      LOGV(WARN_LEVEL, info_log_, "Peer::InstallSnapshotRPC: send snapshot chunk at offset %lu to %s failed, %s",
+          offset, peer_addr_.c_str(), result.ToString().c_str());
+      break;
+    }
+    if (res.install_snapshot_res().term() > context_->current_term) {
+      LOGV(INFO_LEVEL, info_log_, "Peer::InstallSnapshotRPC: %s:%d Transfer from Leader to Follower since get A larger term"
+          "from peer %s, local term is %d, peer term is %d", options_.local_ip.c_str(), options_.local_port,
+          peer_addr_.c_str(), context_->current_term, res.install_snapshot_res().term());
+      context_->BecomeFollower(res.install_snapshot_res().term());
+      raft_meta_->SetTermAndVote(context_->current_term, context_->voted_for_ip,
+          context_->voted_for_port);
+      break;
+    }
+    if (context_->role != Role::kLeader || context_->current_term != term
+        || !res.install_snapshot_res().success()) {
+      LOGV(WARN_LEVEL, info_log_, "Peer::InstallSnapshotRPC: %s refused snapshot chunk at offset %lu",
+          peer_addr_.c_str(), offset);
+      break;
+    }
+    offset += install_snapshot->data().size();
+    if (install_snapshot->done()) {
+      LOGV(INFO_LEVEL, info_log_, "Peer::InstallSnapshotRPC: sent %lu bytes of snapshot at index %lu to %s,"
+          " takes %lu us", offset, snapshot_index, peer_addr_.c_str(), slash::NowMicros() - start_time);
+      // peer installs the snapshot after the last chunk, which may still
+      // fail, match_index_ is only advanced when AppendEntries probes it
+      next_index_ = snapshot_index + 1;
+      probing_ = true;
+      snapshot_sent_index_ = snapshot_index;
+      snapshot_sent_time_ = slash::NowMicros();
+      AddAppendEntriesTask();
+      break;
+    }
+  }
+  if (fd >= 0) {
+    close(fd);
+  }
+  apply_->ReleaseSnapshot();
 }
 
 }  // namespace floyd
@@ -8,6 +8,7 @@
 
 #include <string>
 #include <map>
+#include <deque>
 
 #include "slash/include/slash_status.h"
 #include "pink/include/bg_thread.h"
@@ -22,6 +23,9 @@ class RaftMeta;
 class FloydPrimary;
 class RaftLog;
 class ClientPool;
+struct Client;
+class CmdRequest;
+class CmdResponse;
 class FloydApply;
 class Peer;
 typedef std::map<std::string, Peer*> PeersSet;
@@ -68,6 +72,24 @@ class Peer  {
     return match_index_;
   }
 
+  // the latest read round acknowledged by peer, protected by global_mu
+  uint64_t acked_round() {
+    return acked_round_;
+  }
+
+  // send time of the latest AppendEntries acknowledged by peer in my term,
+  // protected by global_mu
+  void set_acked_time(const uint64_t acked_time) {
+    acked_time_ = acked_time;
+  }
+  uint64_t acked_time() {
+    return acked_time_;
+  }
+
+  void set_probing(const bool probing) {
+    probing_ = probing;
+  }
+
   void set_peers(const PeersSet &peers) {
     peers_ = peers;
   }
@@ -77,11 +99,28 @@ class Peer  {
 
  private:
   bool CheckAndVote(uint64_t vote_term);
-  uint64_t QuorumMatchIndex();
-  void AdvanceLeaderCommitIndex();
   void UpdatePeerInfo();
 
+  // an AppendEntries sent to peer, waiting for the response
+  struct AppendEntriesState {
+    uint64_t term;
+    uint64_t prev_log_index;
+    uint64_t num_entries;
+    uint64_t read_round;
+    uint64_t send_time;
+    uint64_t epoch;
+  };
+  // called with global_mu held, return false if nothing need to be sent or
+  // the entries can not be read, install_snapshot_ is set if they are compacted
+  bool BuildAppendEntries(CmdRequest* req, AppendEntriesState* state);
+  void HandleAppendEntriesResponse(const AppendEntriesState& state, const CmdResponse& res);
+  void PipelineAppendEntries();
+  void ResetPipeline();
+  void InstallSnapshotRPC();
+
   std::string peer_addr_;
+  // where the RPCs are sent, on the consensus port of peer if configured
+  std::string rpc_addr_;
   FloydContext* context_;
   FloydPrimary* primary_;
   RaftMeta* raft_meta_;
@@ -96,7 +135,25 @@ class Peer  {
   std::atomic<uint64_t> next_index_;
   std::atomic<uint64_t> match_index_;
   uint64_t peer_last_op_time;
-
+  uint64_t acked_round_;
+  uint64_t acked_time_;
+
+  // pipelined mode, all protected by global_mu
+  Client* pipeline_client_;
+  std::deque<AppendEntriesState> in_flight_;
+  // bumped when the in flight AppendEntries become useless
+  uint64_t epoch_;
+  bool probing_;
+  // the entries peer needs have been compacted, protected by global_mu
+  bool install_snapshot_;
+  // peer accepted all chunks of the snapshot at this index at the time,
+  // and is installing it. protected by global_mu
+  uint64_t snapshot_sent_index_;
+  uint64_t snapshot_sent_time_;
+
+  // an AppendEntriesRPC is waiting in bg_thread_, the wake-ups meanwhile
+  // are covered by it
+  std::atomic<bool> append_entries_scheduled_;
   pink::BGThread bg_thread_;
 
   // No copying allowed
@@ -21,18 +21,23 @@
 #include "floyd/src/floyd_context.h"
 #include "floyd/src/floyd_client_pool.h"
 #include "floyd/src/raft_meta.h"
+#include "floyd/src/raft_log.h"
 #include "floyd/src/floyd.pb.h"
 #include "floyd/src/logger.h"
 #include "floyd/include/floyd_options.h"
 
 namespace floyd {
 
-FloydPrimary::FloydPrimary(FloydContext* context, RaftMeta* raft_meta,
-    const Options& options, Logger* info_log)
+FloydPrimary::FloydPrimary(FloydContext* context, RaftMeta* raft_meta, RaftLog* raft_log,
+    FloydApply* apply, const Options& options, Logger* info_log)
   : context_(context),
     raft_meta_(raft_meta),
+    raft_log_(raft_log),
+    apply_(apply),
     options_(options),
-    info_log_(info_log) {
+    info_log_(info_log),
+    new_command_scheduled_(false),
+    read_pending_round_(0) {
 }
 
 int FloydPrimary::Start() {
@@ -79,7 +84,24 @@ void FloydPrimary::AddTask(TaskType type, bool is_delay) {
     break;
   }
   case kNewCommand: {
-    bg_thread_.Schedule(LaunchNewCommandWrapper, this);
+    // one pending task notices peers of all the commands appended meanwhile
+    if (!new_command_scheduled_.exchange(true)) {
+      bg_thread_.Schedule(LaunchNewCommandWrapper, this);
+    }
+    break;
+  }
+  case kLogDurable: {
+    bg_thread_.Schedule(LaunchLogDurableWrapper, this);
+    break;
+  }
+  case kNoOpEntry: {
+    // delayed when retrying a failed append
+    if (is_delay) {
+      uint64_t timeout = options_.heartbeat_us;
+      bg_thread_.DelaySchedule(timeout / 1000LL, LaunchNoOpEntryWrapper, this);
+    } else {
+      bg_thread_.Schedule(LaunchNoOpEntryWrapper, this);
+    }
     break;
   }
   default: {
@@ -99,6 +121,7 @@ void FloydPrimary::LaunchHeartBeat() {
     NoticePeerTask(kNewCommand);
     AddTask(kHeartBeat);
   }
+  AdvanceReadIndex();
 }
 
 void FloydPrimary::LaunchCheckLeaderWrapper(void *arg) {
@@ -112,25 +135,26 @@ void FloydPrimary::LaunchCheckLeader() {
       context_->BecomeLeader();
       context_->voted_for_ip = options_.local_ip;
       context_->voted_for_port = options_.local_port;
-      raft_meta_->SetCurrentTerm(context_->current_term);
-      raft_meta_->SetVotedForIp(context_->voted_for_ip);
-      raft_meta_->SetVotedForPort(context_->voted_for_port);
+      raft_meta_->SetTermAndVote(context_->current_term, context_->voted_for_ip,
+          context_->voted_for_port);
     } else if (context_->last_op_time + options_.check_leader_us < slash::NowMicros()) {
       context_->BecomeCandidate();
       LOGV(INFO_LEVEL, info_log_, "FloydPrimary::LaunchCheckLeader: %s:%d Become Candidate because of timeout, new term is %d"
          " voted for %s:%d", options_.local_ip.c_str(), options_.local_port, context_->current_term,
          context_->voted_for_ip.c_str(), context_->voted_for_port);
-      raft_meta_->SetCurrentTerm(context_->current_term);
-      raft_meta_->SetVotedForIp(context_->voted_for_ip);
-      raft_meta_->SetVotedForPort(context_->voted_for_port);
+      raft_meta_->SetTermAndVote(context_->current_term, context_->voted_for_ip,
+          context_->voted_for_port);
       NoticePeerTask(kHeartBeat);
     }
   }
+  AdvanceReadIndex();
   AddTask(kCheckLeader);
 }
 
 void FloydPrimary::LaunchNewCommandWrapper(void *arg) {
-  reinterpret_cast<FloydPrimary *>(arg)->LaunchNewCommand();
+  FloydPrimary* primary = reinterpret_cast<FloydPrimary *>(arg);
+  primary->new_command_scheduled_ = false;
+  primary->LaunchNewCommand();
 }
 
 void FloydPrimary::LaunchNewCommand() {
@@ -142,6 +166,153 @@ void FloydPrimary::LaunchNewCommand() {
   NoticePeerTask(kNewCommand);
 }
 
+void FloydPrimary::LaunchLogDurableWrapper(void *arg) {
+  reinterpret_cast<FloydPrimary *>(arg)->LaunchLogDurable();
+}
+
+void FloydPrimary::LaunchLogDurable() {
+  slash::MutexLock l(&context_->global_mu);
+  AdvanceCommitIndex();
+}
+
+void FloydPrimary::LaunchNoOpEntryWrapper(void *arg) {
+  reinterpret_cast<FloydPrimary *>(arg)->LaunchNoOpEntry();
+}
+
+void FloydPrimary::LaunchNoOpEntry() {
+  uint64_t term;
+  {
+  slash::MutexLock l(&context_->global_mu);
+  if (context_->role != Role::kLeader) {
+    return;
+  }
+  term = context_->current_term;
+  }
+  if (noop_callback_) {
+    noop_callback_(term);
+  }
+}
+
+// the largest value agreed by quorum peers, who form a majority with me
+static uint64_t QuorumValue(std::vector<uint64_t>* values, size_t quorum) {
+  std::sort(values->begin(), values->end(), std::greater<uint64_t>());
+  if (quorum == 0 || values->size() < quorum) {
+    return 0;
+  }
+  return (*values)[quorum - 1];
+}
+
+void FloydPrimary::AdvanceCommitIndex() {
+  if (context_->role != Role::kLeader) {
+    return;
+  }
+  std::vector<uint64_t> values;
+  values.push_back(raft_log_->GetDurableIndex());
+  for (auto& peer : peers_) {
+    values.push_back(peer.second->match_index());
+  }
+  std::sort(values.begin(), values.end());
+  uint64_t new_commit_index = values.at((values.size() - 1) / 2);
+  if (new_commit_index <= context_->commit_index) {
+    return;
+  }
+  // only log entries from the leader's current term are committed
+  // by counting replicas
+  Entry entry;
+  if (raft_log_->GetEntry(new_commit_index, &entry) != 0
+      || entry.term() != context_->current_term) {
+    return;
+  }
+  context_->commit_index = new_commit_index;
+  raft_meta_->SetCommitIndex(context_->commit_index);
+  apply_->ScheduleApply();
+}
+
+bool FloydPrimary::LeaseReadIndex(uint64_t* read_index) {
+  slash::MutexLock l(&context_->global_mu);
+  // entries of former terms may be not committed yet
+  if (context_->role != Role::kLeader
+      || context_->commit_index < context_->term_start_index) {
+    return false;
+  }
+  std::vector<uint64_t> acked_times;
+  for (auto& peer : peers_) {
+    acked_times.push_back(peer.second->acked_time());
+  }
+  uint64_t lease_start = QuorumValue(&acked_times, options_.members.size() / 2);
+  // followers won't vote for others within check_leader_us after lease_start
+  if (lease_start == 0
+      || lease_start + options_.check_leader_us <= slash::NowMicros() + options_.lease_drift_us) {
+    return false;
+  }
+  *read_index = context_->commit_index;
+  return true;
+}
+
+void FloydPrimary::AddReadIndex(const ReadIndexCallback& callback) {
+  slash::MutexLock l(&context_->global_mu);
+  if (context_->role != Role::kLeader) {
+    bg_thread_.Schedule(&ReadIndexCallbackWrapper, new std::vector<ReadIndexResult>(
+          1, ReadIndexResult(callback, Status::Incomplete("not leader"))));
+    return;
+  }
+  ReadIndexRequest request;
+  // only AppendEntries sent after now can confirm the leadership
+  request.round = context_->read_round + 1;
+  request.term = context_->current_term;
+  request.read_index = std::max(context_->commit_index, context_->term_start_index);
+  request.deadline = slash::NowMicros() + options_.check_leader_us;
+  request.callback = callback;
+  read_requests_.push_back(request);
+  if (request.round > read_pending_round_) {
+    // the first request of this round notice the peers,
+    // the others share the same round
+    read_pending_round_ = request.round;
+    NoticePeerTask(kNewCommand);
+  }
+}
+
+void FloydPrimary::AdvanceReadIndex() {
+  if (read_requests_.empty()) {
+    return;
+  }
+  // a round is confirmed when a quorum, including me, acknowledged it
+  std::vector<uint64_t> rounds;
+  for (auto& peer : peers_) {
+    rounds.push_back(peer.second->acked_round());
+  }
+  uint64_t quorum_round = QuorumValue(&rounds, options_.members.size() / 2);
+
+  uint64_t now = slash::NowMicros();
+  std::vector<ReadIndexResult>* finished = new std::vector<ReadIndexResult>();
+  std::deque<ReadIndexRequest> waiting;
+  for (auto& request : read_requests_) {
+    if (context_->role != Role::kLeader || context_->current_term != request.term) {
+      finished->push_back(ReadIndexResult(request.callback, Status::Incomplete("leader changed")));
+    } else if (request.round <= quorum_round) {
+      finished->push_back(ReadIndexResult(request.callback, Status::OK(), request.read_index));
+    } else if (request.deadline < now) {
+      finished->push_back(ReadIndexResult(request.callback, Status::Timeout("ReadIndex timeout")));
+    } else {
+      waiting.push_back(request);
+    }
+  }
+  read_requests_.swap(waiting);
+  if (finished->empty()) {
+    delete finished;
+    return;
+  }
+  bg_thread_.Schedule(&ReadIndexCallbackWrapper, finished);
+}
+
+void FloydPrimary::ReadIndexCallbackWrapper(void *arg) {
+  std::vector<ReadIndexResult>* finished = reinterpret_cast<std::vector<ReadIndexResult>*>(arg);
+  for (auto& result : *finished) {
+    result.callback(result.status, result.read_index);
+  }
+  delete finished;
+}
+
 // when adding task to peer thread, we can consider that this job have been in the network
 // even it is still in the peer thread's queue
 void FloydPrimary::NoticePeerTask(TaskType type) {
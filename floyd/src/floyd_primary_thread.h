@@ -9,6 +9,8 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <deque>
+#include <functional>
 
 
 #include "slash/include/env.h"
@@ -28,38 +30,93 @@ class FloydPrimary;
 class FloydContext;
 class FloydApply;
 class RaftMeta;
+class RaftLog;
 class Peer;
 class Options;
 
 enum TaskType {
   kHeartBeat = 0,
   kCheckLeader = 1,
-  kNewCommand = 2
+  kNewCommand = 2,
+  kLogDurable = 3,
+  kNoOpEntry = 4
 };
 
 class FloydPrimary {
  public:
-  FloydPrimary(FloydContext* context, RaftMeta* raft_meta, const Options& options, Logger* info_log);
+  FloydPrimary(FloydContext* context, RaftMeta* raft_meta, RaftLog* raft_log,
+      FloydApply* apply, const Options& options, Logger* info_log);
   ~FloydPrimary();
 
   int Start();
   int Stop();
   void AddTask(TaskType type, bool is_delay = true);
+  // appends the no-op entry of a new leader through group commit, called
+  // in primary thread without global_mu with the term of the leader
+  void set_noop_callback(const std::function<void(uint64_t term)>& callback) {
+    noop_callback_ = callback;
+  }
   void set_peers(PeersSet peers) {
     peers_ = peers;
   }
 
+  /*
+   * ReadIndex, leader records its commit index as read index, and
+   * confirms it is still the leader by a round of AppendEntries.
+   * callback is invoked in primary thread
+   */
+  typedef std::function<void(const Status& s, uint64_t read_index)> ReadIndexCallback;
+  void AddReadIndex(const ReadIndexCallback& callback);
+  // called by peer with global_mu held after AppendEntries is acknowledged
+  void AdvanceReadIndex();
+  uint64_t read_pending_round() {
+    return read_pending_round_;
+  }
+  // in lease mode, return true and set the read index if leader's lease
+  // is still valid, no network round trip is needed
+  bool LeaseReadIndex(uint64_t* read_index);
+
+  // called with global_mu held, when peer acknowledged entries or leader's
+  // own entries became durable, leader counts itself by its durable index
+  void AdvanceCommitIndex();
+
  private:
   FloydContext* context_;
   RaftMeta* raft_meta_;
+  RaftLog* raft_log_;
+  FloydApply* apply_;
   PeersSet peers_;
   Options options_;
   Logger* info_log_;
 
   std::atomic<uint64_t> reset_elect_leader_time_;
   std::atomic<uint64_t> reset_leader_heartbeat_time_;
+  // a LaunchNewCommand is waiting in bg_thread_
+  std::atomic<bool> new_command_scheduled_;
+  std::function<void(uint64_t term)> noop_callback_;
   pink::BGThread bg_thread_;
 
+  struct ReadIndexRequest {
+    uint64_t round;
+    uint64_t term;
+    uint64_t read_index;
+    uint64_t deadline;
+    ReadIndexCallback callback;
+  };
+  struct ReadIndexResult {
+    ReadIndexCallback callback;
+    Status status;
+    uint64_t read_index;
+    ReadIndexResult(const ReadIndexCallback& _callback, const Status& _status,
+                    uint64_t _read_index = 0)
+      : callback(_callback), status(_status), read_index(_read_index) {}
+  };
+  // protected by context_->global_mu, ordered by round
+  std::deque<ReadIndexRequest> read_requests_;
+  // the largest round waited by read requests
+  uint64_t read_pending_round_;
+  static void ReadIndexCallbackWrapper(void *arg);
+
   // The Launch* work is done by floyd_peer_thread
   // Cron task
   static void LaunchHeartBeatWrapper(void *arg);
@@ -68,6 +125,12 @@ class FloydPrimary {
   void LaunchCheckLeader();
   static void LaunchNewCommandWrapper(void *arg);
   void LaunchNewCommand();
+  // leader's own log became durable in group sync mode
+  static void LaunchLogDurableWrapper(void *arg);
+  void LaunchLogDurable();
+  // new leader appends its no-op entry
+  static void LaunchNoOpEntryWrapper(void *arg);
+  void LaunchNoOpEntry();
 
   void NoticePeerTask(TaskType type);
 
@@ -14,16 +14,25 @@
 namespace floyd {
 using slash::Status;
 
-FloydWorker::FloydWorker(int port, int cron_interval, FloydImpl* floyd)
-  : conn_factory_(floyd),
-    handle_(floyd) {
-    thread_ = pink::NewHolyThread(port, &conn_factory_, cron_interval, &handle_);
+/*
+ * DealMessage of a client command blocks until it is applied, and an
+ * AppendEntries waits for its entries to be durable, handling every
+ * connection in one thread would stall the other members meanwhile
+ */
+FloydWorker::FloydWorker(int port, int work_num, int cron_interval,
+                         int queue_limit, FloydImpl* floyd, bool consensus_only)
+  : conn_factory_(floyd, consensus_only),
+    handle_(floyd),
+    name_(consensus_only ? "FloydConsensus" : "FloydWorker") {
+    thread_ = pink::NewDispatchThread(port, work_num, &conn_factory_,
+                                      cron_interval, queue_limit, &handle_);
 }
 
 FloydWorkerConn::FloydWorkerConn(int fd, const std::string& ip_port,
-    pink::ServerThread* thread, FloydImpl* floyd)
+    pink::ServerThread* thread, FloydImpl* floyd, bool consensus_only)
   : PbConn(fd, ip_port, thread),
-  floyd_(floyd) {
+  floyd_(floyd),
+  consensus_only_(consensus_only) {
   }
 
 FloydWorkerConn::~FloydWorkerConn() {}
@@ -39,9 +48,20 @@ int FloydWorkerConn::DealMessage() {
   response_.Clear();
   set_is_reply(true);
 
+  if (consensus_only_
+      && request_.type() != Type::kRequestVote
+      && request_.type() != Type::kAppendEntries
+      && request_.type() != Type::kInstallSnapshot) {
+    LOGV(WARN_LEVEL, floyd_->info_log_, "FloydWorker: cmd type %d is not served on consensus port",
+        request_.type());
+    return -1;
+  }
+
   switch (request_.type()) {
     case Type::kWrite:
     case Type::kDelete:
+    case Type::kWriteBatch:
+    case Type::kCommand:
     case Type::kRead: {
       floyd_->DoCommand(request_, &response_);
       break;
@@ -59,6 +79,18 @@ int FloydWorkerConn::DealMessage() {
       floyd_->ReplyAppendEntries(request_, &response_);
       break;
     }
+    case Type::kReadIndex: {
+      floyd_->ReplyReadIndex(request_, &response_);
+      break;
+    }
+    case Type::kInstallSnapshot: {
+      floyd_->ReplyInstallSnapshot(request_, &response_);
+      break;
+    }
+    case Type::kForwardBatch: {
+      floyd_->ReplyForwardBatch(request_, &response_);
+      break;
+    }
     default:
       LOGV(WARN_LEVEL, floyd_->info_log_, "unknown cmd type");
       return -1;
@@ -21,29 +21,32 @@ class FloydWorkerHandle;
 class FloydWorkerConn : public pink::PbConn {
  public:
   FloydWorkerConn(int fd, const std::string& ip_port,
-      pink::ServerThread* thread, FloydImpl* floyd);
+      pink::ServerThread* thread, FloydImpl* floyd, bool consensus_only);
   virtual ~FloydWorkerConn();
 
   virtual int DealMessage();
 
  private:
   FloydImpl* floyd_;
+  bool consensus_only_;
   CmdRequest request_;
   CmdResponse  response_;
 };
 
 class FloydWorkerConnFactory : public pink::ConnFactory {
  public:
-  explicit FloydWorkerConnFactory(FloydImpl* floyd)
-    : floyd_(floyd) {}
+  FloydWorkerConnFactory(FloydImpl* floyd, bool consensus_only)
+    : floyd_(floyd),
+      consensus_only_(consensus_only) {}
 
   pink::PinkConn *NewPinkConn(int connfd, const std::string &ip_port,
       pink::ServerThread *server_thread, void* worker_private_data) const override {
-    return new FloydWorkerConn(connfd, ip_port, server_thread, floyd_);
+    return new FloydWorkerConn(connfd, ip_port, server_thread, floyd_, consensus_only_);
   }
 
  private:
   FloydImpl* floyd_;
+  bool consensus_only_;
 };
 
 class FloydWorkerHandle : public pink::ServerHandle {
@@ -57,7 +60,9 @@ class FloydWorkerHandle : public pink::ServerHandle {
 
 class FloydWorker {
  public:
-  FloydWorker(int port, int cron_interval, FloydImpl* floyd);
+  // with consensus_only, serve only the RPCs between members
+  FloydWorker(int port, int work_num, int cron_interval, int queue_limit,
+              FloydImpl* floyd, bool consensus_only = false);
 
   ~FloydWorker() {
     // thread_->StopThread();
@@ -65,7 +70,7 @@ class FloydWorker {
   }
 
   int Start() {
-    thread_->set_thread_name("FloydWorker");
+    thread_->set_thread_name(name_);
     return thread_->StartThread();
   }
 
@@ -76,6 +81,7 @@ class FloydWorker {
  private:
   FloydWorkerConnFactory conn_factory_;
   FloydWorkerHandle handle_;
+  std::string name_;
   pink::ServerThread* thread_;
 };
 
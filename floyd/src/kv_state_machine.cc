@@ -0,0 +1,263 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#include "floyd/src/kv_state_machine.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "rocksdb/utilities/checkpoint.h"
+#include "rocksdb/write_batch.h"
+#include "slash/include/env.h"
+#include "slash/include/slash_mutex.h"
+
+#include "floyd/src/logger.h"
+#include "floyd/src/floyd.pb.h"
+#include "floyd/include/floyd_options.h"
+
+namespace floyd {
+
+extern std::string UintToBitStr(const uint64_t num);
+extern uint64_t BitStrToUint(const std::string &str);
+
+// begins with '\0' so it is sorted before the user keys which are printable
+// in practice, it lives in the default column family with them so that a
+// flush never persists the data of a batch without its index
+static const std::string kAppliedIndexKey("\0floyd_applied_index", 20);
+
+KvStateMachine::KvStateMachine(const std::string& path, bool disable_wal,
+                               Logger* info_log)
+  : path_(path),
+    info_log_(info_log),
+    db_(NULL) {
+  write_options_.disableWAL = disable_wal;
+  pthread_rwlock_init(&rwlock_, NULL);
+}
+
+KvStateMachine::~KvStateMachine() {
+  if (db_ != NULL && write_options_.disableWAL) {
+    // keep the replay short after a clean shutdown
+    rocksdb::Status s = db_->Flush(rocksdb::FlushOptions());
+    if (!s.ok()) {
+      LOGV(WARN_LEVEL, info_log_, "KvStateMachine flush on close failed, %s",
+          s.ToString().c_str());
+    }
+  }
+  delete db_;
+  pthread_rwlock_destroy(&rwlock_);
+}
+
+Status KvStateMachine::Open() {
+  slash::WriteLock l(&rwlock_);
+  // crashed while restoring, the previous db is aside
+  std::string old_path = path_ + ".old";
+  if (!slash::FileExists(path_) && slash::FileExists(old_path)) {
+    slash::RenameFile(old_path, path_);
+  }
+  return OpenDB();
+}
+
+// called with rwlock_ write locked
+Status KvStateMachine::OpenDB() {
+  rocksdb::Options options;
+  options.create_if_missing = true;
+  // options.disableDataSync = true;
+  options.write_buffer_size = 1024 * 1024 * 1024;
+  options.max_background_flushes = 8;
+  rocksdb::Status s = rocksdb::DB::Open(options, path_, &db_);
+  if (!s.ok()) {
+    db_ = NULL;
+    LOGV(ERROR_LEVEL, info_log_, "KvStateMachine open db failed! path: %s, %s",
+        path_.c_str(), s.ToString().c_str());
+    return Status::Corruption("Open DB failed, " + s.ToString());
+  }
+  return Status::OK();
+}
+
+Status KvStateMachine::ApplyBatch(uint64_t last_index,
+                                  const std::vector<const std::string*>& commands) {
+  rocksdb::WriteBatch batch;
+  KvCommand command;
+  for (auto buf : commands) {
+    if (!command.ParseFromString(*buf)) {
+      return Status::Corruption("parse KvCommand failed");
+    }
+    for (int i = 0; i < command.ops_size(); i++) {
+      const Entry_Operation& op = command.ops(i);
+      if (IsReservedKey(op.key())) {
+        // refused when the command was issued, except by older version
+        continue;
+      }
+      if (op.optype() == Entry_OpType_kWrite) {
+        batch.Put(op.key(), op.value());
+      } else if (op.optype() == Entry_OpType_kDelete) {
+        batch.Delete(op.key());
+      }
+    }
+  }
+  batch.Put(kAppliedIndexKey, UintToBitStr(last_index));
+  slash::ReadLock l(&rwlock_);
+  if (db_ == NULL) {
+    return Status::Corruption("db is not opened");
+  }
+  rocksdb::Status s = db_->Write(write_options_, &batch);
+  if (!s.ok()) {
+    return Status::Corruption(s.ToString());
+  }
+  return Status::OK();
+}
+
+/*
+ * the checkpoint flushes the memtable, so the flushed state always covers the
+ * snapshot index and the raft log before it may be truncated even without WAL
+ */
+Status KvStateMachine::Snapshot(const std::string& path) {
+  slash::ReadLock l(&rwlock_);
+  if (db_ == NULL) {
+    return Status::Corruption("db is not opened");
+  }
+  rocksdb::Checkpoint* checkpoint;
+  rocksdb::Status s = rocksdb::Checkpoint::Create(db_, &checkpoint);
+  if (!s.ok()) {
+    return Status::Corruption("create checkpoint failed, " + s.ToString());
+  }
+  s = checkpoint->CreateCheckpoint(path);
+  delete checkpoint;
+  if (!s.ok()) {
+    return Status::Corruption("create checkpoint failed, " + s.ToString());
+  }
+  return Status::OK();
+}
+
+static void SyncParentDir(const std::string& path) {
+  size_t pos = path.find_last_of('/');
+  std::string dir = pos == std::string::npos ? "." : path.substr(0, pos + 1);
+  int fd = open(dir.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    fsync(fd);
+    close(fd);
+  }
+}
+
+/*
+ * the snapshot is a checkpoint of db, it is linked file by file into a new
+ * directory which then replaces the db directory. The previous db is
+ * renamed aside and deleted only after the new one is in place
+ */
+Status KvStateMachine::Restore(const std::string& path) {
+  std::string restore_path = path_ + ".restore";
+  slash::DeleteDirIfExist(restore_path);
+  std::vector<std::string> files;
+  if (slash::CreatePath(restore_path) != 0
+      || slash::GetChildren(path, files) != 0) {
+    return Status::IOError("KvStateMachine::Restore prepare " + restore_path + " failed", strerror(errno));
+  }
+  for (auto& file : files) {
+    if (link((path + "/" + file).c_str(), (restore_path + "/" + file).c_str()) != 0) {
+      Status s = Status::IOError("KvStateMachine::Restore link " + file + " failed", strerror(errno));
+      slash::DeleteDirIfExist(restore_path);
+      return s;
+    }
+  }
+
+  slash::WriteLock l(&rwlock_);
+  delete db_;
+  db_ = NULL;
+  std::string old_path = path_ + ".old";
+  slash::DeleteDirIfExist(old_path);
+  if (slash::RenameFile(path_, old_path) != 0) {
+    Status s = Status::IOError("KvStateMachine::Restore rename " + path_ + " failed", strerror(errno));
+    slash::DeleteDirIfExist(restore_path);
+    OpenDB();
+    return s;
+  }
+  if (slash::RenameFile(restore_path, path_) != 0) {
+    Status s = Status::IOError("KvStateMachine::Restore rename failed", strerror(errno));
+    slash::RenameFile(old_path, path_);
+    slash::DeleteDirIfExist(restore_path);
+    OpenDB();
+    return s;
+  }
+  SyncParentDir(path_);
+  slash::DeleteDirIfExist(old_path);
+  LOGV(INFO_LEVEL, info_log_, "KvStateMachine::Restore: restored %lu files from %s",
+      files.size(), path.c_str());
+  return OpenDB();
+}
+
+Status KvStateMachine::GetAppliedIndex(uint64_t* index) {
+  std::string value;
+  Status s = Get(kAppliedIndexKey, &value);
+  if (!s.ok()) {
+    return s;
+  }
+  if (value.size() != sizeof(uint64_t)) {
+    return Status::Corruption("invalid applied index");
+  }
+  *index = BitStrToUint(value);
+  return Status::OK();
+}
+
+Status KvStateMachine::Get(const std::string& key, std::string* value) {
+  slash::ReadLock l(&rwlock_);
+  if (db_ == NULL) {
+    return Status::Corruption("db is not opened");
+  }
+  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), key, value);
+  if (s.ok()) {
+    return Status::OK();
+  } else if (s.IsNotFound()) {
+    return Status::NotFound("");
+  }
+  return Status::Corruption(s.ToString());
+}
+
+Status KvStateMachine::Put(const std::string& key, const std::string& value) {
+  slash::ReadLock l(&rwlock_);
+  if (db_ == NULL) {
+    return Status::Corruption("db is not opened");
+  }
+  rocksdb::Status s = db_->Put(write_options_, key, value);
+  if (!s.ok()) {
+    return Status::IOError(s.ToString());
+  }
+  return Status::OK();
+}
+
+bool KvStateMachine::IsReservedKey(const std::string& key) {
+  return key == kAppliedIndexKey;
+}
+
+bool KvStateMachine::EncodeLegacyEntry(const Entry& entry, std::string* command) {
+  KvCommand kv_command;
+  switch (entry.optype()) {
+    case Entry_OpType_kWrite: {
+      Entry_Operation* op = kv_command.add_ops();
+      op->set_optype(Entry_OpType_kWrite);
+      op->set_key(entry.key());
+      op->set_value(entry.value());
+      break;
+    }
+    case Entry_OpType_kDelete: {
+      Entry_Operation* op = kv_command.add_ops();
+      op->set_optype(Entry_OpType_kDelete);
+      op->set_key(entry.key());
+      break;
+    }
+    case Entry_OpType_kWriteBatch:
+      kv_command.mutable_ops()->CopyFrom(entry.ops());
+      break;
+    default:
+      return false;
+  }
+  return kv_command.SerializeToString(command);
+}
+
+}  // namespace floyd
@@ -0,0 +1,70 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#ifndef FLOYD_SRC_KV_STATE_MACHINE_H_
+#define FLOYD_SRC_KV_STATE_MACHINE_H_
+
+#include <pthread.h>
+
+#include <string>
+#include <vector>
+
+#include "rocksdb/db.h"
+#include "slash/include/slash_status.h"
+
+#include "floyd/include/floyd_state_machine.h"
+
+namespace floyd {
+
+using slash::Status;
+
+class Logger;
+class Entry;
+
+/*
+ * the built-in state machine, a rocksdb key value store applying KvCommand.
+ * Every batch also writes the applied index under a reserved key, so floyd
+ * continues from the flushed state after restart. With disable_wal the
+ * unflushed batches are lost on crash and the raft log is replayed instead
+ */
+class KvStateMachine : public StateMachine {
+ public:
+  KvStateMachine(const std::string& path, bool disable_wal, Logger* info_log);
+  virtual ~KvStateMachine();
+
+  Status Open();
+
+  virtual Status ApplyBatch(uint64_t last_index,
+                            const std::vector<const std::string*>& commands);
+  virtual Status Snapshot(const std::string& path);
+  virtual Status Restore(const std::string& path);
+  virtual Status GetAppliedIndex(uint64_t* index);
+
+  // access the store directly, used by Read and DirtyWrite
+  Status Get(const std::string& key, std::string* value);
+  Status Put(const std::string& key, const std::string& value);
+
+  // the KvCommand of entries written before kCommand was introduced
+  static bool EncodeLegacyEntry(const Entry& entry, std::string* command);
+  // the key of applied index, which clients can't read or update
+  static bool IsReservedKey(const std::string& key);
+
+ private:
+  std::string path_;
+  rocksdb::WriteOptions write_options_;
+  Logger* info_log_;
+  // db_ is replaced by Restore
+  pthread_rwlock_t rwlock_;
+  rocksdb::DB* db_;
+
+  Status OpenDB();
+
+  // No copying allowed
+  KvStateMachine(const KvStateMachine&);
+  void operator=(const KvStateMachine&);
+};
+
+}  // namespace floyd
+#endif  // FLOYD_SRC_KV_STATE_MACHINE_H_
@@ -0,0 +1,143 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#include "floyd/src/log_storage.h"
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "rocksdb/db.h"
+#include "rocksdb/iterator.h"
+#include "rocksdb/write_batch.h"
+
+#include "floyd/src/logger.h"
+#include "floyd/include/floyd_options.h"
+
+namespace floyd {
+
+extern std::string UintToBitStr(const uint64_t num) {
+  char buf[8];
+  uint64_t num1 = htobe64(num);
+  memcpy(buf, &num1, sizeof(uint64_t));
+  return std::string(buf, 8);
+}
+
+extern uint64_t BitStrToUint(const std::string &str) {
+  uint64_t num;
+  memcpy(&num, str.c_str(), sizeof(uint64_t));
+  return be64toh(num);
+}
+
+RocksdbLogStorage::RocksdbLogStorage(rocksdb::DB *db, rocksdb::ColumnFamilyHandle *cf,
+                                     Logger *info_log)
+  : db_(db),
+    cf_(cf),
+    info_log_(info_log),
+    last_index_(0) {
+  rocksdb::Iterator *it = db_->NewIterator(rocksdb::ReadOptions(), cf_);
+  // skip the meta keys if they share the column family, they are longer
+  // than the log keys and sorted after them
+  for (it->SeekToLast(); it->Valid() && it->key().size() != sizeof(uint64_t); it->Prev()) {
+  }
+  if (it->Valid()) {
+    last_index_ = BitStrToUint(it->key().ToString());
+  }
+  delete it;
+}
+
+uint64_t RocksdbLogStorage::GetLastIndex() {
+  return last_index_;
+}
+
+Status RocksdbLogStorage::Append(uint64_t first_index,
+                                 const std::vector<const std::string *> &bufs,
+                                 bool sync) {
+  rocksdb::WriteBatch wb;
+  for (size_t i = 0; i < bufs.size(); i++) {
+    wb.Put(cf_, UintToBitStr(first_index + i), *bufs[i]);
+  }
+  rocksdb::WriteOptions write_options;
+  write_options.sync = sync;
+  rocksdb::Status s = db_->Write(write_options, &wb);
+  if (!s.ok()) {
+    return Status::IOError("RocksdbLogStorage::Append failed, " + s.ToString());
+  }
+  last_index_ = first_index + bufs.size() - 1;
+  return Status::OK();
+}
+
+Status RocksdbLogStorage::Sync() {
+  rocksdb::Status s = db_->SyncWAL();
+  if (!s.ok()) {
+    return Status::IOError("RocksdbLogStorage::Sync failed, " + s.ToString());
+  }
+  return Status::OK();
+}
+
+Status RocksdbLogStorage::Get(uint64_t index, std::string *buf) {
+  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), cf_, UintToBitStr(index), buf);
+  if (s.IsNotFound()) {
+    return Status::NotFound("entry not found");
+  } else if (!s.ok()) {
+    return Status::IOError("RocksdbLogStorage::Get failed, " + s.ToString());
+  }
+  return Status::OK();
+}
+
+Status RocksdbLogStorage::Scan(uint64_t first_index, uint64_t last_index,
+                               std::vector<std::string> *bufs) {
+  rocksdb::Iterator *it = db_->NewIterator(rocksdb::ReadOptions(), cf_);
+  uint64_t index = first_index;
+  for (it->Seek(UintToBitStr(first_index)); it->Valid() && index <= last_index;
+       it->Next(), index++) {
+    if (it->key().size() != sizeof(uint64_t)
+        || BitStrToUint(it->key().ToString()) != index) {
+      break;
+    }
+    bufs->push_back(it->value().ToString());
+  }
+  rocksdb::Status s = it->status();
+  delete it;
+  if (!s.ok()) {
+    return Status::IOError("RocksdbLogStorage::Scan failed, " + s.ToString());
+  }
+  if (index <= last_index) {
+    return Status::NotFound("entry not found");
+  }
+  return Status::OK();
+}
+
+/*
+ * both truncations remove the entries with a single range deletion, whose
+ * cost doesn't depend on the number of entries. In the default column family
+ * the meta keys begin with capital letters and are sorted after any log key
+ */
+Status RocksdbLogStorage::TruncateSuffix(uint64_t index) {
+  if (index > last_index_) {
+    return Status::OK();
+  }
+  rocksdb::Status s = db_->DeleteRange(rocksdb::WriteOptions(), cf_,
+      UintToBitStr(index), UintToBitStr(last_index_ + 1));
+  if (!s.ok()) {
+    LOGV(ERROR_LEVEL, info_log_, "RocksdbLogStorage::TruncateSuffix Error last_log_index %lu "
+        "truncate from %lu\n", last_index_, index);
+    return Status::IOError("RocksdbLogStorage::TruncateSuffix failed, " + s.ToString());
+  }
+  last_index_ = index - 1;
+  return Status::OK();
+}
+
+Status RocksdbLogStorage::TruncatePrefix(uint64_t index) {
+  rocksdb::Status s = db_->DeleteRange(rocksdb::WriteOptions(), cf_,
+      UintToBitStr(0), UintToBitStr(index));
+  if (!s.ok()) {
+    return Status::IOError("RocksdbLogStorage::TruncatePrefix failed, " + s.ToString());
+  }
+  return Status::OK();
+}
+
+}  // namespace floyd
@@ -0,0 +1,81 @@
+// Copyright (c) 2015-present, Qihoo, Inc.  All rights reserved.
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree. An additional grant
+// of patent rights can be found in the PATENTS file in the same directory.
+
+#ifndef FLOYD_SRC_LOG_STORAGE_H_
+#define FLOYD_SRC_LOG_STORAGE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "rocksdb/db.h"
+#include "slash/include/slash_status.h"
+
+namespace floyd {
+
+using slash::Status;
+
+class Logger;
+
+/*
+ * LogStorage keeps the serialized raft log entries durable for RaftLog,
+ * entries are indexed from 1 and only appended at the tail
+ */
+class LogStorage {
+ public:
+  virtual ~LogStorage() {}
+
+  // index of the last entry, 0 if there is no entry
+  virtual uint64_t GetLastIndex() = 0;
+  // append entries from first_index, which follows the last entry,
+  // sync them to disk before return if sync is true
+  virtual Status Append(uint64_t first_index,
+                        const std::vector<const std::string *> &bufs,
+                        bool sync) = 0;
+  // make all the appended entries durable
+  virtual Status Sync() = 0;
+  virtual Status Get(uint64_t index, std::string *buf) = 0;
+  // read the entries from first_index to last_index in one pass
+  virtual Status Scan(uint64_t first_index, uint64_t last_index,
+                      std::vector<std::string> *bufs) = 0;
+  // remove the entries from index to the last one
+  virtual Status TruncateSuffix(uint64_t index) = 0;
+  // remove the entries before index, storage may keep some of them
+  virtual Status TruncatePrefix(uint64_t index) = 0;
+};
+
+/*
+ * each entry is a rocksdb key of its big endian index in column family cf,
+ * older data directory keeps entries in the default column family together
+ * with RaftMeta
+ */
+class RocksdbLogStorage : public LogStorage {
+ public:
+  RocksdbLogStorage(rocksdb::DB *db, rocksdb::ColumnFamilyHandle *cf, Logger *info_log);
+
+  virtual uint64_t GetLastIndex();
+  virtual Status Append(uint64_t first_index,
+                        const std::vector<const std::string *> &bufs,
+                        bool sync);
+  virtual Status Sync();
+  virtual Status Get(uint64_t index, std::string *buf);
+  virtual Status Scan(uint64_t first_index, uint64_t last_index,
+                      std::vector<std::string> *bufs);
+  virtual Status TruncateSuffix(uint64_t index);
+  virtual Status TruncatePrefix(uint64_t index);
+
+ private:
+  rocksdb::DB* const db_;
+  rocksdb::ColumnFamilyHandle* const cf_;
+  Logger* info_log_;
+  uint64_t last_index_;
+
+  RocksdbLogStorage(const RocksdbLogStorage&);
+  void operator=(const RocksdbLogStorage&);
+};
+
+}  // namespace floyd
+#endif  // FLOYD_SRC_LOG_STORAGE_H_
@@ -10,8 +10,6 @@
 #include <vector>
 #include <string>
 
-#include "rocksdb/db.h"
-#include "rocksdb/iterator.h"
 #include "slash/include/xdebug.h"
 
 #include "floyd/src/floyd.pb.h"
@@ -19,77 +17,255 @@
 #include "floyd/include/floyd_options.h"
 
 namespace floyd {
-extern std::string UintToBitStr(const uint64_t num) {
-  char buf[8];
-  uint64_t num1 = htobe64(num);
-  memcpy(buf, &num1, sizeof(uint64_t));
-  return std::string(buf, 8);
-}
-
-extern uint64_t BitStrToUint(const std::string &str) {
-  uint64_t num;
-  memcpy(&num, str.c_str(), sizeof(uint64_t));
-  return be64toh(num);
-}
 
-RaftLog::RaftLog(rocksdb::DB *db, Logger *info_log) :
-  db_(db),
+RaftLog::RaftLog(LogStorage *storage, Logger *info_log, uint64_t max_cache_size,
+                 LogSyncMode sync_mode) :
+  storage_(storage),
   info_log_(info_log),
-  last_log_index_(0) {
-  rocksdb::Iterator *it = db_->NewIterator(rocksdb::ReadOptions());
-  it->SeekToLast();
-  if (it->Valid()) {
-    it->Prev();
-    it->Prev();
-    it->Prev();
-    it->Prev();
-    it->Prev();
-    if (it->Valid()) {
-      last_log_index_ = BitStrToUint(it->key().ToString());
-    }
+  sync_mode_(sync_mode),
+  last_log_index_(0),
+  written_index_(0),
+  durable_index_(0),
+  snapshot_index_(0),
+  snapshot_term_(0),
+  cache_size_(0),
+  max_cache_size_(max_cache_size),
+  durable_cv_(&lli_mutex_),
+  sync_scheduled_(false),
+  sync_epoch_(0) {
+  last_log_index_ = storage_->GetLastIndex();
+  written_index_ = last_log_index_;
+  durable_index_ = last_log_index_;
+  if (sync_mode_ == kSyncGroup) {
+    sync_thread_.set_thread_name("RaftLogSync");
+    sync_thread_.StartThread();
   }
-  delete it;
 }
 
 RaftLog::~RaftLog() {
+  if (sync_mode_ == kSyncGroup) {
+    sync_thread_.StopThread();
+  }
+  delete storage_;
 }
 
-uint64_t RaftLog::Append(const std::vector<const Entry *> &entries) {
+void RaftLog::set_durable_callback(const std::function<void(uint64_t)>& callback) {
   slash::MutexLock l(&lli_mutex_);
-  rocksdb::WriteBatch wb;
+  durable_callback_ = callback;
+}
+
+/*
+ * Stage, Persist and the rollback of a failed Append are all ordered by
+ * persist_mutex_, nobody stages behind the entries being rolled back
+ */
+uint64_t RaftLog::Append(const std::vector<const Entry *> &entries) {
+  uint64_t last_log_index;
+  {
+  slash::MutexLock pl(&persist_mutex_);
   LOGV(DEBUG_LEVEL, info_log_, "RaftLog::Append: entries.size %lld", entries.size());
+  uint64_t prev_last_log_index = last_log_index_;
+  last_log_index = DoStage(entries);
+  if (!DoPersist(last_log_index)) {
+    slash::MutexLock l(&lli_mutex_);
+    last_log_index_ = prev_last_log_index;
+    EraseCache(last_log_index_ + 1);
+    return 0;
+  }
+  }
+  return last_log_index;
+}
+
+uint64_t RaftLog::AppendSerialized(const std::vector<const std::string *> &bufs) {
+  uint64_t last_log_index;
+  {
+  slash::MutexLock pl(&persist_mutex_);
+  LOGV(DEBUG_LEVEL, info_log_, "RaftLog::AppendSerialized: entries.size %lld", bufs.size());
+  uint64_t prev_last_log_index = last_log_index_;
+  {
+  slash::MutexLock l(&lli_mutex_);
+  for (size_t i = 0; i < bufs.size(); i++) {
+    last_log_index_++;
+    CachedEntry& cached = cache_[last_log_index_];
+    cached.entry.reset();
+    cached.buf = *bufs[i];
+    cache_size_ += cached.buf.size();
+  }
+  last_log_index = last_log_index_;
+  }
+  if (!DoPersist(last_log_index)) {
+    slash::MutexLock l(&lli_mutex_);
+    last_log_index_ = prev_last_log_index;
+    EraseCache(last_log_index_ + 1);
+    return 0;
+  }
+  }
+  return last_log_index;
+}
+
+uint64_t RaftLog::Stage(const std::vector<const Entry *> &entries) {
+  slash::MutexLock pl(&persist_mutex_);
+  return DoStage(entries);
+}
+
+uint64_t RaftLog::DoStage(const std::vector<const Entry *> &entries) {
+  slash::MutexLock l(&lli_mutex_);
   for (size_t i = 0; i < entries.size(); i++) {
-    std::string buf;
-    entries[i]->SerializeToString(&buf);
     last_log_index_++;
-    wb.Put(UintToBitStr(last_log_index_), buf);
-    // s = db_->Put(rocksdb::WriteOptions(), UintToBitStr(last_log_index_), buf);
-    // if (!s.ok()) {
-    //   LOGV(ERROR_LEVEL, info_log_, "RaftLog::Append %lu string %s false\n", last_log_index_, UintToBitStr(last_log_index_).c_str());
-    //   return --last_log_index_;
-    // }
-  }
-  rocksdb::Status s;
-  s = db_->Write(rocksdb::WriteOptions(), &wb);
-  if (!s.ok()) {
-    LOGV(ERROR_LEVEL, info_log_, "RaftLog::Append %lu false\n", last_log_index_);
-    last_log_index_ -= entries.size();
-    return last_log_index_;
+    CachedEntry& cached = cache_[last_log_index_];
+    cached.entry = std::make_shared<Entry>(*entries[i]);
+    entries[i]->SerializeToString(&cached.buf);
+    cache_size_ += cached.buf.size();
   }
   return last_log_index_;
 }
 
+bool RaftLog::Persist(uint64_t index) {
+  slash::MutexLock pl(&persist_mutex_);
+  return DoPersist(index);
+}
+
+bool RaftLog::DoPersist(uint64_t index) {
+  std::vector<const std::string *> bufs;
+  uint64_t first_index = 0;
+  uint64_t last_index = 0;
+  {
+  slash::MutexLock l(&lli_mutex_);
+  first_index = written_index_ + 1;
+  // staged entries are never evicted nor erased while persist_mutex_ is held,
+  // so the pointers stay valid after lli_mutex_ is released
+  for (auto iter = cache_.upper_bound(written_index_);
+       iter != cache_.end() && iter->first <= index; iter++) {
+    bufs.push_back(&iter->second.buf);
+    last_index = iter->first;
+  }
+  }
+  if (last_index == 0) {
+    return true;
+  }
+  // write without lli_mutex_, the staged entries are still readable
+  Status s = storage_->Append(first_index, bufs, sync_mode_ == kSyncPerAppend);
+  if (!s.ok()) {
+    LOGV(ERROR_LEVEL, info_log_, "RaftLog::Persist %lu false, %s\n", last_index, s.ToString().c_str());
+    return false;
+  }
+  slash::MutexLock l(&lli_mutex_);
+  if (written_index_ < last_index) {
+    written_index_ = last_index;
+  }
+  if (sync_mode_ != kSyncGroup) {
+    durable_index_ = written_index_;
+  } else if (!sync_scheduled_) {
+    sync_scheduled_ = true;
+    sync_thread_.Schedule(&SyncWrapper, this);
+  }
+  EvictCache();
+  return true;
+}
+
+bool RaftLog::WaitDurable(uint64_t index) {
+  slash::MutexLock l(&lli_mutex_);
+  while (durable_index_ < index && written_index_ >= index) {
+    durable_cv_.Wait();
+  }
+  return durable_index_ >= index;
+}
+
+void RaftLog::SyncWrapper(void* arg) {
+  reinterpret_cast<RaftLog*>(arg)->DoSync();
+}
+
+/*
+ * one fsync makes all the entries written before it durable, the entries
+ * written during the fsync are left to the next one
+ */
+void RaftLog::DoSync() {
+  uint64_t index;
+  uint64_t epoch;
+  std::function<void(uint64_t)> callback;
+  {
+  slash::MutexLock l(&lli_mutex_);
+  sync_scheduled_ = false;
+  index = written_index_;
+  epoch = sync_epoch_;
+  if (index <= durable_index_) {
+    return;
+  }
+  }
+  Status s = storage_->Sync();
+  {
+  slash::MutexLock l(&lli_mutex_);
+  if (!s.ok()) {
+    LOGV(ERROR_LEVEL, info_log_, "RaftLog::DoSync sync to %lu failed, %s", index, s.ToString().c_str());
+    if (!sync_scheduled_) {
+      sync_scheduled_ = true;
+      sync_thread_.Schedule(&SyncWrapper, this);
+    }
+    return;
+  }
+  // the log has been truncated during fsync, the entries may be rewritten
+  if (epoch != sync_epoch_) {
+    if (!sync_scheduled_) {
+      sync_scheduled_ = true;
+      sync_thread_.Schedule(&SyncWrapper, this);
+    }
+    return;
+  }
+  if (durable_index_ < index) {
+    durable_index_ = index;
+  }
+  durable_cv_.SignalAll();
+  callback = durable_callback_;
+  }
+  if (callback) {
+    callback(index);
+  }
+}
+
+void RaftLog::EvictCache() {
+  while (cache_size_ > max_cache_size_ && !cache_.empty()
+      && cache_.begin()->first <= written_index_) {
+    cache_size_ -= cache_.begin()->second.buf.size();
+    cache_.erase(cache_.begin());
+  }
+}
+
+const Entry& RaftLog::ParseCached(CachedEntry* cached) {
+  if (!cached->entry) {
+    cached->entry = std::make_shared<Entry>();
+    cached->entry->ParseFromString(cached->buf);
+  }
+  return *cached->entry;
+}
+
+void RaftLog::EraseCache(uint64_t from) {
+  auto iter = cache_.lower_bound(from);
+  while (iter != cache_.end()) {
+    cache_size_ -= iter->second.buf.size();
+    iter = cache_.erase(iter);
+  }
+}
+
+uint64_t RaftLog::GetDurableIndex() {
+  slash::MutexLock l(&lli_mutex_);
+  return durable_index_;
+}
+
 uint64_t RaftLog::GetLastLogIndex() {
   return last_log_index_;
 }
 
 int RaftLog::GetEntry(const uint64_t index, Entry *entry) {
   slash::MutexLock l(&lli_mutex_);
-  std::string buf = UintToBitStr(index);
+  auto iter = cache_.find(index);
+  if (iter != cache_.end()) {
+    *entry = ParseCached(&iter->second);
+    return 0;
+  }
   std::string res;
-  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), buf, &res);
-  if (s.IsNotFound()) {
-    LOGV(ERROR_LEVEL, info_log_, "RaftLog::GetEntry: GetEntry not found %lld \n", index);
+  Status s = storage_->Get(index, &res);
+  if (!s.ok()) {
+    LOGV(ERROR_LEVEL, info_log_, "RaftLog::GetEntry: GetEntry %lld failed, %s\n",
+        index, s.ToString().c_str());
     entry = NULL;
     return 1;
   }
@@ -97,6 +273,76 @@ int RaftLog::GetEntry(const uint64_t index, Entry *entry) {
   return 0;
 }
 
+int RaftLog::GetEntries(uint64_t first_index, uint64_t last_index,
+                        std::vector<Entry> *entries) {
+  if (first_index > last_index) {
+    return 0;
+  }
+  slash::MutexLock l(&lli_mutex_);
+  // the cache holds the tail of log
+  uint64_t cache_begin = cache_.empty() ? last_log_index_ + 1 : cache_.begin()->first;
+  if (first_index < cache_begin) {
+    std::vector<std::string> bufs;
+    uint64_t scan_last = std::min(last_index, cache_begin - 1);
+    Status s = storage_->Scan(first_index, scan_last, &bufs);
+    if (!s.ok()) {
+      LOGV(ERROR_LEVEL, info_log_, "RaftLog::GetEntries: scan %lu to %lu failed, %s\n",
+          first_index, scan_last, s.ToString().c_str());
+      return 1;
+    }
+    for (auto& buf : bufs) {
+      entries->push_back(Entry());
+      entries->back().ParseFromString(buf);
+    }
+    first_index = scan_last + 1;
+  }
+  for (uint64_t index = first_index; index <= last_index; index++) {
+    auto iter = cache_.find(index);
+    if (iter == cache_.end()) {
+      LOGV(ERROR_LEVEL, info_log_, "RaftLog::GetEntries: entry %lu not found\n", index);
+      return 1;
+    }
+    entries->push_back(ParseCached(&iter->second));
+  }
+  return 0;
+}
+
+int RaftLog::GetSerializedEntry(const uint64_t index, std::string *buf) {
+  slash::MutexLock l(&lli_mutex_);
+  auto iter = cache_.find(index);
+  if (iter != cache_.end()) {
+    *buf = iter->second.buf;
+    return 0;
+  }
+  Status s = storage_->Get(index, buf);
+  if (!s.ok()) {
+    LOGV(ERROR_LEVEL, info_log_, "RaftLog::GetSerializedEntry: GetEntry %lld failed, %s\n",
+        index, s.ToString().c_str());
+    return 1;
+  }
+  return 0;
+}
+
+int RaftLog::GetTerm(uint64_t index, uint64_t *term) {
+  if (index == 0) {
+    *term = 0;
+    return 0;
+  }
+  {
+  slash::MutexLock l(&lli_mutex_);
+  if (index == snapshot_index_) {
+    *term = snapshot_term_;
+    return 0;
+  }
+  }
+  Entry entry;
+  if (GetEntry(index, &entry) != 0) {
+    return 1;
+  }
+  *term = entry.term();
+  return 0;
+}
+
 bool RaftLog::GetLastLogTermAndIndex(uint64_t* last_log_term, uint64_t* last_log_index) {
   slash::MutexLock l(&lli_mutex_);
   if (last_log_index_ == 0) {
@@ -104,9 +350,20 @@ bool RaftLog::GetLastLogTermAndIndex(uint64_t* last_log_term, uint64_t* last_log
     *last_log_term = 0;
     return true;
   }
+  if (last_log_index_ == snapshot_index_) {
+    *last_log_index = last_log_index_;
+    *last_log_term = snapshot_term_;
+    return true;
+  }
+  auto iter = cache_.find(last_log_index_);
+  if (iter != cache_.end()) {
+    *last_log_index = last_log_index_;
+    *last_log_term = ParseCached(&iter->second).term();
+    return true;
+  }
   std::string buf;
-  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), UintToBitStr(last_log_index_), &buf);
-  if (!s.ok() || s.IsNotFound()) {
+  Status s = storage_->Get(last_log_index_, &buf);
+  if (!s.ok()) {
     *last_log_index = 0;
     *last_log_term = 0;
     return true;
@@ -122,16 +379,80 @@ bool RaftLog::GetLastLogTermAndIndex(uint64_t* last_log_term, uint64_t* last_log
  * truncate suffix from index
  */
 int RaftLog::TruncateSuffix(uint64_t index) {
-  // we need to delete the unnecessary entry, since we don't store
-  // last_log_index in rocksdb
-  for (; last_log_index_ >= index; last_log_index_--) {
-    rocksdb::Status s = db_->Delete(rocksdb::WriteOptions(), UintToBitStr(last_log_index_));
-    if (!s.ok()) {
-      LOGV(ERROR_LEVEL, info_log_, "RaftLog::TruncateSuffix Error last_log_index %lu "
-          "truncate from %lu\n", last_log_index_, index);
-      return -1;
-    }
+  slash::MutexLock pl(&persist_mutex_);
+  {
+  slash::MutexLock l(&lli_mutex_);
+  EraseCache(index);
+  if (written_index_ >= index) {
+    written_index_ = index - 1;
+  }
+  if (durable_index_ >= index) {
+    durable_index_ = index - 1;
+  }
+  sync_epoch_++;
+  // the waiters of truncated entries give up
+  durable_cv_.SignalAll();
+  if (last_log_index_ >= index) {
+    last_log_index_ = index - 1;
+  }
+  }
+  Status s = storage_->TruncateSuffix(index);
+  if (!s.ok()) {
+    LOGV(ERROR_LEVEL, info_log_, "RaftLog::TruncateSuffix Error last_log_index %lu "
+        "truncate from %lu, %s\n", last_log_index_, index, s.ToString().c_str());
+    return -1;
+  }
+  return 0;
+}
+
+int RaftLog::TruncatePrefix(uint64_t index) {
+  slash::MutexLock pl(&persist_mutex_);
+  {
+  slash::MutexLock l(&lli_mutex_);
+  // the entries not yet persisted stay in cache until Persist
+  while (!cache_.empty() && cache_.begin()->first < index
+      && cache_.begin()->first <= written_index_) {
+    cache_size_ -= cache_.begin()->second.buf.size();
+    cache_.erase(cache_.begin());
+  }
+  }
+  Status s = storage_->TruncatePrefix(index);
+  if (!s.ok()) {
+    LOGV(ERROR_LEVEL, info_log_, "RaftLog::TruncatePrefix Error truncate before %lu, %s\n",
+        index, s.ToString().c_str());
+    return -1;
+  }
+  return 0;
+}
+
+void RaftLog::SetSnapshot(uint64_t snapshot_index, uint64_t snapshot_term) {
+  slash::MutexLock l(&lli_mutex_);
+  snapshot_index_ = snapshot_index;
+  snapshot_term_ = snapshot_term;
+  if (last_log_index_ < snapshot_index) {
+    last_log_index_ = snapshot_index;
+  }
+  if (written_index_ < snapshot_index) {
+    written_index_ = snapshot_index;
+  }
+  if (durable_index_ < snapshot_index) {
+    durable_index_ = snapshot_index;
+  }
+}
+
+int RaftLog::InstallSnapshot(uint64_t snapshot_index, uint64_t snapshot_term) {
+  uint64_t term;
+  if (snapshot_index <= last_log_index_ && GetTerm(snapshot_index, &term) == 0
+      && term == snapshot_term) {
+    SetSnapshot(snapshot_index, snapshot_term);
+    return TruncatePrefix(snapshot_index);
+  }
+  LOGV(INFO_LEVEL, info_log_, "RaftLog::InstallSnapshot discard the whole log, last_log_index %lu, "
+      "snapshot index %lu term %lu", last_log_index_, snapshot_index, snapshot_term);
+  if (TruncateSuffix(1) != 0) {
+    return -1;
   }
+  SetSnapshot(snapshot_index, snapshot_term);
   return 0;
 }
 
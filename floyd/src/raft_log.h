@@ -9,11 +9,18 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "rocksdb/db.h"
 #include "slash/include/slash_mutex.h"
+#include "pink/include/bg_thread.h"
+
+#include "floyd/include/floyd_options.h"
+#include "floyd/src/log_storage.h"
 
 namespace floyd {
 
@@ -22,31 +29,106 @@ class Entry;
 
 class RaftLog {
  public:
-  RaftLog(rocksdb::DB* db, Logger* info_log);
+  // take the ownership of storage, recently appended entries are cached
+  // up to max_cache_size bytes
+  RaftLog(LogStorage* storage, Logger* info_log, uint64_t max_cache_size,
+          LogSyncMode sync_mode = kSyncNone);
   ~RaftLog();
 
+  // return the new last_log_index after the entries are written,
+  // or 0 if the write failed
   uint64_t Append(const std::vector<const Entry *> &entries);
+  // append serialized entries verbatim, they are parsed only when read
+  uint64_t AppendSerialized(const std::vector<const std::string *> &bufs);
+  // in kSyncGroup mode the written entries become durable later, wait
+  // until index is durable, return false if it is truncated before that
+  bool WaitDurable(uint64_t index);
+
+  /*
+   * leader stages entries in memory and replicates them while they are
+   * being written to storage by Persist.
+   * Stage returns the new last_log_index
+   */
+  uint64_t Stage(const std::vector<const Entry *> &entries);
+  // write the staged entries up to index, return false if the write failed.
+  // in kSyncGroup mode they become durable later in sync thread
+  bool Persist(uint64_t index);
+  // the last index durable in storage, leader counts itself in the quorum by it
+  uint64_t GetDurableIndex();
+  // invoked in sync thread after durable index advanced, kSyncGroup only
+  void set_durable_callback(const std::function<void(uint64_t)>& callback);
 
   int GetEntry(uint64_t index, Entry *entry);
+  // get the entries from first_index to last_index, the ones not in cache
+  // are read from storage in one scan
+  int GetEntries(uint64_t first_index, uint64_t last_index, std::vector<Entry> *entries);
+  // term of the entry at index, which may be the last one in snapshot
+  int GetTerm(uint64_t index, uint64_t *term);
+  // get the serialized entry as stored in log
+  int GetSerializedEntry(uint64_t index, std::string *buf);
 
   uint64_t GetLastLogIndex();
   bool GetLastLogTermAndIndex(uint64_t* last_log_term, uint64_t* last_log_index);
   int TruncateSuffix(uint64_t index);
+  // discard the entries before index, which have been applied,
+  // storage may keep some of them
+  int TruncatePrefix(uint64_t index);
+
+  // the log begins after the snapshot at least, called when recovering
+  void SetSnapshot(uint64_t snapshot_index, uint64_t snapshot_term);
+  // keep the entries following the snapshot if the log contains the last
+  // entry of snapshot, otherwise discard the whole log
+  int InstallSnapshot(uint64_t snapshot_index, uint64_t snapshot_term);
 
  private:
-  rocksdb::DB* const db_;
+  LogStorage* const storage_;
   Logger* info_log_;
+  const LogSyncMode sync_mode_;
   /*
    * mutex for last_log_index_
    */
   slash::Mutex lli_mutex_;
   uint64_t last_log_index_;
+  // entries up to written_index_ are written to storage, and those up to
+  // durable_index_ are synced as sync_mode_ requires
+  uint64_t written_index_;
+  uint64_t durable_index_;
+  uint64_t snapshot_index_;
+  uint64_t snapshot_term_;
 
   /*
-   * we don't store last_log_index_ in rocksdb, since if we store it in rocksdb
-   * we need update it every time I append an entry.
-   * so we need update it when we open db
+   * recently appended entries in both parsed and serialized form, so that
+   * replication and apply don't read them back from storage. Entries after
+   * written_index_ are staged and never evicted. protected by lli_mutex_
    */
+  struct CachedEntry {
+    std::shared_ptr<Entry> entry;  // parsed from buf lazily
+    std::string buf;
+  };
+  std::map<uint64_t, CachedEntry> cache_;
+  uint64_t cache_size_;
+  uint64_t max_cache_size_;
+  // called with lli_mutex_ held
+  void EvictCache();
+  void EraseCache(uint64_t from);
+  const Entry& ParseCached(CachedEntry* cached);
+  // serialize Stage, Persist, Append and TruncateSuffix
+  slash::Mutex persist_mutex_;
+
+  // called with persist_mutex_ held
+  uint64_t DoStage(const std::vector<const Entry *> &entries);
+  bool DoPersist(uint64_t index);
+
+  // kSyncGroup mode, protected by lli_mutex_
+  slash::CondVar durable_cv_;
+  bool sync_scheduled_;
+  // bumped by TruncateSuffix, a sync started before it doesn't count
+  uint64_t sync_epoch_;
+  pink::BGThread sync_thread_;
+  std::function<void(uint64_t)> durable_callback_;
+  static void SyncWrapper(void* arg);
+  void DoSync();
+
   RaftLog(const RaftLog&);
   void operator=(const RaftLog&);
 };  // RaftLog
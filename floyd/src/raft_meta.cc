@@ -16,120 +16,187 @@
 
 namespace floyd {
 
+static const std::string kHardState = "HARDSTATE";
+// keys written by older version, replaced by kHardState
 static const std::string kCurrentTerm = "CURRENTTERM";
 static const std::string kVoteForIp = "VOTEFORIP";
 static const std::string kVoteForPort = "VOTEFORPORT";
 static const std::string kCommitIndex = "COMMITINDEX";
+
 static const std::string kLastApplied = "APPLYINDEX";
+static const std::string kSnapshotIndex = "SNAPSHOTINDEX";
+static const std::string kSnapshotTerm = "SNAPSHOTTERM";
 
 RaftMeta::RaftMeta(rocksdb::DB* db, Logger* info_log)
+  : RaftMeta(db, db->DefaultColumnFamily(), info_log) {
+}
+
+RaftMeta::RaftMeta(rocksdb::DB* db, rocksdb::ColumnFamilyHandle* cf, Logger* info_log)
   : db_(db),
-    info_log_(info_log) {
+    cf_(cf),
+    info_log_(info_log),
+    current_term_(0),
+    voted_for_port_(0),
+    commit_index_(0),
+    last_applied_(0),
+    snapshot_index_(0),
+    snapshot_term_(0) {
 }
 
 RaftMeta::~RaftMeta() {
 }
 
 void RaftMeta::Init() {
-  if (GetCurrentTerm() == 0) {
-    SetCurrentTerm(0);
-  }
-  if (GetVotedForIp() == "") {
-    SetVotedForIp("");
-  }
-  if (GetVotedForPort() == 0) {
-    SetVotedForPort(0);
-  }
-  if (GetCommitIndex() == 0) {
-    SetCommitIndex(0);
+  slash::MutexLock l(&mu_);
+  std::string buf;
+  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), cf_, kHardState, &buf);
+  if (s.ok()) {
+    HardState hard_state;
+    hard_state.ParseFromString(buf);
+    current_term_ = hard_state.current_term();
+    voted_for_ip_ = hard_state.voted_for_ip();
+    voted_for_port_ = hard_state.voted_for_port();
+    commit_index_ = hard_state.commit_index();
+  } else {
+    current_term_ = GetUint(kCurrentTerm);
+    if (db_->Get(rocksdb::ReadOptions(), cf_, kVoteForIp, &buf).ok()) {
+      voted_for_ip_ = buf;
+    }
+    if (db_->Get(rocksdb::ReadOptions(), cf_, kVoteForPort, &buf).ok()) {
+      memcpy(&voted_for_port_, buf.data(), sizeof(int));
+    }
+    commit_index_ = GetUint(kCommitIndex);
+    WriteHardState(true);
+    db_->Delete(rocksdb::WriteOptions(), cf_, kCurrentTerm);
+    db_->Delete(rocksdb::WriteOptions(), cf_, kVoteForIp);
+    db_->Delete(rocksdb::WriteOptions(), cf_, kVoteForPort);
+    db_->Delete(rocksdb::WriteOptions(), cf_, kCommitIndex);
   }
-  if (GetLastApplied() == 0) {
-    SetLastApplied(0);
+  last_applied_ = GetUint(kLastApplied);
+  snapshot_index_ = GetUint(kSnapshotIndex);
+  snapshot_term_ = GetUint(kSnapshotTerm);
+  LOGV(INFO_LEVEL, info_log_, "RaftMeta::Init current_term %lu voted_for %s:%d commit_index %lu "
+      "last_applied %lu snapshot_index %lu", current_term_, voted_for_ip_.c_str(), voted_for_port_,
+      commit_index_, last_applied_, snapshot_index_);
+}
+
+void RaftMeta::WriteHardState(bool sync) {
+  HardState hard_state;
+  hard_state.set_current_term(current_term_);
+  hard_state.set_voted_for_ip(voted_for_ip_);
+  hard_state.set_voted_for_port(voted_for_port_);
+  hard_state.set_commit_index(commit_index_);
+  std::string buf;
+  hard_state.SerializeToString(&buf);
+  rocksdb::WriteOptions write_options;
+  write_options.sync = sync;
+  rocksdb::Status s = db_->Put(write_options, cf_, kHardState, buf);
+  if (!s.ok()) {
+    LOGV(ERROR_LEVEL, info_log_, "RaftMeta::WriteHardState failed, %s", s.ToString().c_str());
   }
 }
 
-uint64_t RaftMeta::GetCurrentTerm() {
+uint64_t RaftMeta::GetUint(const std::string& key) {
   std::string buf;
   uint64_t ans;
-  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), kCurrentTerm, &buf);
-  if (s.IsNotFound()) {
+  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), cf_, key, &buf);
+  if (!s.ok()) {
     return 0;
   }
   memcpy(&ans, buf.data(), sizeof(uint64_t));
   return ans;
 }
 
-void RaftMeta::SetCurrentTerm(const uint64_t current_term) {
+void RaftMeta::PutUint(const std::string& key, uint64_t value) {
   char buf[8];
-  memcpy(buf, &current_term, sizeof(uint64_t));
-  db_->Put(rocksdb::WriteOptions(), kCurrentTerm, std::string(buf, 8));
-  return;
+  memcpy(buf, &value, sizeof(uint64_t));
+  db_->Put(rocksdb::WriteOptions(), cf_, key, std::string(buf, 8));
+}
+
+uint64_t RaftMeta::GetCurrentTerm() {
+  slash::MutexLock l(&mu_);
+  return current_term_;
+}
+
+void RaftMeta::SetCurrentTerm(const uint64_t current_term) {
+  slash::MutexLock l(&mu_);
+  current_term_ = current_term;
+  WriteHardState(true);
 }
 
 std::string RaftMeta::GetVotedForIp() {
-  std::string buf;
-  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), kVoteForIp, &buf);
-  if (s.IsNotFound()) {
-    return std::string("");
-  }
-  return buf;
+  slash::MutexLock l(&mu_);
+  return voted_for_ip_;
 }
 
 void RaftMeta::SetVotedForIp(const std::string ip) {
-  db_->Put(rocksdb::WriteOptions(), kVoteForIp, ip);
-  return;
+  slash::MutexLock l(&mu_);
+  voted_for_ip_ = ip;
+  WriteHardState(true);
 }
 
 int RaftMeta::GetVotedForPort() {
-  std::string buf;
-  int ans;
-  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), kVoteForPort, &buf);
-  if (s.IsNotFound()) {
-    return 0;
-  }
-  memcpy(&ans, buf.data(), sizeof(int));
-  return ans;
+  slash::MutexLock l(&mu_);
+  return voted_for_port_;
 }
 
 void RaftMeta::SetVotedForPort(const int port) {
-  char buf[4];
-  memcpy(buf, &port, sizeof(int));
-  db_->Put(rocksdb::WriteOptions(), kVoteForPort, std::string(buf, sizeof(int)));
-  return;
+  slash::MutexLock l(&mu_);
+  voted_for_port_ = port;
+  WriteHardState(true);
+}
+
+void RaftMeta::SetTermAndVote(const uint64_t current_term, const std::string& ip, const int port) {
+  slash::MutexLock l(&mu_);
+  current_term_ = current_term;
+  voted_for_ip_ = ip;
+  voted_for_port_ = port;
+  WriteHardState(true);
 }
 
 uint64_t RaftMeta::GetCommitIndex() {
-  std::string buf;
-  uint64_t ans;
-  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), kCommitIndex, &buf);
-  if (s.IsNotFound()) {
-    return 0;
-  }
-  memcpy(&ans, buf.data(), sizeof(uint64_t));
-  return ans;
+  slash::MutexLock l(&mu_);
+  return commit_index_;
 }
 
+// commit index can be recovered from the leader, no need to sync
 void RaftMeta::SetCommitIndex(uint64_t commit_index) {
-  char buf[8];
-  memcpy(buf, &commit_index, sizeof(uint64_t));
-  db_->Put(rocksdb::WriteOptions(), kCommitIndex, std::string(buf, 8));
+  slash::MutexLock l(&mu_);
+  commit_index_ = commit_index;
+  WriteHardState(false);
 }
 
 uint64_t RaftMeta::GetLastApplied() {
-  std::string buf;
-  uint64_t ans;
-  rocksdb::Status s = db_->Get(rocksdb::ReadOptions(), kLastApplied, &buf);
-  if (s.IsNotFound()) {
-    return 0;
-  }
-  memcpy(&ans, buf.data(), sizeof(uint64_t));
-  return ans;
+  slash::MutexLock l(&mu_);
+  return last_applied_;
 }
 
 void RaftMeta::SetLastApplied(uint64_t last_applied) {
-  char buf[8];
-  memcpy(buf, &last_applied, sizeof(uint64_t));
-  db_->Put(rocksdb::WriteOptions(), kLastApplied, std::string(buf, 8));
+  slash::MutexLock l(&mu_);
+  last_applied_ = last_applied;
+  PutUint(kLastApplied, last_applied);
+}
+
+uint64_t RaftMeta::GetSnapshotIndex() {
+  slash::MutexLock l(&mu_);
+  return snapshot_index_;
+}
+
+void RaftMeta::SetSnapshotIndex(uint64_t snapshot_index) {
+  slash::MutexLock l(&mu_);
+  snapshot_index_ = snapshot_index;
+  PutUint(kSnapshotIndex, snapshot_index);
+}
+
+uint64_t RaftMeta::GetSnapshotTerm() {
+  slash::MutexLock l(&mu_);
+  return snapshot_term_;
+}
+
+void RaftMeta::SetSnapshotTerm(uint64_t snapshot_term) {
+  slash::MutexLock l(&mu_);
+  snapshot_term_ = snapshot_term;
+  PutUint(kSnapshotTerm, snapshot_term);
 }
 
 }  // namespace floyd
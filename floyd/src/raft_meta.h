@@ -23,12 +23,19 @@ class Logger;
 
 /*
  * we use RaftMeta to avoid passing the floyd_impl's this point to other thread
+ *
+ * term, vote and commit index are stored as one HardState record, all the
+ * meta data are cached in memory, so reads never hit rocksdb
  */
 class RaftMeta {
  public:
+  // meta is stored in the default column family of db
   RaftMeta(rocksdb::DB *db, Logger* info_log);
+  RaftMeta(rocksdb::DB *db, rocksdb::ColumnFamilyHandle* cf, Logger* info_log);
   ~RaftMeta();
 
+  // load meta data from db, the separate keys written by older version
+  // are converted to HardState
   void Init();
 
   // return persistent state from zeppelin
@@ -40,18 +47,43 @@ class RaftMeta {
   void SetVotedForIp(const std::string ip);
   void SetVotedForPort(const int port);
 
+  // term and vote must be durable before replying to any RPC,
+  // they are written together with one synced write
+  void SetTermAndVote(const uint64_t current_term, const std::string& ip, const int port);
+
   uint64_t GetCommitIndex();
   void SetCommitIndex(const uint64_t commit_index);
 
   uint64_t GetLastApplied();
   void SetLastApplied(uint64_t last_applied);
 
+  // index and term of the last entry included in the latest snapshot
+  uint64_t GetSnapshotIndex();
+  void SetSnapshotIndex(uint64_t snapshot_index);
+  uint64_t GetSnapshotTerm();
+  void SetSnapshotTerm(uint64_t snapshot_term);
+
  private:
   // db used to data that need to be persistent
   rocksdb::DB * const db_;
+  rocksdb::ColumnFamilyHandle* const cf_;
   // used to debug
   Logger* info_log_;
 
+  // protect the cached meta data below
+  slash::Mutex mu_;
+  uint64_t current_term_;
+  std::string voted_for_ip_;
+  int voted_for_port_;
+  uint64_t commit_index_;
+  uint64_t last_applied_;
+  uint64_t snapshot_index_;
+  uint64_t snapshot_term_;
+
+  // called with mu_ held
+  void WriteHardState(bool sync);
+  uint64_t GetUint(const std::string& key);
+  void PutUint(const std::string& key, uint64_t value);
 };
 
 } // namespace floyd
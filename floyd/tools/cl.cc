@@ -31,7 +31,8 @@ int cl(const std::string path) {
   rocksdb::Status s = rocksdb::DB::Open(options, path + "/log/", &db);
   RaftMeta *raft_meta = new RaftMeta(db, logger);
   raft_meta->Init();
-  RaftLog *raft_log = new RaftLog(db, logger);
+  RaftLog *raft_log = new RaftLog(new RocksdbLogStorage(db, db->DefaultColumnFamily(), logger),
+                                  logger, 0);
   std::vector<const Entry *> entries;
   char buff[10];
   for (int i = 0; i < 10; i++) {
@@ -64,7 +65,8 @@ int cl_spec(const std::string path) {
   rocksdb::Status s = rocksdb::DB::Open(options, path + "/log/", &db);
   RaftMeta *raft_meta = new RaftMeta(db, logger);
   raft_meta->Init();
-  RaftLog *raft_log = new RaftLog(db, logger);
+  RaftLog *raft_log = new RaftLog(new RocksdbLogStorage(db, db->DefaultColumnFamily(), logger),
+                                  logger, 0);
   std::vector<const Entry *> entries;
   char buff[10];
   for (int i = 0; i < 21; i++) {
@@ -41,7 +41,8 @@ int cl1(const std::string path) {
   rocksdb::Status s = rocksdb::DB::Open(options, path + "/log/", &db);
   RaftMeta *raft_meta = new RaftMeta(db, logger);
   raft_meta->Init();
-  RaftLog *raft_log = new RaftLog(db, logger);
+  RaftLog *raft_log = new RaftLog(new RocksdbLogStorage(db, db->DefaultColumnFamily(), logger),
+                                  logger, 0);
 
   std::vector<const Entry *> entries;
   Entry *entry = new Entry();
@@ -108,7 +109,8 @@ int cl2(const std::string path) {
   rocksdb::Status s = rocksdb::DB::Open(options, path + "/log/", &db);
   RaftMeta *raft_meta = new RaftMeta(db, logger);
   raft_meta->Init();
-  RaftLog *raft_log = new RaftLog(db, logger);
+  RaftLog *raft_log = new RaftLog(new RocksdbLogStorage(db, db->DefaultColumnFamily(), logger),
+                                  logger, 0);
 
   std::vector<const Entry *> entries;
   Entry *entry = new Entry();
@@ -171,7 +173,8 @@ int cl3(const std::string path) {
   rocksdb::Status s = rocksdb::DB::Open(options, path + "/log/", &db);
   RaftMeta *raft_meta = new RaftMeta(db, logger);
   raft_meta->Init();
-  RaftLog *raft_log = new RaftLog(db, logger);
+  RaftLog *raft_log = new RaftLog(new RocksdbLogStorage(db, db->DefaultColumnFamily(), logger),
+                                  logger, 0);
 
   std::vector<const Entry *> entries;
   Entry *entry = new Entry();
@@ -243,7 +246,8 @@ int cl4(const std::string path) {
   rocksdb::Status s = rocksdb::DB::Open(options, path + "/log/", &db);
   RaftMeta *raft_meta = new RaftMeta(db, logger);
   raft_meta->Init();
-  RaftLog *raft_log = new RaftLog(db, logger);
+  RaftLog *raft_log = new RaftLog(new RocksdbLogStorage(db, db->DefaultColumnFamily(), logger),
+                                  logger, 0);
 
   std::vector<const Entry *> entries;
   Entry *entry = new Entry();
@@ -298,7 +302,8 @@ int cl5(const std::string path) {
   rocksdb::Status s = rocksdb::DB::Open(options, path + "/log/", &db);
   RaftMeta *raft_meta = new RaftMeta(db, logger);
   raft_meta->Init();
-  RaftLog *raft_log = new RaftLog(db, logger);
+  RaftLog *raft_log = new RaftLog(new RocksdbLogStorage(db, db->DefaultColumnFamily(), logger),
+                                  logger, 0);
 
   std::vector<const Entry *> entries;
   Entry *entry = new Entry();
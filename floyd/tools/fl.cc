@@ -0,0 +1,153 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <endian.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "slash/include/env.h"
+
+#include "floyd/src/file_log.h"
+#include "floyd/src/logger.h"
+
+using namespace floyd;
+
+// small segments, so the entries span many of them
+static const uint64_t kSegmentSize = 4096;
+static int failed = 0;
+
+std::string Value(uint64_t index, int version) {
+  return "value" + std::to_string(version) + "_" + std::to_string(index)
+    + std::string(index % 100, 'x');
+}
+
+void Check(bool ok, const std::string& msg) {
+  printf("%s %s\n", ok ? "ok    " : "FAILED", msg.c_str());
+  if (!ok) {
+    failed++;
+  }
+}
+
+FileLog* Reopen(FileLog* log, const std::string& path, Logger* logger) {
+  delete log;
+  log = new FileLog(path, kSegmentSize, logger);
+  Status s = log->Open();
+  Check(s.ok(), "open " + path + ", " + s.ToString());
+  return log;
+}
+
+void Append(FileLog* log, uint64_t first_index, uint64_t last_index, int version) {
+  std::vector<std::string> values;
+  for (uint64_t i = first_index; i <= last_index; i++) {
+    values.push_back(Value(i, version));
+  }
+  std::vector<const std::string*> bufs;
+  for (auto& value : values) {
+    bufs.push_back(&value);
+  }
+  Status s = log->Append(first_index, bufs, true);
+  Check(s.ok(), "append " + std::to_string(first_index) + " to "
+        + std::to_string(last_index) + ", " + s.ToString());
+}
+
+void VerifyLast(FileLog* log, uint64_t last_index) {
+  Check(log->GetLastIndex() == last_index, "last index " + std::to_string(log->GetLastIndex())
+        + " expect " + std::to_string(last_index));
+}
+
+void Verify(FileLog* log, uint64_t first_index, uint64_t last_index, int version) {
+  uint64_t bad = 0;
+  std::string buf;
+  for (uint64_t i = first_index; i <= last_index; i++) {
+    if (!log->Get(i, &buf).ok() || buf != Value(i, version)) {
+      bad++;
+    }
+  }
+  Check(bad == 0, "read " + std::to_string(first_index) + " to "
+        + std::to_string(last_index) + ", " + std::to_string(bad) + " bad entries");
+}
+
+// flip a byte in the last entry of the last segment, as a torn write
+void CorruptLastEntry(const std::string& path) {
+  std::vector<std::string> children;
+  slash::GetChildren(path, children);
+  std::string last;
+  for (auto& name : children) {
+    if (name.size() > 6 && name.compare(name.size() - 6, 6, ".index") == 0 && name > last) {
+      last = name;
+    }
+  }
+  std::string prefix = path + "/" + last.substr(0, last.size() - 6);
+  int index_fd = open((prefix + ".index").c_str(), O_RDONLY);
+  off_t size = lseek(index_fd, 0, SEEK_END);
+  uint64_t offset;
+  pread(index_fd, &offset, sizeof(offset), size - sizeof(offset));
+  close(index_fd);
+  // skip length and crc
+  offset = be64toh(offset) + 8;
+
+  int data_fd = open((prefix + ".data").c_str(), O_RDWR);
+  char c;
+  pread(data_fd, &c, 1, offset);
+  c = ~c;
+  pwrite(data_fd, &c, 1, offset);
+  close(data_fd);
+}
+
+/*
+ * check that the entries of FileLog survive reopening after append,
+ * TruncateSuffix, TruncatePrefix and a corrupted tail
+ */
+int main()
+{
+  std::string path = "./data_fl/";
+  slash::DeleteDirIfExist(path);
+  slash::CreatePath(path);
+  Logger *logger;
+  if (NewLogger(path + "/LOG", &logger) != 0) {
+    return -1;
+  }
+  path += "log";
+  FileLog* log = Reopen(NULL, path, logger);
+
+  Append(log, 1, 1000, 0);
+  log = Reopen(log, path, logger);
+  VerifyLast(log, 1000);
+  Verify(log, 1, 1000, 0);
+
+  // the conflicting entries are replaced by the new ones
+  Check(log->TruncateSuffix(601).ok(), "truncate suffix from 601");
+  log = Reopen(log, path, logger);
+  VerifyLast(log, 600);
+  Verify(log, 1, 600, 0);
+  Append(log, 601, 1200, 1);
+  log = Reopen(log, path, logger);
+  VerifyLast(log, 1200);
+  Verify(log, 1, 600, 0);
+  Verify(log, 601, 1200, 1);
+
+  // the entries from 500 are kept
+  Check(log->TruncatePrefix(500).ok(), "truncate prefix to 500");
+  log = Reopen(log, path, logger);
+  VerifyLast(log, 1200);
+  Verify(log, 500, 600, 0);
+  Verify(log, 601, 1200, 1);
+
+  // only the last entry is dropped, and the log continues after it
+  delete log;
+  CorruptLastEntry(path);
+  log = Reopen(NULL, path, logger);
+  VerifyLast(log, 1199);
+  Verify(log, 601, 1199, 1);
+  Append(log, 1200, 1300, 2);
+  log = Reopen(log, path, logger);
+  VerifyLast(log, 1300);
+  Verify(log, 601, 1199, 1);
+  Verify(log, 1200, 1300, 2);
+
+  delete log;
+  delete logger;
+  printf("%s\n", failed == 0 ? "PASSED" : "FAILED");
+  return failed == 0 ? 0 : -1;
+}
@@ -1,502 +1,857 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: floyd.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "floyd.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace floyd {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Entry_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Entry_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Entry_OpType_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_Kv_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_Kv_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_User_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_User_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_RequestVote_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_RequestVote_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_AppendEntries_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_AppendEntries_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdRequest_ServerStatus_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdRequest_ServerStatus_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_Kv_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_Kv_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_Kvs_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_Kvs_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_RequestVoteResponse_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_RequestVoteResponse_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_AppendEntriesResponse_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_AppendEntriesResponse_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CmdResponse_ServerStatus_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CmdResponse_ServerStatus_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Type_descriptor_ = NULL;
-const ::google::protobuf::EnumDescriptor* StatusCode_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_floyd_2eproto() {
-  protobuf_AddDesc_floyd_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "floyd.proto");
-  GOOGLE_CHECK(file != NULL);
-  Entry_descriptor_ = file->message_type(0);
-  static const int Entry_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Entry, term_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Entry, key_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Entry, value_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Entry, optype_),
+namespace floyd {
+PROTOBUF_CONSTEXPR Entry_Operation::Entry_Operation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.optype_)*/0} {}
+struct Entry_OperationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Entry_OperationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Entry_OperationDefaultTypeInternal() {}
+  union {
+    Entry_Operation _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Entry_OperationDefaultTypeInternal _Entry_Operation_default_instance_;
+PROTOBUF_CONSTEXPR Entry::Entry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ops_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.command_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.term_)*/uint64_t{0u}
+  , /*decltype(_impl_.optype_)*/0} {}
+struct EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EntryDefaultTypeInternal() {}
+  union {
+    Entry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EntryDefaultTypeInternal _Entry_default_instance_;
+PROTOBUF_CONSTEXPR KvCommand::KvCommand(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ops_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct KvCommandDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KvCommandDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KvCommandDefaultTypeInternal() {}
+  union {
+    KvCommand _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KvCommandDefaultTypeInternal _KvCommand_default_instance_;
+PROTOBUF_CONSTEXPR HardState::HardState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.voted_for_ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.current_term_)*/uint64_t{0u}
+  , /*decltype(_impl_.commit_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.voted_for_port_)*/0} {}
+struct HardStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HardStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HardStateDefaultTypeInternal() {}
+  union {
+    HardState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HardStateDefaultTypeInternal _HardState_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_Kv::CmdRequest_Kv(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CmdRequest_KvDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_KvDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_KvDefaultTypeInternal() {}
+  union {
+    CmdRequest_Kv _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_KvDefaultTypeInternal _CmdRequest_Kv_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_User::CmdRequest_User(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.port_)*/0} {}
+struct CmdRequest_UserDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_UserDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_UserDefaultTypeInternal() {}
+  union {
+    CmdRequest_User _instance;
   };
-  Entry_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Entry_descriptor_,
-      Entry::default_instance_,
-      Entry_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Entry, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Entry, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Entry));
-  Entry_OpType_descriptor_ = Entry_descriptor_->enum_type(0);
-  CmdRequest_descriptor_ = file->message_type(1);
-  static const int CmdRequest_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, kv_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, user_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, request_vote_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, append_entries_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, server_status_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_UserDefaultTypeInternal _CmdRequest_User_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_RequestVote::CmdRequest_RequestVote(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.term_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_log_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_log_term_)*/uint64_t{0u}
+  , /*decltype(_impl_.port_)*/0} {}
+struct CmdRequest_RequestVoteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_RequestVoteDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_RequestVoteDefaultTypeInternal() {}
+  union {
+    CmdRequest_RequestVote _instance;
   };
-  CmdRequest_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_descriptor_,
-      CmdRequest::default_instance_,
-      CmdRequest_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest));
-  CmdRequest_Kv_descriptor_ = CmdRequest_descriptor_->nested_type(0);
-  static const int CmdRequest_Kv_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Kv, key_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Kv, value_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_RequestVoteDefaultTypeInternal _CmdRequest_RequestVote_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_AppendEntries::CmdRequest_AppendEntries(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.term_)*/uint64_t{0u}
+  , /*decltype(_impl_.prev_log_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.prev_log_term_)*/uint64_t{0u}
+  , /*decltype(_impl_.leader_commit_)*/uint64_t{0u}
+  , /*decltype(_impl_.port_)*/0} {}
+struct CmdRequest_AppendEntriesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_AppendEntriesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_AppendEntriesDefaultTypeInternal() {}
+  union {
+    CmdRequest_AppendEntries _instance;
   };
-  CmdRequest_Kv_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_Kv_descriptor_,
-      CmdRequest_Kv::default_instance_,
-      CmdRequest_Kv_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Kv, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_Kv, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_Kv));
-  CmdRequest_User_descriptor_ = CmdRequest_descriptor_->nested_type(1);
-  static const int CmdRequest_User_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_User, ip_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_User, port_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_AppendEntriesDefaultTypeInternal _CmdRequest_AppendEntries_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_ServerStatus::CmdRequest_ServerStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.term_)*/int64_t{0}
+  , /*decltype(_impl_.commit_index_)*/int64_t{0}
+  , /*decltype(_impl_.port_)*/0} {}
+struct CmdRequest_ServerStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_ServerStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_ServerStatusDefaultTypeInternal() {}
+  union {
+    CmdRequest_ServerStatus _instance;
   };
-  CmdRequest_User_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_User_descriptor_,
-      CmdRequest_User::default_instance_,
-      CmdRequest_User_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_User, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_User, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_User));
-  CmdRequest_RequestVote_descriptor_ = CmdRequest_descriptor_->nested_type(2);
-  static const int CmdRequest_RequestVote_offsets_[5] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_RequestVote, term_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_RequestVote, ip_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_RequestVote, port_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_RequestVote, last_log_index_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_RequestVote, last_log_term_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_ServerStatusDefaultTypeInternal _CmdRequest_ServerStatus_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_WriteBatch::CmdRequest_WriteBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ops_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CmdRequest_WriteBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_WriteBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_WriteBatchDefaultTypeInternal() {}
+  union {
+    CmdRequest_WriteBatch _instance;
   };
-  CmdRequest_RequestVote_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_RequestVote_descriptor_,
-      CmdRequest_RequestVote::default_instance_,
-      CmdRequest_RequestVote_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_RequestVote, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_RequestVote, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_RequestVote));
-  CmdRequest_AppendEntries_descriptor_ = CmdRequest_descriptor_->nested_type(3);
-  static const int CmdRequest_AppendEntries_offsets_[7] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_AppendEntries, ip_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_AppendEntries, port_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_AppendEntries, term_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_AppendEntries, prev_log_index_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_AppendEntries, prev_log_term_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_AppendEntries, leader_commit_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_AppendEntries, entries_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_WriteBatchDefaultTypeInternal _CmdRequest_WriteBatch_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest_InstallSnapshot::CmdRequest_InstallSnapshot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.term_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_included_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_included_term_)*/uint64_t{0u}
+  , /*decltype(_impl_.port_)*/0
+  , /*decltype(_impl_.done_)*/false
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}} {}
+struct CmdRequest_InstallSnapshotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequest_InstallSnapshotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequest_InstallSnapshotDefaultTypeInternal() {}
+  union {
+    CmdRequest_InstallSnapshot _instance;
   };
-  CmdRequest_AppendEntries_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_AppendEntries_descriptor_,
-      CmdRequest_AppendEntries::default_instance_,
-      CmdRequest_AppendEntries_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_AppendEntries, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_AppendEntries, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_AppendEntries));
-  CmdRequest_ServerStatus_descriptor_ = CmdRequest_descriptor_->nested_type(4);
-  static const int CmdRequest_ServerStatus_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_ServerStatus, term_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_ServerStatus, commit_index_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_ServerStatus, ip_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_ServerStatus, port_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequest_InstallSnapshotDefaultTypeInternal _CmdRequest_InstallSnapshot_default_instance_;
+PROTOBUF_CONSTEXPR CmdRequest::CmdRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.forward_cmds_)*/{}
+  , /*decltype(_impl_.command_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.kv_)*/nullptr
+  , /*decltype(_impl_.user_)*/nullptr
+  , /*decltype(_impl_.request_vote_)*/nullptr
+  , /*decltype(_impl_.append_entries_)*/nullptr
+  , /*decltype(_impl_.server_status_)*/nullptr
+  , /*decltype(_impl_.write_batch_)*/nullptr
+  , /*decltype(_impl_.install_snapshot_)*/nullptr
+  , /*decltype(_impl_.type_)*/0} {}
+struct CmdRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdRequestDefaultTypeInternal() {}
+  union {
+    CmdRequest _instance;
   };
-  CmdRequest_ServerStatus_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdRequest_ServerStatus_descriptor_,
-      CmdRequest_ServerStatus::default_instance_,
-      CmdRequest_ServerStatus_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_ServerStatus, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdRequest_ServerStatus, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdRequest_ServerStatus));
-  CmdResponse_descriptor_ = file->message_type(2);
-  static const int CmdResponse_offsets_[8] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, code_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, msg_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, kv_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, kvs_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, request_vote_res_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, append_entries_res_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, server_status_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdRequestDefaultTypeInternal _CmdRequest_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_Kv::CmdResponse_Kv(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct CmdResponse_KvDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_KvDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_KvDefaultTypeInternal() {}
+  union {
+    CmdResponse_Kv _instance;
   };
-  CmdResponse_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_descriptor_,
-      CmdResponse::default_instance_,
-      CmdResponse_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse));
-  CmdResponse_Kv_descriptor_ = CmdResponse_descriptor_->nested_type(0);
-  static const int CmdResponse_Kv_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Kv, value_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_KvDefaultTypeInternal _CmdResponse_Kv_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_Kvs::CmdResponse_Kvs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.kv_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CmdResponse_KvsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_KvsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_KvsDefaultTypeInternal() {}
+  union {
+    CmdResponse_Kvs _instance;
   };
-  CmdResponse_Kv_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_Kv_descriptor_,
-      CmdResponse_Kv::default_instance_,
-      CmdResponse_Kv_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Kv, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Kv, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_Kv));
-  CmdResponse_Kvs_descriptor_ = CmdResponse_descriptor_->nested_type(1);
-  static const int CmdResponse_Kvs_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Kvs, kv_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_KvsDefaultTypeInternal _CmdResponse_Kvs_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_RequestVoteResponse::CmdResponse_RequestVoteResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.term_)*/uint64_t{0u}
+  , /*decltype(_impl_.vote_granted_)*/false} {}
+struct CmdResponse_RequestVoteResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_RequestVoteResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_RequestVoteResponseDefaultTypeInternal() {}
+  union {
+    CmdResponse_RequestVoteResponse _instance;
   };
-  CmdResponse_Kvs_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_Kvs_descriptor_,
-      CmdResponse_Kvs::default_instance_,
-      CmdResponse_Kvs_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Kvs, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_Kvs, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_Kvs));
-  CmdResponse_RequestVoteResponse_descriptor_ = CmdResponse_descriptor_->nested_type(2);
-  static const int CmdResponse_RequestVoteResponse_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_RequestVoteResponse, term_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_RequestVoteResponse, vote_granted_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_RequestVoteResponseDefaultTypeInternal _CmdResponse_RequestVoteResponse_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_AppendEntriesResponse::CmdResponse_AppendEntriesResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.term_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_log_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.success_)*/false} {}
+struct CmdResponse_AppendEntriesResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_AppendEntriesResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_AppendEntriesResponseDefaultTypeInternal() {}
+  union {
+    CmdResponse_AppendEntriesResponse _instance;
   };
-  CmdResponse_RequestVoteResponse_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_RequestVoteResponse_descriptor_,
-      CmdResponse_RequestVoteResponse::default_instance_,
-      CmdResponse_RequestVoteResponse_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_RequestVoteResponse, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_RequestVoteResponse, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_RequestVoteResponse));
-  CmdResponse_AppendEntriesResponse_descriptor_ = CmdResponse_descriptor_->nested_type(3);
-  static const int CmdResponse_AppendEntriesResponse_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_AppendEntriesResponse, term_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_AppendEntriesResponse, success_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_AppendEntriesResponse, last_log_index_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_AppendEntriesResponseDefaultTypeInternal _CmdResponse_AppendEntriesResponse_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_ServerStatus::CmdResponse_ServerStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.role_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.leader_ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.voted_for_ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.term_)*/uint64_t{0u}
+  , /*decltype(_impl_.commit_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.leader_port_)*/0
+  , /*decltype(_impl_.voted_for_port_)*/0
+  , /*decltype(_impl_.last_log_term_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_log_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.last_applied_)*/uint64_t{0u}} {}
+struct CmdResponse_ServerStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_ServerStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_ServerStatusDefaultTypeInternal() {}
+  union {
+    CmdResponse_ServerStatus _instance;
   };
-  CmdResponse_AppendEntriesResponse_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_AppendEntriesResponse_descriptor_,
-      CmdResponse_AppendEntriesResponse::default_instance_,
-      CmdResponse_AppendEntriesResponse_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_AppendEntriesResponse, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_AppendEntriesResponse, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_AppendEntriesResponse));
-  CmdResponse_ServerStatus_descriptor_ = CmdResponse_descriptor_->nested_type(4);
-  static const int CmdResponse_ServerStatus_offsets_[10] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, term_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, commit_index_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, role_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, leader_ip_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, leader_port_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, voted_for_ip_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, voted_for_port_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, last_log_term_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, last_log_index_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, last_applied_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_ServerStatusDefaultTypeInternal _CmdResponse_ServerStatus_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_ReadIndexResponse::CmdResponse_ReadIndexResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.read_index_)*/uint64_t{0u}} {}
+struct CmdResponse_ReadIndexResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_ReadIndexResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_ReadIndexResponseDefaultTypeInternal() {}
+  union {
+    CmdResponse_ReadIndexResponse _instance;
   };
-  CmdResponse_ServerStatus_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CmdResponse_ServerStatus_descriptor_,
-      CmdResponse_ServerStatus::default_instance_,
-      CmdResponse_ServerStatus_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CmdResponse_ServerStatus, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CmdResponse_ServerStatus));
-  Type_descriptor_ = file->enum_type(0);
-  StatusCode_descriptor_ = file->enum_type(1);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_floyd_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Entry_descriptor_, &Entry::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_descriptor_, &CmdRequest::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_Kv_descriptor_, &CmdRequest_Kv::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_User_descriptor_, &CmdRequest_User::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_RequestVote_descriptor_, &CmdRequest_RequestVote::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_AppendEntries_descriptor_, &CmdRequest_AppendEntries::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdRequest_ServerStatus_descriptor_, &CmdRequest_ServerStatus::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_descriptor_, &CmdResponse::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_Kv_descriptor_, &CmdResponse_Kv::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_Kvs_descriptor_, &CmdResponse_Kvs::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_RequestVoteResponse_descriptor_, &CmdResponse_RequestVoteResponse::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_AppendEntriesResponse_descriptor_, &CmdResponse_AppendEntriesResponse::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CmdResponse_ServerStatus_descriptor_, &CmdResponse_ServerStatus::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_floyd_2eproto() {
-  delete Entry::default_instance_;
-  delete Entry_reflection_;
-  delete CmdRequest::default_instance_;
-  delete CmdRequest_reflection_;
-  delete CmdRequest_Kv::default_instance_;
-  delete CmdRequest_Kv_reflection_;
-  delete CmdRequest_User::default_instance_;
-  delete CmdRequest_User_reflection_;
-  delete CmdRequest_RequestVote::default_instance_;
-  delete CmdRequest_RequestVote_reflection_;
-  delete CmdRequest_AppendEntries::default_instance_;
-  delete CmdRequest_AppendEntries_reflection_;
-  delete CmdRequest_ServerStatus::default_instance_;
-  delete CmdRequest_ServerStatus_reflection_;
-  delete CmdResponse::default_instance_;
-  delete CmdResponse_reflection_;
-  delete CmdResponse_Kv::default_instance_;
-  delete CmdResponse_Kv_reflection_;
-  delete CmdResponse_Kvs::default_instance_;
-  delete CmdResponse_Kvs_reflection_;
-  delete CmdResponse_RequestVoteResponse::default_instance_;
-  delete CmdResponse_RequestVoteResponse_reflection_;
-  delete CmdResponse_AppendEntriesResponse::default_instance_;
-  delete CmdResponse_AppendEntriesResponse_reflection_;
-  delete CmdResponse_ServerStatus::default_instance_;
-  delete CmdResponse_ServerStatus_reflection_;
-}
-
-void protobuf_AddDesc_floyd_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\013floyd.proto\022\005floyd\"\204\001\n\005Entry\022\014\n\004term\030\001"
-    " \002(\004\022\013\n\003key\030\002 \002(\t\022\r\n\005value\030\003 \001(\014\022#\n\006opty"
-    "pe\030\004 \002(\0162\023.floyd.Entry.OpType\",\n\006OpType\022"
-    "\t\n\005kRead\020\000\022\n\n\006kWrite\020\001\022\013\n\007kDelete\020\002\"\253\005\n\n"
-    "CmdRequest\022\031\n\004type\030\001 \002(\0162\013.floyd.Type\022 \n"
-    "\002kv\030\002 \001(\0132\024.floyd.CmdRequest.Kv\022$\n\004user\030"
-    "\003 \001(\0132\026.floyd.CmdRequest.User\0223\n\014request"
-    "_vote\030\004 \001(\0132\035.floyd.CmdRequest.RequestVo"
-    "te\0227\n\016append_entries\030\005 \001(\0132\037.floyd.CmdRe"
-    "quest.AppendEntries\0225\n\rserver_status\030\006 \001"
-    "(\0132\036.floyd.CmdRequest.ServerStatus\032 \n\002Kv"
-    "\022\013\n\003key\030\001 \002(\014\022\r\n\005value\030\002 \001(\014\032 \n\004User\022\n\n\002"
-    "ip\030\001 \002(\014\022\014\n\004port\030\002 \002(\005\032d\n\013RequestVote\022\014\n"
-    "\004term\030\001 \002(\004\022\n\n\002ip\030\002 \002(\014\022\014\n\004port\030\003 \002(\005\022\026\n"
-    "\016last_log_index\030\004 \002(\004\022\025\n\rlast_log_term\030\005"
-    " \002(\004\032\234\001\n\rAppendEntries\022\n\n\002ip\030\001 \002(\014\022\014\n\004po"
-    "rt\030\002 \002(\005\022\014\n\004term\030\003 \002(\004\022\026\n\016prev_log_index"
-    "\030\004 \002(\004\022\025\n\rprev_log_term\030\005 \002(\004\022\025\n\rleader_"
-    "commit\030\006 \002(\004\022\035\n\007entries\030\007 \003(\0132\014.floyd.En"
-    "try\032L\n\014ServerStatus\022\014\n\004term\030\001 \002(\003\022\024\n\014com"
-    "mit_index\030\002 \002(\003\022\n\n\002ip\030\003 \001(\014\022\014\n\004port\030\004 \001("
-    "\005\"\206\006\n\013CmdResponse\022\031\n\004type\030\001 \002(\0162\013.floyd."
-    "Type\022\037\n\004code\030\002 \001(\0162\021.floyd.StatusCode\022\013\n"
-    "\003msg\030\003 \001(\014\022!\n\002kv\030\004 \001(\0132\025.floyd.CmdRespon"
-    "se.Kv\022#\n\003kvs\030\005 \001(\0132\026.floyd.CmdResponse.K"
-    "vs\022@\n\020request_vote_res\030\006 \001(\0132&.floyd.Cmd"
-    "Response.RequestVoteResponse\022D\n\022append_e"
-    "ntries_res\030\007 \001(\0132(.floyd.CmdResponse.App"
-    "endEntriesResponse\0226\n\rserver_status\030\010 \001("
-    "\0132\037.floyd.CmdResponse.ServerStatus\032\023\n\002Kv"
-    "\022\r\n\005value\030\001 \001(\014\032(\n\003Kvs\022!\n\002kv\030\001 \003(\0132\025.flo"
-    "yd.CmdResponse.Kv\0329\n\023RequestVoteResponse"
-    "\022\014\n\004term\030\001 \002(\004\022\024\n\014vote_granted\030\002 \002(\010\032N\n\025"
-    "AppendEntriesResponse\022\014\n\004term\030\001 \002(\004\022\017\n\007s"
-    "uccess\030\002 \002(\010\022\026\n\016last_log_index\030\003 \001(\004\032\333\001\n"
-    "\014ServerStatus\022\014\n\004term\030\001 \002(\004\022\024\n\014commit_in"
-    "dex\030\002 \002(\004\022\014\n\004role\030\003 \002(\014\022\021\n\tleader_ip\030\004 \001"
-    "(\014\022\023\n\013leader_port\030\005 \001(\005\022\024\n\014voted_for_ip\030"
-    "\006 \001(\014\022\026\n\016voted_for_port\030\007 \001(\005\022\025\n\rlast_lo"
-    "g_term\030\010 \001(\004\022\026\n\016last_log_index\030\t \001(\004\022\024\n\014"
-    "last_applied\030\n \001(\004*t\n\004Type\022\t\n\005kRead\020\000\022\n\n"
-    "\006kWrite\020\001\022\017\n\013kDirtyWrite\020\002\022\013\n\007kDelete\020\003\022"
-    "\020\n\014kRequestVote\020\010\022\022\n\016kAppendEntries\020\t\022\021\n"
-    "\rkServerStatus\020\n*0\n\nStatusCode\022\007\n\003kOk\020\000\022"
-    "\r\n\tkNotFound\020\001\022\n\n\006kError\020\002", 1786);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "floyd.proto", &protobuf_RegisterTypes);
-  Entry::default_instance_ = new Entry();
-  CmdRequest::default_instance_ = new CmdRequest();
-  CmdRequest_Kv::default_instance_ = new CmdRequest_Kv();
-  CmdRequest_User::default_instance_ = new CmdRequest_User();
-  CmdRequest_RequestVote::default_instance_ = new CmdRequest_RequestVote();
-  CmdRequest_AppendEntries::default_instance_ = new CmdRequest_AppendEntries();
-  CmdRequest_ServerStatus::default_instance_ = new CmdRequest_ServerStatus();
-  CmdResponse::default_instance_ = new CmdResponse();
-  CmdResponse_Kv::default_instance_ = new CmdResponse_Kv();
-  CmdResponse_Kvs::default_instance_ = new CmdResponse_Kvs();
-  CmdResponse_RequestVoteResponse::default_instance_ = new CmdResponse_RequestVoteResponse();
-  CmdResponse_AppendEntriesResponse::default_instance_ = new CmdResponse_AppendEntriesResponse();
-  CmdResponse_ServerStatus::default_instance_ = new CmdResponse_ServerStatus();
-  Entry::default_instance_->InitAsDefaultInstance();
-  CmdRequest::default_instance_->InitAsDefaultInstance();
-  CmdRequest_Kv::default_instance_->InitAsDefaultInstance();
-  CmdRequest_User::default_instance_->InitAsDefaultInstance();
-  CmdRequest_RequestVote::default_instance_->InitAsDefaultInstance();
-  CmdRequest_AppendEntries::default_instance_->InitAsDefaultInstance();
-  CmdRequest_ServerStatus::default_instance_->InitAsDefaultInstance();
-  CmdResponse::default_instance_->InitAsDefaultInstance();
-  CmdResponse_Kv::default_instance_->InitAsDefaultInstance();
-  CmdResponse_Kvs::default_instance_->InitAsDefaultInstance();
-  CmdResponse_RequestVoteResponse::default_instance_->InitAsDefaultInstance();
-  CmdResponse_AppendEntriesResponse::default_instance_->InitAsDefaultInstance();
-  CmdResponse_ServerStatus::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_floyd_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_floyd_2eproto {
-  StaticDescriptorInitializer_floyd_2eproto() {
-    protobuf_AddDesc_floyd_2eproto();
-  }
-} static_descriptor_initializer_floyd_2eproto_;
-const ::google::protobuf::EnumDescriptor* Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Type_descriptor_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_ReadIndexResponseDefaultTypeInternal _CmdResponse_ReadIndexResponse_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse_InstallSnapshotResponse::CmdResponse_InstallSnapshotResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.term_)*/uint64_t{0u}
+  , /*decltype(_impl_.success_)*/false} {}
+struct CmdResponse_InstallSnapshotResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponse_InstallSnapshotResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponse_InstallSnapshotResponseDefaultTypeInternal() {}
+  union {
+    CmdResponse_InstallSnapshotResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponse_InstallSnapshotResponseDefaultTypeInternal _CmdResponse_InstallSnapshotResponse_default_instance_;
+PROTOBUF_CONSTEXPR CmdResponse::CmdResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.forward_res_)*/{}
+  , /*decltype(_impl_.msg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.kv_)*/nullptr
+  , /*decltype(_impl_.kvs_)*/nullptr
+  , /*decltype(_impl_.request_vote_res_)*/nullptr
+  , /*decltype(_impl_.append_entries_res_)*/nullptr
+  , /*decltype(_impl_.server_status_)*/nullptr
+  , /*decltype(_impl_.read_index_res_)*/nullptr
+  , /*decltype(_impl_.install_snapshot_res_)*/nullptr
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.code_)*/0} {}
+struct CmdResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CmdResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CmdResponseDefaultTypeInternal() {}
+  union {
+    CmdResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CmdResponseDefaultTypeInternal _CmdResponse_default_instance_;
+}  // namespace floyd
+static ::_pb::Metadata file_level_metadata_floyd_2eproto[20];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_floyd_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_floyd_2eproto = nullptr;
+
+const uint32_t TableStruct_floyd_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry_Operation, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry_Operation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry_Operation, _impl_.optype_),
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry_Operation, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry_Operation, _impl_.value_),
+  2,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry, _impl_.optype_),
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry, _impl_.ops_),
+  PROTOBUF_FIELD_OFFSET(::floyd::Entry, _impl_.command_),
+  3,
+  0,
+  1,
+  4,
+  ~0u,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::floyd::KvCommand, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::KvCommand, _impl_.ops_),
+  PROTOBUF_FIELD_OFFSET(::floyd::HardState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::HardState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::HardState, _impl_.current_term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::HardState, _impl_.voted_for_ip_),
+  PROTOBUF_FIELD_OFFSET(::floyd::HardState, _impl_.voted_for_port_),
+  PROTOBUF_FIELD_OFFSET(::floyd::HardState, _impl_.commit_index_),
+  1,
+  0,
+  3,
+  2,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_Kv, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_Kv, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_Kv, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_Kv, _impl_.value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_User, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_User, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_User, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_User, _impl_.port_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_RequestVote, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_RequestVote, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_RequestVote, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_RequestVote, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_RequestVote, _impl_.port_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_RequestVote, _impl_.last_log_index_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_RequestVote, _impl_.last_log_term_),
+  1,
+  0,
+  4,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_AppendEntries, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_AppendEntries, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_AppendEntries, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_AppendEntries, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_AppendEntries, _impl_.port_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_AppendEntries, _impl_.prev_log_index_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_AppendEntries, _impl_.prev_log_term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_AppendEntries, _impl_.leader_commit_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_AppendEntries, _impl_.entries_),
+  1,
+  0,
+  5,
+  2,
+  3,
+  4,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_ServerStatus, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_ServerStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_ServerStatus, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_ServerStatus, _impl_.commit_index_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_ServerStatus, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_ServerStatus, _impl_.port_),
+  1,
+  2,
+  0,
+  3,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_WriteBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_WriteBatch, _impl_.ops_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_.port_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_.last_included_index_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_.last_included_term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_.done_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest_InstallSnapshot, _impl_.data_),
+  3,
+  0,
+  6,
+  4,
+  5,
+  8,
+  7,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.kv_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.user_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.request_vote_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.append_entries_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.server_status_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.write_batch_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.install_snapshot_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.command_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdRequest, _impl_.forward_cmds_),
+  8,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_Kv, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_Kv, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_Kv, _impl_.value_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_Kvs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_Kvs, _impl_.kv_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_RequestVoteResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_RequestVoteResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_RequestVoteResponse, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_RequestVoteResponse, _impl_.vote_granted_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_AppendEntriesResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_AppendEntriesResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_AppendEntriesResponse, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_AppendEntriesResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_AppendEntriesResponse, _impl_.last_log_index_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.commit_index_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.role_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.leader_ip_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.leader_port_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.voted_for_ip_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.voted_for_port_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.last_log_term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.last_log_index_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ServerStatus, _impl_.last_applied_),
+  3,
+  4,
+  0,
+  1,
+  5,
+  2,
+  6,
+  7,
+  8,
+  9,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ReadIndexResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ReadIndexResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_ReadIndexResponse, _impl_.read_index_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_InstallSnapshotResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_InstallSnapshotResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_InstallSnapshotResponse, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse_InstallSnapshotResponse, _impl_.success_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.msg_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.kv_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.kvs_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.request_vote_res_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.append_entries_res_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.server_status_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.read_index_res_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.install_snapshot_res_),
+  PROTOBUF_FIELD_OFFSET(::floyd::CmdResponse, _impl_.forward_res_),
+  8,
+  9,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::floyd::Entry_Operation)},
+  { 12, 24, -1, sizeof(::floyd::Entry)},
+  { 30, -1, -1, sizeof(::floyd::KvCommand)},
+  { 37, 47, -1, sizeof(::floyd::HardState)},
+  { 51, 59, -1, sizeof(::floyd::CmdRequest_Kv)},
+  { 61, 69, -1, sizeof(::floyd::CmdRequest_User)},
+  { 71, 82, -1, sizeof(::floyd::CmdRequest_RequestVote)},
+  { 87, 100, -1, sizeof(::floyd::CmdRequest_AppendEntries)},
+  { 107, 117, -1, sizeof(::floyd::CmdRequest_ServerStatus)},
+  { 121, -1, -1, sizeof(::floyd::CmdRequest_WriteBatch)},
+  { 128, 143, -1, sizeof(::floyd::CmdRequest_InstallSnapshot)},
+  { 152, 168, -1, sizeof(::floyd::CmdRequest)},
+  { 178, 185, -1, sizeof(::floyd::CmdResponse_Kv)},
+  { 186, -1, -1, sizeof(::floyd::CmdResponse_Kvs)},
+  { 193, 201, -1, sizeof(::floyd::CmdResponse_RequestVoteResponse)},
+  { 203, 212, -1, sizeof(::floyd::CmdResponse_AppendEntriesResponse)},
+  { 215, 231, -1, sizeof(::floyd::CmdResponse_ServerStatus)},
+  { 241, 248, -1, sizeof(::floyd::CmdResponse_ReadIndexResponse)},
+  { 249, 257, -1, sizeof(::floyd::CmdResponse_InstallSnapshotResponse)},
+  { 259, 276, -1, sizeof(::floyd::CmdResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::floyd::_Entry_Operation_default_instance_._instance,
+  &::floyd::_Entry_default_instance_._instance,
+  &::floyd::_KvCommand_default_instance_._instance,
+  &::floyd::_HardState_default_instance_._instance,
+  &::floyd::_CmdRequest_Kv_default_instance_._instance,
+  &::floyd::_CmdRequest_User_default_instance_._instance,
+  &::floyd::_CmdRequest_RequestVote_default_instance_._instance,
+  &::floyd::_CmdRequest_AppendEntries_default_instance_._instance,
+  &::floyd::_CmdRequest_ServerStatus_default_instance_._instance,
+  &::floyd::_CmdRequest_WriteBatch_default_instance_._instance,
+  &::floyd::_CmdRequest_InstallSnapshot_default_instance_._instance,
+  &::floyd::_CmdRequest_default_instance_._instance,
+  &::floyd::_CmdResponse_Kv_default_instance_._instance,
+  &::floyd::_CmdResponse_Kvs_default_instance_._instance,
+  &::floyd::_CmdResponse_RequestVoteResponse_default_instance_._instance,
+  &::floyd::_CmdResponse_AppendEntriesResponse_default_instance_._instance,
+  &::floyd::_CmdResponse_ServerStatus_default_instance_._instance,
+  &::floyd::_CmdResponse_ReadIndexResponse_default_instance_._instance,
+  &::floyd::_CmdResponse_InstallSnapshotResponse_default_instance_._instance,
+  &::floyd::_CmdResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_floyd_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013floyd.proto\022\005floyd\"\262\002\n\005Entry\022\014\n\004term\030\001"
+  " \002(\004\022\013\n\003key\030\002 \002(\t\022\r\n\005value\030\003 \001(\014\022#\n\006opty"
+  "pe\030\004 \002(\0162\023.floyd.Entry.OpType\022#\n\003ops\030\005 \003"
+  "(\0132\026.floyd.Entry.Operation\022\017\n\007command\030\006 "
+  "\001(\014\032L\n\tOperation\022#\n\006optype\030\001 \002(\0162\023.floyd"
+  ".Entry.OpType\022\013\n\003key\030\002 \002(\014\022\r\n\005value\030\003 \001("
+  "\014\"V\n\006OpType\022\t\n\005kRead\020\000\022\n\n\006kWrite\020\001\022\013\n\007kD"
+  "elete\020\002\022\017\n\013kWriteBatch\020\003\022\014\n\010kCommand\020\004\022\t"
+  "\n\005kNoOp\020\005\"0\n\tKvCommand\022#\n\003ops\030\001 \003(\0132\026.fl"
+  "oyd.Entry.Operation\"e\n\tHardState\022\024\n\014curr"
+  "ent_term\030\001 \002(\004\022\024\n\014voted_for_ip\030\002 \001(\014\022\026\n\016"
+  "voted_for_port\030\003 \001(\005\022\024\n\014commit_index\030\004 \001"
+  "(\004\"\256\010\n\nCmdRequest\022\031\n\004type\030\001 \002(\0162\013.floyd."
+  "Type\022 \n\002kv\030\002 \001(\0132\024.floyd.CmdRequest.Kv\022$"
+  "\n\004user\030\003 \001(\0132\026.floyd.CmdRequest.User\0223\n\014"
+  "request_vote\030\004 \001(\0132\035.floyd.CmdRequest.Re"
+  "questVote\0227\n\016append_entries\030\005 \001(\0132\037.floy"
+  "d.CmdRequest.AppendEntries\0225\n\rserver_sta"
+  "tus\030\006 \001(\0132\036.floyd.CmdRequest.ServerStatu"
+  "s\0221\n\013write_batch\030\007 \001(\0132\034.floyd.CmdReques"
+  "t.WriteBatch\022;\n\020install_snapshot\030\010 \001(\0132!"
+  ".floyd.CmdRequest.InstallSnapshot\022\017\n\007com"
+  "mand\030\t \001(\014\022\'\n\014forward_cmds\030\n \003(\0132\021.floyd"
+  ".CmdRequest\032 \n\002Kv\022\013\n\003key\030\001 \002(\014\022\r\n\005value\030"
+  "\002 \001(\014\032 \n\004User\022\n\n\002ip\030\001 \002(\014\022\014\n\004port\030\002 \002(\005\032"
+  "d\n\013RequestVote\022\014\n\004term\030\001 \002(\004\022\n\n\002ip\030\002 \002(\014"
+  "\022\014\n\004port\030\003 \002(\005\022\026\n\016last_log_index\030\004 \002(\004\022\025"
+  "\n\rlast_log_term\030\005 \002(\004\032\216\001\n\rAppendEntries\022"
+  "\014\n\004term\030\001 \002(\004\022\n\n\002ip\030\002 \002(\014\022\014\n\004port\030\003 \002(\005\022"
+  "\026\n\016prev_log_index\030\004 \002(\004\022\025\n\rprev_log_term"
+  "\030\005 \002(\004\022\025\n\rleader_commit\030\006 \002(\004\022\017\n\007entries"
+  "\030\007 \003(\014\032L\n\014ServerStatus\022\014\n\004term\030\001 \002(\003\022\024\n\014"
+  "commit_index\030\002 \002(\003\022\n\n\002ip\030\003 \001(\014\022\014\n\004port\030\004"
+  " \001(\005\0321\n\nWriteBatch\022#\n\003ops\030\001 \003(\0132\026.floyd."
+  "Entry.Operation\032\261\001\n\017InstallSnapshot\022\014\n\004t"
+  "erm\030\001 \002(\004\022\n\n\002ip\030\002 \002(\014\022\014\n\004port\030\003 \002(\005\022\033\n\023l"
+  "ast_included_index\030\004 \002(\004\022\032\n\022last_include"
+  "d_term\030\005 \002(\004\022\016\n\006offset\030\006 \002(\004\022\014\n\004done\030\007 \002"
+  "(\010\022\021\n\tfile_name\030\t \001(\014\022\014\n\004data\030\n \001(\014\"\232\010\n\013"
+  "CmdResponse\022\031\n\004type\030\001 \002(\0162\013.floyd.Type\022\037"
+  "\n\004code\030\002 \001(\0162\021.floyd.StatusCode\022\013\n\003msg\030\003"
+  " \001(\014\022!\n\002kv\030\004 \001(\0132\025.floyd.CmdResponse.Kv\022"
+  "#\n\003kvs\030\005 \001(\0132\026.floyd.CmdResponse.Kvs\022@\n\020"
+  "request_vote_res\030\006 \001(\0132&.floyd.CmdRespon"
+  "se.RequestVoteResponse\022D\n\022append_entries"
+  "_res\030\007 \001(\0132(.floyd.CmdResponse.AppendEnt"
+  "riesResponse\0226\n\rserver_status\030\010 \001(\0132\037.fl"
+  "oyd.CmdResponse.ServerStatus\022<\n\016read_ind"
+  "ex_res\030\t \001(\0132$.floyd.CmdResponse.ReadInd"
+  "exResponse\022H\n\024install_snapshot_res\030\n \001(\013"
+  "2*.floyd.CmdResponse.InstallSnapshotResp"
+  "onse\022\'\n\013forward_res\030\013 \003(\0132\022.floyd.CmdRes"
+  "ponse\032\023\n\002Kv\022\r\n\005value\030\001 \001(\014\032(\n\003Kvs\022!\n\002kv\030"
+  "\001 \003(\0132\025.floyd.CmdResponse.Kv\0329\n\023RequestV"
+  "oteResponse\022\014\n\004term\030\001 \002(\004\022\024\n\014vote_grante"
+  "d\030\002 \002(\010\032N\n\025AppendEntriesResponse\022\014\n\004term"
+  "\030\001 \002(\004\022\017\n\007success\030\002 \002(\010\022\026\n\016last_log_inde"
+  "x\030\003 \001(\004\032\333\001\n\014ServerStatus\022\014\n\004term\030\001 \002(\004\022\024"
+  "\n\014commit_index\030\002 \002(\004\022\014\n\004role\030\003 \002(\014\022\021\n\tle"
+  "ader_ip\030\004 \001(\014\022\023\n\013leader_port\030\005 \001(\005\022\024\n\014vo"
+  "ted_for_ip\030\006 \001(\014\022\026\n\016voted_for_port\030\007 \001(\005"
+  "\022\025\n\rlast_log_term\030\010 \001(\004\022\026\n\016last_log_inde"
+  "x\030\t \001(\004\022\024\n\014last_applied\030\n \001(\004\032\'\n\021ReadInd"
+  "exResponse\022\022\n\nread_index\030\001 \002(\004\0328\n\027Instal"
+  "lSnapshotResponse\022\014\n\004term\030\001 \002(\004\022\017\n\007succe"
+  "ss\030\002 \002(\010*\314\001\n\004Type\022\t\n\005kRead\020\000\022\n\n\006kWrite\020\001"
+  "\022\017\n\013kDirtyWrite\020\002\022\013\n\007kDelete\020\003\022\017\n\013kWrite"
+  "Batch\020\004\022\020\n\014kRequestVote\020\010\022\022\n\016kAppendEntr"
+  "ies\020\t\022\021\n\rkServerStatus\020\n\022\016\n\nkReadIndex\020\013"
+  "\022\024\n\020kInstallSnapshot\020\014\022\014\n\010kCommand\020\r\022\021\n\r"
+  "kForwardBatch\020\016*0\n\nStatusCode\022\007\n\003kOk\020\000\022\r"
+  "\n\tkNotFound\020\001\022\n\n\006kError\020\002"
+  ;
+static ::_pbi::once_flag descriptor_table_floyd_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_floyd_2eproto = {
+    false, false, 2865, descriptor_table_protodef_floyd_2eproto,
+    "floyd.proto",
+    &descriptor_table_floyd_2eproto_once, nullptr, 0, 20,
+    schemas, file_default_instances, TableStruct_floyd_2eproto::offsets,
+    file_level_metadata_floyd_2eproto, file_level_enum_descriptors_floyd_2eproto,
+    file_level_service_descriptors_floyd_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_floyd_2eproto_getter() {
+  return &descriptor_table_floyd_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_floyd_2eproto(&descriptor_table_floyd_2eproto);
+namespace floyd {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Entry_OpType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_floyd_2eproto);
+  return file_level_enum_descriptors_floyd_2eproto[0];
+}
+bool Entry_OpType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Entry_OpType Entry::kRead;
+constexpr Entry_OpType Entry::kWrite;
+constexpr Entry_OpType Entry::kDelete;
+constexpr Entry_OpType Entry::kWriteBatch;
+constexpr Entry_OpType Entry::kCommand;
+constexpr Entry_OpType Entry::kNoOp;
+constexpr Entry_OpType Entry::OpType_MIN;
+constexpr Entry_OpType Entry::OpType_MAX;
+constexpr int Entry::OpType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_floyd_2eproto);
+  return file_level_enum_descriptors_floyd_2eproto[1];
 }
 bool Type_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
     case 3:
+    case 4:
     case 8:
     case 9:
     case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
       return true;
     default:
       return false;
   }
 }
 
-const ::google::protobuf::EnumDescriptor* StatusCode_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return StatusCode_descriptor_;
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_floyd_2eproto);
+  return file_level_enum_descriptors_floyd_2eproto[2];
 }
 bool StatusCode_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
@@ -509,4635 +864,7051 @@ bool StatusCode_IsValid(int value) {
 
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* Entry_OpType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Entry_OpType_descriptor_;
+class Entry_Operation::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Entry_Operation>()._impl_._has_bits_);
+  static void set_has_optype(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000005) ^ 0x00000005) != 0;
+  }
+};
+
+Entry_Operation::Entry_Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.Entry.Operation)
+}
+Entry_Operation::Entry_Operation(const Entry_Operation& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Entry_Operation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.optype_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.optype_ = from._impl_.optype_;
+  // @@protoc_insertion_point(copy_constructor:floyd.Entry.Operation)
+}
+
+inline void Entry_Operation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.optype_){0}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Entry_Operation::~Entry_Operation() {
+  // @@protoc_insertion_point(destructor:floyd.Entry.Operation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-bool Entry_OpType_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
+
+inline void Entry_Operation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void Entry_Operation::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Entry_Operation::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.Entry.Operation)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
   }
+  _impl_.optype_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#ifndef _MSC_VER
-const Entry_OpType Entry::kRead;
-const Entry_OpType Entry::kWrite;
-const Entry_OpType Entry::kDelete;
-const Entry_OpType Entry::OpType_MIN;
-const Entry_OpType Entry::OpType_MAX;
-const int Entry::OpType_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Entry::kTermFieldNumber;
-const int Entry::kKeyFieldNumber;
-const int Entry::kValueFieldNumber;
-const int Entry::kOptypeFieldNumber;
-#endif  // !_MSC_VER
+const char* Entry_Operation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .floyd.Entry.OpType optype = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::floyd::Entry_OpType_IsValid(val))) {
+            _internal_set_optype(static_cast<::floyd::Entry_OpType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Entry_Operation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.Entry.Operation)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .floyd.Entry.OpType optype = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_optype(), target);
+  }
+
+  // required bytes key = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_key(), target);
+  }
+
+  // optional bytes value = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_value(), target);
+  }
 
-Entry::Entry()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.Entry.Operation)
+  return target;
 }
 
-void Entry::InitAsDefaultInstance() {
+size_t Entry_Operation::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.Entry.Operation)
+  size_t total_size = 0;
+
+  if (_internal_has_key()) {
+    // required bytes key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  if (_internal_has_optype()) {
+    // required .floyd.Entry.OpType optype = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_optype());
+  }
+
+  return total_size;
 }
+size_t Entry_Operation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.Entry.Operation)
+  size_t total_size = 0;
 
-Entry::Entry(const Entry& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
+  if (((_impl_._has_bits_[0] & 0x00000005) ^ 0x00000005) == 0) {  // All required fields are present.
+    // required bytes key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+
+    // required .floyd.Entry.OpType optype = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_optype());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes value = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Entry_Operation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Entry_Operation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Entry_Operation::GetClassData() const { return &_class_data_; }
+
+
+void Entry_Operation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Entry_Operation*>(&to_msg);
+  auto& from = static_cast<const Entry_Operation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.Entry.Operation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.optype_ = from._impl_.optype_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Entry_Operation::CopyFrom(const Entry_Operation& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.Entry.Operation)
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
 }
 
-void Entry::SharedCtor() {
-  _cached_size_ = 0;
-  term_ = GOOGLE_ULONGLONG(0);
-  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  optype_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool Entry_Operation::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Entry_Operation::InternalSwap(Entry_Operation* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.optype_, other->_impl_.optype_);
 }
 
-Entry::~Entry() {
-  SharedDtor();
+::PROTOBUF_NAMESPACE_ID::Metadata Entry_Operation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[0]);
 }
 
-void Entry::SharedDtor() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
+// ===================================================================
+
+class Entry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Entry>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
   }
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  if (this != default_instance_) {
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-}
+  static void set_has_optype(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_command(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000019) ^ 0x00000019) != 0;
+  }
+};
 
-void Entry::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+Entry::Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.Entry)
 }
-const ::google::protobuf::Descriptor* Entry::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Entry_descriptor_;
+Entry::Entry(const Entry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Entry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ops_){from._impl_.ops_}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.command_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.optype_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_command()) {
+    _this->_impl_.command_.Set(from._internal_command(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.optype_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.optype_));
+  // @@protoc_insertion_point(copy_constructor:floyd.Entry)
+}
+
+inline void Entry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ops_){arena}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.command_){}
+    , decltype(_impl_.term_){uint64_t{0u}}
+    , decltype(_impl_.optype_){0}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-const Entry& Entry::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
+Entry::~Entry() {
+  // @@protoc_insertion_point(destructor:floyd.Entry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-Entry* Entry::default_instance_ = NULL;
+inline void Entry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ops_.~RepeatedPtrField();
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+  _impl_.command_.Destroy();
+}
 
-Entry* Entry::New() const {
-  return new Entry;
+void Entry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void Entry::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    term_ = GOOGLE_ULONGLONG(0);
-    if (has_key()) {
-      if (key_ != &::google::protobuf::internal::kEmptyString) {
-        key_->clear();
-      }
-    }
-    if (has_value()) {
-      if (value_ != &::google::protobuf::internal::kEmptyString) {
-        value_->clear();
-      }
-    }
-    optype_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Entry::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint64 term = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &term_)));
-          set_has_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_key;
-        break;
-      }
+// @@protoc_insertion_point(message_clear_start:floyd.Entry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-      // required string key = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_key:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_key()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->key().data(), this->key().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_value;
-        break;
-      }
+  _impl_.ops_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.command_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x00000018u) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.optype_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.optype_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
+const char* Entry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "floyd.Entry.key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional bytes value = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_value()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_optype;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .floyd.Entry.OpType optype = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_optype:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::floyd::Entry_OpType_IsValid(value)) {
-            set_optype(static_cast< ::floyd::Entry_OpType >(value));
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::floyd::Entry_OpType_IsValid(val))) {
+            _internal_set_optype(static_cast<::floyd::Entry_OpType>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(4, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Entry::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .floyd.Entry.Operation ops = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes command = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_command();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Entry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.Entry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint64 term = 1;
-  if (has_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->term(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_term(), target);
   }
 
   // required string key = 2;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->key(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "floyd.Entry.key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_key(), target);
   }
 
   // optional bytes value = 3;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      3, this->value(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_value(), target);
   }
 
   // required .floyd.Entry.OpType optype = 4;
-  if (has_optype()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      4, this->optype(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_optype(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // repeated .floyd.Entry.Operation ops = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* Entry::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint64 term = 1;
-  if (has_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->term(), target);
+  // optional bytes command = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_command(), target);
   }
 
-  // required string key = 2;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->key().data(), this->key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->key(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.Entry)
+  return target;
+}
 
-  // optional bytes value = 3;
-  if (has_value()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->value(), target);
+size_t Entry::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.Entry)
+  size_t total_size = 0;
+
+  if (_internal_has_key()) {
+    // required string key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
   }
 
-  // required .floyd.Entry.OpType optype = 4;
-  if (has_optype()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      4, this->optype(), target);
+  if (_internal_has_term()) {
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_optype()) {
+    // required .floyd.Entry.OpType optype = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_optype());
   }
-  return target;
+
+  return total_size;
 }
+size_t Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.Entry)
+  size_t total_size = 0;
 
-int Entry::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x00000019) ^ 0x00000019) == 0) {  // All required fields are present.
+    // required string key = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     // required uint64 term = 1;
-    if (has_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->term());
-    }
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
 
-    // required string key = 2;
-    if (has_key()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->key());
-    }
+    // required .floyd.Entry.OpType optype = 4;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_optype());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .floyd.Entry.Operation ops = 5;
+  total_size += 1UL * this->_internal_ops_size();
+  for (const auto& msg : this->_impl_.ops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
     // optional bytes value = 3;
-    if (has_value()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->value());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_value());
     }
 
-    // required .floyd.Entry.OpType optype = 4;
-    if (has_optype()) {
+    // optional bytes command = 6;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->optype());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_command());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Entry::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Entry* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Entry*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Entry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Entry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Entry::GetClassData() const { return &_class_data_; }
 
-void Entry::MergeFrom(const Entry& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_term()) {
-      set_term(from.term());
+
+void Entry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Entry*>(&to_msg);
+  auto& from = static_cast<const Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.Entry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ops_.MergeFrom(from._impl_.ops_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
     }
-    if (from.has_key()) {
-      set_key(from.key());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
     }
-    if (from.has_value()) {
-      set_value(from.value());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_command(from._internal_command());
     }
-    if (from.has_optype()) {
-      set_optype(from.optype());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.term_ = from._impl_.term_;
     }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.optype_ = from._impl_.optype_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Entry::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Entry::CopyFrom(const Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.Entry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Entry::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000b) != 0x0000000b) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.ops_))
+    return false;
   return true;
 }
 
-void Entry::Swap(Entry* other) {
-  if (other != this) {
-    std::swap(term_, other->term_);
-    std::swap(key_, other->key_);
-    std::swap(value_, other->value_);
-    std::swap(optype_, other->optype_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata Entry::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Entry_descriptor_;
-  metadata.reflection = Entry_reflection_;
-  return metadata;
+void Entry::InternalSwap(Entry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.ops_.InternalSwap(&other->_impl_.ops_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.command_, lhs_arena,
+      &other->_impl_.command_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Entry, _impl_.optype_)
+      + sizeof(Entry::_impl_.optype_)
+      - PROTOBUF_FIELD_OFFSET(Entry, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Entry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[1]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int CmdRequest_Kv::kKeyFieldNumber;
-const int CmdRequest_Kv::kValueFieldNumber;
-#endif  // !_MSC_VER
-
-CmdRequest_Kv::CmdRequest_Kv()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+class KvCommand::_Internal {
+ public:
+};
+
+KvCommand::KvCommand(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.KvCommand)
+}
+KvCommand::KvCommand(const KvCommand& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KvCommand* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){from._impl_.ops_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:floyd.KvCommand)
+}
+
+inline void KvCommand::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-void CmdRequest_Kv::InitAsDefaultInstance() {
+KvCommand::~KvCommand() {
+  // @@protoc_insertion_point(destructor:floyd.KvCommand)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-CmdRequest_Kv::CmdRequest_Kv(const CmdRequest_Kv& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+inline void KvCommand::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ops_.~RepeatedPtrField();
+}
+
+void KvCommand::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void KvCommand::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.KvCommand)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ops_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KvCommand::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .floyd.Entry.Operation ops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KvCommand::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.KvCommand)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .floyd.Entry.Operation ops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.KvCommand)
+  return target;
 }
 
-void CmdRequest_Kv::SharedCtor() {
-  _cached_size_ = 0;
-  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+size_t KvCommand::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.KvCommand)
+  size_t total_size = 0;
 
-CmdRequest_Kv::~CmdRequest_Kv() {
-  SharedDtor();
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void CmdRequest_Kv::SharedDtor() {
-  if (key_ != &::google::protobuf::internal::kEmptyString) {
-    delete key_;
-  }
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
-  }
-  if (this != default_instance_) {
+  // repeated .floyd.Entry.Operation ops = 1;
+  total_size += 1UL * this->_internal_ops_size();
+  for (const auto& msg : this->_impl_.ops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-}
 
-void CmdRequest_Kv::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-const ::google::protobuf::Descriptor* CmdRequest_Kv::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_Kv_descriptor_;
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KvCommand::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KvCommand::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KvCommand::GetClassData() const { return &_class_data_; }
+
+
+void KvCommand::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KvCommand*>(&to_msg);
+  auto& from = static_cast<const KvCommand&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.KvCommand)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ops_.MergeFrom(from._impl_.ops_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-const CmdRequest_Kv& CmdRequest_Kv::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
+void KvCommand::CopyFrom(const KvCommand& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.KvCommand)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-CmdRequest_Kv* CmdRequest_Kv::default_instance_ = NULL;
+bool KvCommand::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.ops_))
+    return false;
+  return true;
+}
 
-CmdRequest_Kv* CmdRequest_Kv::New() const {
-  return new CmdRequest_Kv;
+void KvCommand::InternalSwap(KvCommand* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ops_.InternalSwap(&other->_impl_.ops_);
 }
 
-void CmdRequest_Kv::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_key()) {
-      if (key_ != &::google::protobuf::internal::kEmptyString) {
-        key_->clear();
-      }
-    }
-    if (has_value()) {
-      if (value_ != &::google::protobuf::internal::kEmptyString) {
-        value_->clear();
-      }
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+::PROTOBUF_NAMESPACE_ID::Metadata KvCommand::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[2]);
 }
 
-bool CmdRequest_Kv::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required bytes key = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_key()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_value;
-        break;
-      }
+// ===================================================================
 
-      // optional bytes value = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_value()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
+class HardState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<HardState>()._impl_._has_bits_);
+  static void set_has_current_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_voted_for_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_voted_for_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_commit_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+HardState::HardState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.HardState)
+}
+HardState::HardState(const HardState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HardState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.voted_for_ip_){}
+    , decltype(_impl_.current_term_){}
+    , decltype(_impl_.commit_index_){}
+    , decltype(_impl_.voted_for_port_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.voted_for_ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.voted_for_ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_voted_for_ip()) {
+    _this->_impl_.voted_for_ip_.Set(from._internal_voted_for_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.current_term_, &from._impl_.current_term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.voted_for_port_) -
+    reinterpret_cast<char*>(&_impl_.current_term_)) + sizeof(_impl_.voted_for_port_));
+  // @@protoc_insertion_point(copy_constructor:floyd.HardState)
+}
+
+inline void HardState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.voted_for_ip_){}
+    , decltype(_impl_.current_term_){uint64_t{0u}}
+    , decltype(_impl_.commit_index_){uint64_t{0u}}
+    , decltype(_impl_.voted_for_port_){0}
+  };
+  _impl_.voted_for_ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.voted_for_ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void CmdRequest_Kv::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required bytes key = 1;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      1, this->key(), output);
-  }
-
-  // optional bytes value = 2;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      2, this->value(), output);
+HardState::~HardState() {
+  // @@protoc_insertion_point(destructor:floyd.HardState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+inline void HardState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.voted_for_ip_.Destroy();
+}
+
+void HardState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HardState::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.HardState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.voted_for_ip_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.current_term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.voted_for_port_) -
+        reinterpret_cast<char*>(&_impl_.current_term_)) + sizeof(_impl_.voted_for_port_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HardState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 current_term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_current_term(&has_bits);
+          _impl_.current_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes voted_for_ip = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_voted_for_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 voted_for_port = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_voted_for_port(&has_bits);
+          _impl_.voted_for_port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 commit_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_commit_index(&has_bits);
+          _impl_.commit_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HardState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.HardState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 current_term = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_current_term(), target);
+  }
+
+  // optional bytes voted_for_ip = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_voted_for_ip(), target);
+  }
+
+  // optional int32 voted_for_port = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_voted_for_port(), target);
+  }
+
+  // optional uint64 commit_index = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_commit_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.HardState)
+  return target;
 }
 
-::google::protobuf::uint8* CmdRequest_Kv::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required bytes key = 1;
-  if (has_key()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->key(), target);
-  }
+size_t HardState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.HardState)
+  size_t total_size = 0;
 
-  // optional bytes value = 2;
-  if (has_value()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->value(), target);
+  // required uint64 current_term = 1;
+  if (_internal_has_current_term()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_current_term());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // optional bytes voted_for_ip = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_voted_for_ip());
   }
-  return target;
-}
 
-int CmdRequest_Kv::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required bytes key = 1;
-    if (has_key()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->key());
+  if (cached_has_bits & 0x0000000cu) {
+    // optional uint64 commit_index = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_commit_index());
     }
 
-    // optional bytes value = 2;
-    if (has_value()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->value());
+    // optional int32 voted_for_port = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_voted_for_port());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_Kv::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_Kv* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_Kv*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HardState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HardState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HardState::GetClassData() const { return &_class_data_; }
+
 
-void CmdRequest_Kv::MergeFrom(const CmdRequest_Kv& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_key()) {
-      set_key(from.key());
+void HardState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HardState*>(&to_msg);
+  auto& from = static_cast<const HardState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.HardState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_voted_for_ip(from._internal_voted_for_ip());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.current_term_ = from._impl_.current_term_;
     }
-    if (from.has_value()) {
-      set_value(from.value());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.commit_index_ = from._impl_.commit_index_;
     }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.voted_for_port_ = from._impl_.voted_for_port_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest_Kv::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdRequest_Kv::CopyFrom(const CmdRequest_Kv& from) {
+void HardState::CopyFrom(const HardState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.HardState)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdRequest_Kv::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+bool HardState::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdRequest_Kv::Swap(CmdRequest_Kv* other) {
-  if (other != this) {
-    std::swap(key_, other->key_);
-    std::swap(value_, other->value_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void HardState::InternalSwap(HardState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.voted_for_ip_, lhs_arena,
+      &other->_impl_.voted_for_ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HardState, _impl_.voted_for_port_)
+      + sizeof(HardState::_impl_.voted_for_port_)
+      - PROTOBUF_FIELD_OFFSET(HardState, _impl_.current_term_)>(
+          reinterpret_cast<char*>(&_impl_.current_term_),
+          reinterpret_cast<char*>(&other->_impl_.current_term_));
 }
 
-::google::protobuf::Metadata CmdRequest_Kv::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_Kv_descriptor_;
-  metadata.reflection = CmdRequest_Kv_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata HardState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[3]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest_User::kIpFieldNumber;
-const int CmdRequest_User::kPortFieldNumber;
-#endif  // !_MSC_VER
+class CmdRequest_Kv::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_Kv>()._impl_._has_bits_);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-CmdRequest_User::CmdRequest_User()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+CmdRequest_Kv::CmdRequest_Kv(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdRequest.Kv)
 }
-
-void CmdRequest_User::InitAsDefaultInstance() {
+CmdRequest_Kv::CmdRequest_Kv(const CmdRequest_Kv& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_Kv* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdRequest.Kv)
+}
+
+inline void CmdRequest_Kv::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-CmdRequest_User::CmdRequest_User(const CmdRequest_User& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+CmdRequest_Kv::~CmdRequest_Kv() {
+  // @@protoc_insertion_point(destructor:floyd.CmdRequest.Kv)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void CmdRequest_User::SharedCtor() {
-  _cached_size_ = 0;
-  ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  port_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void CmdRequest_Kv::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-CmdRequest_User::~CmdRequest_User() {
-  SharedDtor();
+void CmdRequest_Kv::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void CmdRequest_User::SharedDtor() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
-  }
-  if (this != default_instance_) {
+void CmdRequest_Kv::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdRequest.Kv)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
+    }
   }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CmdRequest_User::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdRequest_User::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_User_descriptor_;
-}
+const char* CmdRequest_Kv::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_Kv::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdRequest.Kv)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bytes key = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
 
-const CmdRequest_User& CmdRequest_User::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
+  // optional bytes value = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdRequest.Kv)
+  return target;
 }
 
-CmdRequest_User* CmdRequest_User::default_instance_ = NULL;
+size_t CmdRequest_Kv::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdRequest.Kv)
+  size_t total_size = 0;
 
-CmdRequest_User* CmdRequest_User::New() const {
-  return new CmdRequest_User;
-}
+  // required bytes key = 1;
+  if (_internal_has_key()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void CmdRequest_User::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_ip()) {
-      if (ip_ != &::google::protobuf::internal::kEmptyString) {
-        ip_->clear();
-      }
-    }
-    port_ = 0;
+  // optional bytes value = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-bool CmdRequest_User::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required bytes ip = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_ip()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_port;
-        break;
-      }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_Kv::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_Kv::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_Kv::GetClassData() const { return &_class_data_; }
 
-      // required int32 port = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &port_)));
-          set_has_port();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+
+void CmdRequest_Kv::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_Kv*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_Kv&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdRequest.Kv)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
     }
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CmdRequest_Kv::CopyFrom(const CmdRequest_Kv& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdRequest.Kv)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdRequest_Kv::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
-#undef DO_
 }
 
-void CmdRequest_User::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required bytes ip = 1;
-  if (has_ip()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      1, this->ip(), output);
-  }
+void CmdRequest_Kv::InternalSwap(CmdRequest_Kv* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
 
-  // required int32 port = 2;
-  if (has_port()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->port(), output);
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_Kv::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[4]);
+}
+
+// ===================================================================
+
+class CmdRequest_User::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_User>()._impl_._has_bits_);
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
+  static void set_has_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+CmdRequest_User::CmdRequest_User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdRequest.User)
+}
+CmdRequest_User::CmdRequest_User(const CmdRequest_User& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_User* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.port_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ip()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.port_ = from._impl_.port_;
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdRequest.User)
+}
+
+inline void CmdRequest_User::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.port_){0}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+CmdRequest_User::~CmdRequest_User() {
+  // @@protoc_insertion_point(destructor:floyd.CmdRequest.User)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void CmdRequest_User::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
 }
 
-::google::protobuf::uint8* CmdRequest_User::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+void CmdRequest_User::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdRequest_User::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdRequest.User)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.ip_.ClearNonDefaultToEmpty();
+  }
+  _impl_.port_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdRequest_User::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bytes ip = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 port = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_port(&has_bits);
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_User::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdRequest.User)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required bytes ip = 1;
-  if (has_ip()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->ip(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_ip(), target);
   }
 
   // required int32 port = 2;
-  if (has_port()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->port(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_port(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdRequest.User)
   return target;
 }
 
-int CmdRequest_User::ByteSize() const {
-  int total_size = 0;
+size_t CmdRequest_User::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.CmdRequest.User)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (_internal_has_ip()) {
     // required bytes ip = 1;
-    if (has_ip()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->ip());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
+  }
 
+  if (_internal_has_port()) {
     // required int32 port = 2;
-    if (has_port()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->port());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t CmdRequest_User::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdRequest.User)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required bytes ip = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
+
+    // required int32 port = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
 
-void CmdRequest_User::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_User* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_User*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_User::MergeFrom(const CmdRequest_User& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_ip()) {
-      set_ip(from.ip());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_User::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_User::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_User::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_User::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_User*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_User&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdRequest.User)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_ip(from._internal_ip());
     }
-    if (from.has_port()) {
-      set_port(from.port());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.port_ = from._impl_.port_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest_User::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdRequest_User::CopyFrom(const CmdRequest_User& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdRequest.User)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdRequest_User::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdRequest_User::Swap(CmdRequest_User* other) {
-  if (other != this) {
-    std::swap(ip_, other->ip_);
-    std::swap(port_, other->port_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdRequest_User::InternalSwap(CmdRequest_User* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  swap(_impl_.port_, other->_impl_.port_);
 }
 
-::google::protobuf::Metadata CmdRequest_User::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_User_descriptor_;
-  metadata.reflection = CmdRequest_User_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_User::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[5]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest_RequestVote::kTermFieldNumber;
-const int CmdRequest_RequestVote::kIpFieldNumber;
-const int CmdRequest_RequestVote::kPortFieldNumber;
-const int CmdRequest_RequestVote::kLastLogIndexFieldNumber;
-const int CmdRequest_RequestVote::kLastLogTermFieldNumber;
-#endif  // !_MSC_VER
-
-CmdRequest_RequestVote::CmdRequest_RequestVote()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CmdRequest_RequestVote::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_RequestVote>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_last_log_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_last_log_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
 
-void CmdRequest_RequestVote::InitAsDefaultInstance() {
+CmdRequest_RequestVote::CmdRequest_RequestVote(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdRequest.RequestVote)
 }
-
 CmdRequest_RequestVote::CmdRequest_RequestVote(const CmdRequest_RequestVote& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdRequest_RequestVote::SharedCtor() {
-  _cached_size_ = 0;
-  term_ = GOOGLE_ULONGLONG(0);
-  ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  port_ = 0;
-  last_log_index_ = GOOGLE_ULONGLONG(0);
-  last_log_term_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_RequestVote* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.last_log_index_){}
+    , decltype(_impl_.last_log_term_){}
+    , decltype(_impl_.port_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ip()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.port_));
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdRequest.RequestVote)
+}
+
+inline void CmdRequest_RequestVote::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.term_){uint64_t{0u}}
+    , decltype(_impl_.last_log_index_){uint64_t{0u}}
+    , decltype(_impl_.last_log_term_){uint64_t{0u}}
+    , decltype(_impl_.port_){0}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CmdRequest_RequestVote::~CmdRequest_RequestVote() {
+  // @@protoc_insertion_point(destructor:floyd.CmdRequest.RequestVote)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdRequest_RequestVote::SharedDtor() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
-  }
-  if (this != default_instance_) {
-  }
+inline void CmdRequest_RequestVote::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
 }
 
 void CmdRequest_RequestVote::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdRequest_RequestVote::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_RequestVote_descriptor_;
-}
-
-const CmdRequest_RequestVote& CmdRequest_RequestVote::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
-}
-
-CmdRequest_RequestVote* CmdRequest_RequestVote::default_instance_ = NULL;
-
-CmdRequest_RequestVote* CmdRequest_RequestVote::New() const {
-  return new CmdRequest_RequestVote;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdRequest_RequestVote::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    term_ = GOOGLE_ULONGLONG(0);
-    if (has_ip()) {
-      if (ip_ != &::google::protobuf::internal::kEmptyString) {
-        ip_->clear();
-      }
-    }
-    port_ = 0;
-    last_log_index_ = GOOGLE_ULONGLONG(0);
-    last_log_term_ = GOOGLE_ULONGLONG(0);
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdRequest_RequestVote::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdRequest.RequestVote)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.ip_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000001eu) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.port_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.port_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdRequest_RequestVote::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint64 term = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &term_)));
-          set_has_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_ip;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required bytes ip = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_ip:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_ip()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_port;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 port = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &port_)));
-          set_has_port();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_last_log_index;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_port(&has_bits);
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint64 last_log_index = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_last_log_index:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &last_log_index_)));
-          set_has_last_log_index();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(40)) goto parse_last_log_term;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_last_log_index(&has_bits);
+          _impl_.last_log_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint64 last_log_term = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_last_log_term:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &last_log_term_)));
-          set_has_last_log_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdRequest_RequestVote::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_last_log_term(&has_bits);
+          _impl_.last_log_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_RequestVote::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdRequest.RequestVote)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint64 term = 1;
-  if (has_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->term(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_term(), target);
   }
 
   // required bytes ip = 2;
-  if (has_ip()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      2, this->ip(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_ip(), target);
   }
 
   // required int32 port = 3;
-  if (has_port()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->port(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_port(), target);
   }
 
   // required uint64 last_log_index = 4;
-  if (has_last_log_index()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->last_log_index(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_last_log_index(), target);
   }
 
   // required uint64 last_log_term = 5;
-  if (has_last_log_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->last_log_term(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_last_log_term(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdRequest.RequestVote)
+  return target;
 }
 
-::google::protobuf::uint8* CmdRequest_RequestVote::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint64 term = 1;
-  if (has_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->term(), target);
-  }
+size_t CmdRequest_RequestVote::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.CmdRequest.RequestVote)
+  size_t total_size = 0;
 
-  // required bytes ip = 2;
-  if (has_ip()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        2, this->ip(), target);
+  if (_internal_has_ip()) {
+    // required bytes ip = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
   }
 
-  // required int32 port = 3;
-  if (has_port()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->port(), target);
+  if (_internal_has_term()) {
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
   }
 
-  // required uint64 last_log_index = 4;
-  if (has_last_log_index()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->last_log_index(), target);
+  if (_internal_has_last_log_index()) {
+    // required uint64 last_log_index = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_log_index());
   }
 
-  // required uint64 last_log_term = 5;
-  if (has_last_log_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->last_log_term(), target);
+  if (_internal_has_last_log_term()) {
+    // required uint64 last_log_term = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_log_term());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_port()) {
+    // required int32 port = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
-  return target;
-}
-
-int CmdRequest_RequestVote::ByteSize() const {
-  int total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint64 term = 1;
-    if (has_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->term());
-    }
+  return total_size;
+}
+size_t CmdRequest_RequestVote::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdRequest.RequestVote)
+  size_t total_size = 0;
 
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
     // required bytes ip = 2;
-    if (has_ip()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->ip());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
 
-    // required int32 port = 3;
-    if (has_port()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->port());
-    }
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
 
     // required uint64 last_log_index = 4;
-    if (has_last_log_index()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->last_log_index());
-    }
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_log_index());
 
     // required uint64 last_log_term = 5;
-    if (has_last_log_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->last_log_term());
-    }
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_log_term());
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // required int32 port = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
 
-void CmdRequest_RequestVote::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_RequestVote* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_RequestVote*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_RequestVote::MergeFrom(const CmdRequest_RequestVote& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_term()) {
-      set_term(from.term());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_RequestVote::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_RequestVote::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_RequestVote::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_RequestVote::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_RequestVote*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_RequestVote&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdRequest.RequestVote)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_ip(from._internal_ip());
     }
-    if (from.has_ip()) {
-      set_ip(from.ip());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.term_ = from._impl_.term_;
     }
-    if (from.has_port()) {
-      set_port(from.port());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.last_log_index_ = from._impl_.last_log_index_;
     }
-    if (from.has_last_log_index()) {
-      set_last_log_index(from.last_log_index());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.last_log_term_ = from._impl_.last_log_term_;
     }
-    if (from.has_last_log_term()) {
-      set_last_log_term(from.last_log_term());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.port_ = from._impl_.port_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest_RequestVote::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdRequest_RequestVote::CopyFrom(const CmdRequest_RequestVote& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdRequest.RequestVote)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdRequest_RequestVote::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000001f) != 0x0000001f) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdRequest_RequestVote::Swap(CmdRequest_RequestVote* other) {
-  if (other != this) {
-    std::swap(term_, other->term_);
-    std::swap(ip_, other->ip_);
-    std::swap(port_, other->port_);
-    std::swap(last_log_index_, other->last_log_index_);
-    std::swap(last_log_term_, other->last_log_term_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdRequest_RequestVote::InternalSwap(CmdRequest_RequestVote* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdRequest_RequestVote, _impl_.port_)
+      + sizeof(CmdRequest_RequestVote::_impl_.port_)
+      - PROTOBUF_FIELD_OFFSET(CmdRequest_RequestVote, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::google::protobuf::Metadata CmdRequest_RequestVote::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_RequestVote_descriptor_;
-  metadata.reflection = CmdRequest_RequestVote_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_RequestVote::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[6]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest_AppendEntries::kIpFieldNumber;
-const int CmdRequest_AppendEntries::kPortFieldNumber;
-const int CmdRequest_AppendEntries::kTermFieldNumber;
-const int CmdRequest_AppendEntries::kPrevLogIndexFieldNumber;
-const int CmdRequest_AppendEntries::kPrevLogTermFieldNumber;
-const int CmdRequest_AppendEntries::kLeaderCommitFieldNumber;
-const int CmdRequest_AppendEntries::kEntriesFieldNumber;
-#endif  // !_MSC_VER
-
-CmdRequest_AppendEntries::CmdRequest_AppendEntries()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CmdRequest_AppendEntries::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_AppendEntries>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_prev_log_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_prev_log_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_leader_commit(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000003f) ^ 0x0000003f) != 0;
+  }
+};
 
-void CmdRequest_AppendEntries::InitAsDefaultInstance() {
+CmdRequest_AppendEntries::CmdRequest_AppendEntries(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdRequest.AppendEntries)
 }
-
 CmdRequest_AppendEntries::CmdRequest_AppendEntries(const CmdRequest_AppendEntries& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdRequest_AppendEntries::SharedCtor() {
-  _cached_size_ = 0;
-  ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  port_ = 0;
-  term_ = GOOGLE_ULONGLONG(0);
-  prev_log_index_ = GOOGLE_ULONGLONG(0);
-  prev_log_term_ = GOOGLE_ULONGLONG(0);
-  leader_commit_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_AppendEntries* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.prev_log_index_){}
+    , decltype(_impl_.prev_log_term_){}
+    , decltype(_impl_.leader_commit_){}
+    , decltype(_impl_.port_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ip()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.port_));
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdRequest.AppendEntries)
+}
+
+inline void CmdRequest_AppendEntries::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.term_){uint64_t{0u}}
+    , decltype(_impl_.prev_log_index_){uint64_t{0u}}
+    , decltype(_impl_.prev_log_term_){uint64_t{0u}}
+    , decltype(_impl_.leader_commit_){uint64_t{0u}}
+    , decltype(_impl_.port_){0}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CmdRequest_AppendEntries::~CmdRequest_AppendEntries() {
+  // @@protoc_insertion_point(destructor:floyd.CmdRequest.AppendEntries)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdRequest_AppendEntries::SharedDtor() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
-  }
-  if (this != default_instance_) {
-  }
+inline void CmdRequest_AppendEntries::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+  _impl_.ip_.Destroy();
 }
 
 void CmdRequest_AppendEntries::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdRequest_AppendEntries::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_AppendEntries_descriptor_;
-}
-
-const CmdRequest_AppendEntries& CmdRequest_AppendEntries::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
-}
-
-CmdRequest_AppendEntries* CmdRequest_AppendEntries::default_instance_ = NULL;
-
-CmdRequest_AppendEntries* CmdRequest_AppendEntries::New() const {
-  return new CmdRequest_AppendEntries;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdRequest_AppendEntries::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_ip()) {
-      if (ip_ != &::google::protobuf::internal::kEmptyString) {
-        ip_->clear();
-      }
-    }
-    port_ = 0;
-    term_ = GOOGLE_ULONGLONG(0);
-    prev_log_index_ = GOOGLE_ULONGLONG(0);
-    prev_log_term_ = GOOGLE_ULONGLONG(0);
-    leader_commit_ = GOOGLE_ULONGLONG(0);
-  }
-  entries_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdRequest_AppendEntries::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required bytes ip = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_ip()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_port;
-        break;
-      }
-
-      // required int32 port = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &port_)));
-          set_has_port();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_term;
-        break;
-      }
-
-      // required uint64 term = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_term:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &term_)));
-          set_has_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_prev_log_index;
-        break;
-      }
-
+// @@protoc_insertion_point(message_clear_start:floyd.CmdRequest.AppendEntries)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.ip_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.port_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.port_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdRequest_AppendEntries::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes ip = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 port = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_port(&has_bits);
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint64 prev_log_index = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_prev_log_index:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &prev_log_index_)));
-          set_has_prev_log_index();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(40)) goto parse_prev_log_term;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_prev_log_index(&has_bits);
+          _impl_.prev_log_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint64 prev_log_term = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_prev_log_term:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &prev_log_term_)));
-          set_has_prev_log_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(48)) goto parse_leader_commit;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_prev_log_term(&has_bits);
+          _impl_.prev_log_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint64 leader_commit = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_leader_commit:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &leader_commit_)));
-          set_has_leader_commit();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_entries;
-        break;
-      }
-
-      // repeated .floyd.Entry entries = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_entries:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_entries()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_entries;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdRequest_AppendEntries::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required bytes ip = 1;
-  if (has_ip()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      1, this->ip(), output);
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_leader_commit(&has_bits);
+          _impl_.leader_commit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes entries = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_entries();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_AppendEntries::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdRequest.AppendEntries)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 term = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_term(), target);
   }
 
-  // required int32 port = 2;
-  if (has_port()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->port(), output);
+  // required bytes ip = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_ip(), target);
   }
 
-  // required uint64 term = 3;
-  if (has_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->term(), output);
+  // required int32 port = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_port(), target);
   }
 
   // required uint64 prev_log_index = 4;
-  if (has_prev_log_index()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->prev_log_index(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_prev_log_index(), target);
   }
 
   // required uint64 prev_log_term = 5;
-  if (has_prev_log_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->prev_log_term(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_prev_log_term(), target);
   }
 
   // required uint64 leader_commit = 6;
-  if (has_leader_commit()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->leader_commit(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_leader_commit(), target);
   }
 
-  // repeated .floyd.Entry entries = 7;
-  for (int i = 0; i < this->entries_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->entries(i), output);
+  // repeated bytes entries = 7;
+  for (int i = 0, n = this->_internal_entries_size(); i < n; i++) {
+    const auto& s = this->_internal_entries(i);
+    target = stream->WriteBytes(7, s, target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdRequest.AppendEntries)
+  return target;
 }
 
-::google::protobuf::uint8* CmdRequest_AppendEntries::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required bytes ip = 1;
-  if (has_ip()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->ip(), target);
+size_t CmdRequest_AppendEntries::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.CmdRequest.AppendEntries)
+  size_t total_size = 0;
+
+  if (_internal_has_ip()) {
+    // required bytes ip = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
   }
 
-  // required int32 port = 2;
-  if (has_port()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->port(), target);
+  if (_internal_has_term()) {
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
   }
 
-  // required uint64 term = 3;
-  if (has_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->term(), target);
+  if (_internal_has_prev_log_index()) {
+    // required uint64 prev_log_index = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_prev_log_index());
   }
 
-  // required uint64 prev_log_index = 4;
-  if (has_prev_log_index()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->prev_log_index(), target);
+  if (_internal_has_prev_log_term()) {
+    // required uint64 prev_log_term = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_prev_log_term());
   }
 
-  // required uint64 prev_log_term = 5;
-  if (has_prev_log_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->prev_log_term(), target);
+  if (_internal_has_leader_commit()) {
+    // required uint64 leader_commit = 6;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_leader_commit());
   }
 
-  // required uint64 leader_commit = 6;
-  if (has_leader_commit()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->leader_commit(), target);
+  if (_internal_has_port()) {
+    // required int32 port = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
 
-  // repeated .floyd.Entry entries = 7;
-  for (int i = 0; i < this->entries_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->entries(i), target);
+  return total_size;
+}
+size_t CmdRequest_AppendEntries::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdRequest.AppendEntries)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000003f) ^ 0x0000003f) == 0) {  // All required fields are present.
+    // required bytes ip = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
+
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
+
+    // required uint64 prev_log_index = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_prev_log_index());
+
+    // required uint64 prev_log_term = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_prev_log_term());
+
+    // required uint64 leader_commit = 6;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_leader_commit());
+
+    // required int32 port = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // repeated bytes entries = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.entries_.size());
+  for (int i = 0, n = _impl_.entries_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.entries_.Get(i));
   }
-  return target;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int CmdRequest_AppendEntries::ByteSize() const {
-  int total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_AppendEntries::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_AppendEntries::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_AppendEntries::GetClassData() const { return &_class_data_; }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required bytes ip = 1;
-    if (has_ip()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->ip());
-    }
 
-    // required int32 port = 2;
-    if (has_port()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->port());
-    }
+void CmdRequest_AppendEntries::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_AppendEntries*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_AppendEntries&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdRequest.AppendEntries)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    // required uint64 term = 3;
-    if (has_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->term());
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_ip(from._internal_ip());
     }
-
-    // required uint64 prev_log_index = 4;
-    if (has_prev_log_index()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->prev_log_index());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.term_ = from._impl_.term_;
     }
-
-    // required uint64 prev_log_term = 5;
-    if (has_prev_log_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->prev_log_term());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.prev_log_index_ = from._impl_.prev_log_index_;
     }
-
-    // required uint64 leader_commit = 6;
-    if (has_leader_commit()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->leader_commit());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.prev_log_term_ = from._impl_.prev_log_term_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.leader_commit_ = from._impl_.leader_commit_;
     }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.port_ = from._impl_.port_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
+void CmdRequest_AppendEntries::CopyFrom(const CmdRequest_AppendEntries& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdRequest.AppendEntries)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdRequest_AppendEntries::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CmdRequest_AppendEntries::InternalSwap(CmdRequest_AppendEntries* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdRequest_AppendEntries, _impl_.port_)
+      + sizeof(CmdRequest_AppendEntries::_impl_.port_)
+      - PROTOBUF_FIELD_OFFSET(CmdRequest_AppendEntries, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_AppendEntries::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[7]);
+}
+
+// ===================================================================
+
+class CmdRequest_ServerStatus::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_ServerStatus>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-  // repeated .floyd.Entry entries = 7;
-  total_size += 1 * this->entries_size();
-  for (int i = 0; i < this->entries_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->entries(i));
+  static void set_has_commit_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
+  static void set_has_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000006) ^ 0x00000006) != 0;
+  }
+};
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+CmdRequest_ServerStatus::CmdRequest_ServerStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdRequest.ServerStatus)
+}
+CmdRequest_ServerStatus::CmdRequest_ServerStatus(const CmdRequest_ServerStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_ServerStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.commit_index_){}
+    , decltype(_impl_.port_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ip()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.port_));
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdRequest.ServerStatus)
+}
+
+inline void CmdRequest_ServerStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.term_){int64_t{0}}
+    , decltype(_impl_.commit_index_){int64_t{0}}
+    , decltype(_impl_.port_){0}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdRequest_ServerStatus::~CmdRequest_ServerStatus() {
+  // @@protoc_insertion_point(destructor:floyd.CmdRequest.ServerStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  SharedDtor();
+}
+
+inline void CmdRequest_ServerStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
+}
+
+void CmdRequest_ServerStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdRequest_ServerStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdRequest.ServerStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.ip_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.port_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.port_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdRequest_ServerStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int64 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 commit_index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_commit_index(&has_bits);
+          _impl_.commit_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes ip = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 port = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_port(&has_bits);
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_ServerStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdRequest.ServerStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int64 term = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_term(), target);
+  }
+
+  // required int64 commit_index = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_commit_index(), target);
+  }
+
+  // optional bytes ip = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_ip(), target);
+  }
+
+  // optional int32 port = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_port(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdRequest.ServerStatus)
+  return target;
+}
+
+size_t CmdRequest_ServerStatus::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.CmdRequest.ServerStatus)
+  size_t total_size = 0;
+
+  if (_internal_has_term()) {
+    // required int64 term = 1;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_term());
+  }
+
+  if (_internal_has_commit_index()) {
+    // required int64 commit_index = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_commit_index());
+  }
+
   return total_size;
 }
+size_t CmdRequest_ServerStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdRequest.ServerStatus)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000006) ^ 0x00000006) == 0) {  // All required fields are present.
+    // required int64 term = 1;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_term());
+
+    // required int64 commit_index = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_commit_index());
 
-void CmdRequest_AppendEntries::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_AppendEntries* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_AppendEntries*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes ip = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
+  }
+
+  // optional int32 port = 4;
+  if (cached_has_bits & 0x00000008u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_AppendEntries::MergeFrom(const CmdRequest_AppendEntries& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  entries_.MergeFrom(from.entries_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_ip()) {
-      set_ip(from.ip());
-    }
-    if (from.has_port()) {
-      set_port(from.port());
-    }
-    if (from.has_term()) {
-      set_term(from.term());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_ServerStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_ServerStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_ServerStatus::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_ServerStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_ServerStatus*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_ServerStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdRequest.ServerStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_ip(from._internal_ip());
     }
-    if (from.has_prev_log_index()) {
-      set_prev_log_index(from.prev_log_index());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.term_ = from._impl_.term_;
     }
-    if (from.has_prev_log_term()) {
-      set_prev_log_term(from.prev_log_term());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.commit_index_ = from._impl_.commit_index_;
     }
-    if (from.has_leader_commit()) {
-      set_leader_commit(from.leader_commit());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.port_ = from._impl_.port_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CmdRequest_ServerStatus::CopyFrom(const CmdRequest_ServerStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdRequest.ServerStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdRequest_ServerStatus::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
 
-void CmdRequest_AppendEntries::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void CmdRequest_ServerStatus::InternalSwap(CmdRequest_ServerStatus* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdRequest_ServerStatus, _impl_.port_)
+      + sizeof(CmdRequest_ServerStatus::_impl_.port_)
+      - PROTOBUF_FIELD_OFFSET(CmdRequest_ServerStatus, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-void CmdRequest_AppendEntries::CopyFrom(const CmdRequest_AppendEntries& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_ServerStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[8]);
 }
 
-bool CmdRequest_AppendEntries::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000003f) != 0x0000003f) return false;
+// ===================================================================
 
-  for (int i = 0; i < entries_size(); i++) {
-    if (!this->entries(i).IsInitialized()) return false;
-  }
-  return true;
+class CmdRequest_WriteBatch::_Internal {
+ public:
+};
+
+CmdRequest_WriteBatch::CmdRequest_WriteBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdRequest.WriteBatch)
+}
+CmdRequest_WriteBatch::CmdRequest_WriteBatch(const CmdRequest_WriteBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_WriteBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){from._impl_.ops_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdRequest.WriteBatch)
+}
+
+inline void CmdRequest_WriteBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-void CmdRequest_AppendEntries::Swap(CmdRequest_AppendEntries* other) {
-  if (other != this) {
-    std::swap(ip_, other->ip_);
-    std::swap(port_, other->port_);
-    std::swap(term_, other->term_);
-    std::swap(prev_log_index_, other->prev_log_index_);
-    std::swap(prev_log_term_, other->prev_log_term_);
-    std::swap(leader_commit_, other->leader_commit_);
-    entries_.Swap(&other->entries_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+CmdRequest_WriteBatch::~CmdRequest_WriteBatch() {
+  // @@protoc_insertion_point(destructor:floyd.CmdRequest.WriteBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-::google::protobuf::Metadata CmdRequest_AppendEntries::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_AppendEntries_descriptor_;
-  metadata.reflection = CmdRequest_AppendEntries_reflection_;
-  return metadata;
+inline void CmdRequest_WriteBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ops_.~RepeatedPtrField();
+}
+
+void CmdRequest_WriteBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdRequest_WriteBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdRequest.WriteBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ops_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdRequest_WriteBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .floyd.Entry.Operation ops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_WriteBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdRequest.WriteBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .floyd.Entry.Operation ops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdRequest.WriteBatch)
+  return target;
 }
 
+size_t CmdRequest_WriteBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdRequest.WriteBatch)
+  size_t total_size = 0;
 
-// -------------------------------------------------------------------
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-#ifndef _MSC_VER
-const int CmdRequest_ServerStatus::kTermFieldNumber;
-const int CmdRequest_ServerStatus::kCommitIndexFieldNumber;
-const int CmdRequest_ServerStatus::kIpFieldNumber;
-const int CmdRequest_ServerStatus::kPortFieldNumber;
-#endif  // !_MSC_VER
+  // repeated .floyd.Entry.Operation ops = 1;
+  total_size += 1UL * this->_internal_ops_size();
+  for (const auto& msg : this->_impl_.ops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
-CmdRequest_ServerStatus::CmdRequest_ServerStatus()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_ServerStatus::InitAsDefaultInstance() {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_WriteBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_WriteBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_WriteBatch::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest_WriteBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_WriteBatch*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_WriteBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdRequest.WriteBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ops_.MergeFrom(from._impl_.ops_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-CmdRequest_ServerStatus::CmdRequest_ServerStatus(const CmdRequest_ServerStatus& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
+void CmdRequest_WriteBatch::CopyFrom(const CmdRequest_WriteBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdRequest.WriteBatch)
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
 }
 
-void CmdRequest_ServerStatus::SharedCtor() {
-  _cached_size_ = 0;
-  term_ = GOOGLE_LONGLONG(0);
-  commit_index_ = GOOGLE_LONGLONG(0);
-  ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  port_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool CmdRequest_WriteBatch::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.ops_))
+    return false;
+  return true;
 }
 
-CmdRequest_ServerStatus::~CmdRequest_ServerStatus() {
-  SharedDtor();
+void CmdRequest_WriteBatch::InternalSwap(CmdRequest_WriteBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ops_.InternalSwap(&other->_impl_.ops_);
 }
 
-void CmdRequest_ServerStatus::SharedDtor() {
-  if (ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete ip_;
-  }
-  if (this != default_instance_) {
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_WriteBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[9]);
 }
 
-void CmdRequest_ServerStatus::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+// ===================================================================
+
+class CmdRequest_InstallSnapshot::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest_InstallSnapshot>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_last_included_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_last_included_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_done(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_file_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000001f9) ^ 0x000001f9) != 0;
+  }
+};
+
+CmdRequest_InstallSnapshot::CmdRequest_InstallSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdRequest.InstallSnapshot)
+}
+CmdRequest_InstallSnapshot::CmdRequest_InstallSnapshot(const CmdRequest_InstallSnapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest_InstallSnapshot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.last_included_index_){}
+    , decltype(_impl_.last_included_term_){}
+    , decltype(_impl_.port_){}
+    , decltype(_impl_.done_){}
+    , decltype(_impl_.offset_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_ip()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_file_name()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdRequest.InstallSnapshot)
+}
+
+inline void CmdRequest_InstallSnapshot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){}
+    , decltype(_impl_.file_name_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.term_){uint64_t{0u}}
+    , decltype(_impl_.last_included_index_){uint64_t{0u}}
+    , decltype(_impl_.last_included_term_){uint64_t{0u}}
+    , decltype(_impl_.port_){0}
+    , decltype(_impl_.done_){false}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CmdRequest_InstallSnapshot::~CmdRequest_InstallSnapshot() {
+  // @@protoc_insertion_point(destructor:floyd.CmdRequest.InstallSnapshot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-const ::google::protobuf::Descriptor* CmdRequest_ServerStatus::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_ServerStatus_descriptor_;
+
+inline void CmdRequest_InstallSnapshot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
+  _impl_.file_name_.Destroy();
+  _impl_.data_.Destroy();
 }
 
-const CmdRequest_ServerStatus& CmdRequest_ServerStatus::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
+void CmdRequest_InstallSnapshot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-CmdRequest_ServerStatus* CmdRequest_ServerStatus::default_instance_ = NULL;
+void CmdRequest_InstallSnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdRequest.InstallSnapshot)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-CmdRequest_ServerStatus* CmdRequest_ServerStatus::New() const {
-  return new CmdRequest_ServerStatus;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.ip_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.file_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.data_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.done_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.done_));
+  }
+  _impl_.offset_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CmdRequest_ServerStatus::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    term_ = GOOGLE_LONGLONG(0);
-    commit_index_ = GOOGLE_LONGLONG(0);
-    if (has_ip()) {
-      if (ip_ != &::google::protobuf::internal::kEmptyString) {
-        ip_->clear();
-      }
-    }
-    port_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdRequest_ServerStatus::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required int64 term = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &term_)));
-          set_has_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_commit_index;
-        break;
-      }
+const char* CmdRequest_InstallSnapshot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes ip = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 port = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_port(&has_bits);
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 last_included_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_last_included_index(&has_bits);
+          _impl_.last_included_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 last_included_term = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_last_included_term(&has_bits);
+          _impl_.last_included_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool done = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_done(&has_bits);
+          _impl_.done_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes file_name = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes data = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest_InstallSnapshot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdRequest.InstallSnapshot)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 term = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_term(), target);
+  }
 
-      // required int64 commit_index = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_commit_index:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &commit_index_)));
-          set_has_commit_index();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_ip;
-        break;
-      }
+  // required bytes ip = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_ip(), target);
+  }
 
-      // optional bytes ip = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_ip:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_ip()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_port;
-        break;
-      }
+  // required int32 port = 3;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_port(), target);
+  }
 
-      // optional int32 port = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &port_)));
-          set_has_port();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+  // required uint64 last_included_index = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_last_included_index(), target);
   }
-  return true;
-#undef DO_
-}
 
-void CmdRequest_ServerStatus::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required int64 term = 1;
-  if (has_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->term(), output);
+  // required uint64 last_included_term = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_last_included_term(), target);
   }
 
-  // required int64 commit_index = 2;
-  if (has_commit_index()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->commit_index(), output);
+  // required uint64 offset = 6;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_offset(), target);
   }
 
-  // optional bytes ip = 3;
-  if (has_ip()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      3, this->ip(), output);
+  // required bool done = 7;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_done(), target);
   }
 
-  // optional int32 port = 4;
-  if (has_port()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->port(), output);
+  // optional bytes file_name = 9;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_file_name(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional bytes data = 10;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        10, this->_internal_data(), target);
   }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdRequest.InstallSnapshot)
+  return target;
 }
 
-::google::protobuf::uint8* CmdRequest_ServerStatus::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required int64 term = 1;
-  if (has_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->term(), target);
+size_t CmdRequest_InstallSnapshot::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.CmdRequest.InstallSnapshot)
+  size_t total_size = 0;
+
+  if (_internal_has_ip()) {
+    // required bytes ip = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
   }
 
-  // required int64 commit_index = 2;
-  if (has_commit_index()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->commit_index(), target);
+  if (_internal_has_term()) {
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
   }
 
-  // optional bytes ip = 3;
-  if (has_ip()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->ip(), target);
+  if (_internal_has_last_included_index()) {
+    // required uint64 last_included_index = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_included_index());
   }
 
-  // optional int32 port = 4;
-  if (has_port()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->port(), target);
+  if (_internal_has_last_included_term()) {
+    // required uint64 last_included_term = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_included_term());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_port()) {
+    // required int32 port = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
   }
-  return target;
+
+  if (_internal_has_done()) {
+    // required bool done = 7;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_offset()) {
+    // required uint64 offset = 6;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  return total_size;
 }
+size_t CmdRequest_InstallSnapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdRequest.InstallSnapshot)
+  size_t total_size = 0;
 
-int CmdRequest_ServerStatus::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x000001f9) ^ 0x000001f9) == 0) {  // All required fields are present.
+    // required bytes ip = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_ip());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int64 term = 1;
-    if (has_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->term());
-    }
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
 
-    // required int64 commit_index = 2;
-    if (has_commit_index()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->commit_index());
-    }
+    // required uint64 last_included_index = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_included_index());
+
+    // required uint64 last_included_term = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_included_term());
+
+    // required int32 port = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
+
+    // required bool done = 7;
+    total_size += 1 + 1;
+
+    // required uint64 offset = 6;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    // optional bytes ip = 3;
-    if (has_ip()) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional bytes file_name = 9;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->ip());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_file_name());
     }
 
-    // optional int32 port = 4;
-    if (has_port()) {
+    // optional bytes data = 10;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->port());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_data());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest_ServerStatus::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest_ServerStatus* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest_ServerStatus*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest_InstallSnapshot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest_InstallSnapshot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest_InstallSnapshot::GetClassData() const { return &_class_data_; }
 
-void CmdRequest_ServerStatus::MergeFrom(const CmdRequest_ServerStatus& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_term()) {
-      set_term(from.term());
+
+void CmdRequest_InstallSnapshot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest_InstallSnapshot*>(&to_msg);
+  auto& from = static_cast<const CmdRequest_InstallSnapshot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdRequest.InstallSnapshot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_ip(from._internal_ip());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_file_name(from._internal_file_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_data(from._internal_data());
     }
-    if (from.has_commit_index()) {
-      set_commit_index(from.commit_index());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.term_ = from._impl_.term_;
     }
-    if (from.has_ip()) {
-      set_ip(from.ip());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.last_included_index_ = from._impl_.last_included_index_;
     }
-    if (from.has_port()) {
-      set_port(from.port());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.last_included_term_ = from._impl_.last_included_term_;
     }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.port_ = from._impl_.port_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.done_ = from._impl_.done_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest_ServerStatus::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CmdRequest_ServerStatus::CopyFrom(const CmdRequest_ServerStatus& from) {
+void CmdRequest_InstallSnapshot::CopyFrom(const CmdRequest_InstallSnapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdRequest.InstallSnapshot)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CmdRequest_ServerStatus::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+bool CmdRequest_InstallSnapshot::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdRequest_ServerStatus::Swap(CmdRequest_ServerStatus* other) {
-  if (other != this) {
-    std::swap(term_, other->term_);
-    std::swap(commit_index_, other->commit_index_);
-    std::swap(ip_, other->ip_);
-    std::swap(port_, other->port_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata CmdRequest_ServerStatus::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_ServerStatus_descriptor_;
-  metadata.reflection = CmdRequest_ServerStatus_reflection_;
-  return metadata;
+void CmdRequest_InstallSnapshot::InternalSwap(CmdRequest_InstallSnapshot* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdRequest_InstallSnapshot, _impl_.offset_)
+      + sizeof(CmdRequest_InstallSnapshot::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(CmdRequest_InstallSnapshot, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest_InstallSnapshot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[10]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdRequest::kTypeFieldNumber;
-const int CmdRequest::kKvFieldNumber;
-const int CmdRequest::kUserFieldNumber;
-const int CmdRequest::kRequestVoteFieldNumber;
-const int CmdRequest::kAppendEntriesFieldNumber;
-const int CmdRequest::kServerStatusFieldNumber;
-#endif  // !_MSC_VER
+class CmdRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdRequest>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::floyd::CmdRequest_Kv& kv(const CmdRequest* msg);
+  static void set_has_kv(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::floyd::CmdRequest_User& user(const CmdRequest* msg);
+  static void set_has_user(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::floyd::CmdRequest_RequestVote& request_vote(const CmdRequest* msg);
+  static void set_has_request_vote(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::floyd::CmdRequest_AppendEntries& append_entries(const CmdRequest* msg);
+  static void set_has_append_entries(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::floyd::CmdRequest_ServerStatus& server_status(const CmdRequest* msg);
+  static void set_has_server_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::floyd::CmdRequest_WriteBatch& write_batch(const CmdRequest* msg);
+  static void set_has_write_batch(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::floyd::CmdRequest_InstallSnapshot& install_snapshot(const CmdRequest* msg);
+  static void set_has_install_snapshot(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_command(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000100) ^ 0x00000100) != 0;
+  }
+};
 
-CmdRequest::CmdRequest()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::floyd::CmdRequest_Kv&
+CmdRequest::_Internal::kv(const CmdRequest* msg) {
+  return *msg->_impl_.kv_;
 }
-
-void CmdRequest::InitAsDefaultInstance() {
-  kv_ = const_cast< ::floyd::CmdRequest_Kv*>(&::floyd::CmdRequest_Kv::default_instance());
-  user_ = const_cast< ::floyd::CmdRequest_User*>(&::floyd::CmdRequest_User::default_instance());
-  request_vote_ = const_cast< ::floyd::CmdRequest_RequestVote*>(&::floyd::CmdRequest_RequestVote::default_instance());
-  append_entries_ = const_cast< ::floyd::CmdRequest_AppendEntries*>(&::floyd::CmdRequest_AppendEntries::default_instance());
-  server_status_ = const_cast< ::floyd::CmdRequest_ServerStatus*>(&::floyd::CmdRequest_ServerStatus::default_instance());
+const ::floyd::CmdRequest_User&
+CmdRequest::_Internal::user(const CmdRequest* msg) {
+  return *msg->_impl_.user_;
 }
-
-CmdRequest::CmdRequest(const CmdRequest& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::floyd::CmdRequest_RequestVote&
+CmdRequest::_Internal::request_vote(const CmdRequest* msg) {
+  return *msg->_impl_.request_vote_;
 }
-
-void CmdRequest::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 0;
-  kv_ = NULL;
-  user_ = NULL;
-  request_vote_ = NULL;
-  append_entries_ = NULL;
-  server_status_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+const ::floyd::CmdRequest_AppendEntries&
+CmdRequest::_Internal::append_entries(const CmdRequest* msg) {
+  return *msg->_impl_.append_entries_;
 }
-
-CmdRequest::~CmdRequest() {
-  SharedDtor();
+const ::floyd::CmdRequest_ServerStatus&
+CmdRequest::_Internal::server_status(const CmdRequest* msg) {
+  return *msg->_impl_.server_status_;
 }
-
-void CmdRequest::SharedDtor() {
-  if (this != default_instance_) {
-    delete kv_;
-    delete user_;
-    delete request_vote_;
-    delete append_entries_;
-    delete server_status_;
-  }
+const ::floyd::CmdRequest_WriteBatch&
+CmdRequest::_Internal::write_batch(const CmdRequest* msg) {
+  return *msg->_impl_.write_batch_;
 }
-
-void CmdRequest::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+const ::floyd::CmdRequest_InstallSnapshot&
+CmdRequest::_Internal::install_snapshot(const CmdRequest* msg) {
+  return *msg->_impl_.install_snapshot_;
 }
-const ::google::protobuf::Descriptor* CmdRequest::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdRequest_descriptor_;
+CmdRequest::CmdRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdRequest)
 }
-
-const CmdRequest& CmdRequest::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
+CmdRequest::CmdRequest(const CmdRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.forward_cmds_){from._impl_.forward_cmds_}
+    , decltype(_impl_.command_){}
+    , decltype(_impl_.kv_){nullptr}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.request_vote_){nullptr}
+    , decltype(_impl_.append_entries_){nullptr}
+    , decltype(_impl_.server_status_){nullptr}
+    , decltype(_impl_.write_batch_){nullptr}
+    , decltype(_impl_.install_snapshot_){nullptr}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_command()) {
+    _this->_impl_.command_.Set(from._internal_command(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_kv()) {
+    _this->_impl_.kv_ = new ::floyd::CmdRequest_Kv(*from._impl_.kv_);
+  }
+  if (from._internal_has_user()) {
+    _this->_impl_.user_ = new ::floyd::CmdRequest_User(*from._impl_.user_);
+  }
+  if (from._internal_has_request_vote()) {
+    _this->_impl_.request_vote_ = new ::floyd::CmdRequest_RequestVote(*from._impl_.request_vote_);
+  }
+  if (from._internal_has_append_entries()) {
+    _this->_impl_.append_entries_ = new ::floyd::CmdRequest_AppendEntries(*from._impl_.append_entries_);
+  }
+  if (from._internal_has_server_status()) {
+    _this->_impl_.server_status_ = new ::floyd::CmdRequest_ServerStatus(*from._impl_.server_status_);
+  }
+  if (from._internal_has_write_batch()) {
+    _this->_impl_.write_batch_ = new ::floyd::CmdRequest_WriteBatch(*from._impl_.write_batch_);
+  }
+  if (from._internal_has_install_snapshot()) {
+    _this->_impl_.install_snapshot_ = new ::floyd::CmdRequest_InstallSnapshot(*from._impl_.install_snapshot_);
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdRequest)
+}
+
+inline void CmdRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.forward_cmds_){arena}
+    , decltype(_impl_.command_){}
+    , decltype(_impl_.kv_){nullptr}
+    , decltype(_impl_.user_){nullptr}
+    , decltype(_impl_.request_vote_){nullptr}
+    , decltype(_impl_.append_entries_){nullptr}
+    , decltype(_impl_.server_status_){nullptr}
+    , decltype(_impl_.write_batch_){nullptr}
+    , decltype(_impl_.install_snapshot_){nullptr}
+    , decltype(_impl_.type_){0}
+  };
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-CmdRequest* CmdRequest::default_instance_ = NULL;
+CmdRequest::~CmdRequest() {
+  // @@protoc_insertion_point(destructor:floyd.CmdRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-CmdRequest* CmdRequest::New() const {
-  return new CmdRequest;
+inline void CmdRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.forward_cmds_.~RepeatedPtrField();
+  _impl_.command_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.kv_;
+  if (this != internal_default_instance()) delete _impl_.user_;
+  if (this != internal_default_instance()) delete _impl_.request_vote_;
+  if (this != internal_default_instance()) delete _impl_.append_entries_;
+  if (this != internal_default_instance()) delete _impl_.server_status_;
+  if (this != internal_default_instance()) delete _impl_.write_batch_;
+  if (this != internal_default_instance()) delete _impl_.install_snapshot_;
 }
 
-void CmdRequest::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    if (has_kv()) {
-      if (kv_ != NULL) kv_->::floyd::CmdRequest_Kv::Clear();
-    }
-    if (has_user()) {
-      if (user_ != NULL) user_->::floyd::CmdRequest_User::Clear();
-    }
-    if (has_request_vote()) {
-      if (request_vote_ != NULL) request_vote_->::floyd::CmdRequest_RequestVote::Clear();
-    }
-    if (has_append_entries()) {
-      if (append_entries_ != NULL) append_entries_->::floyd::CmdRequest_AppendEntries::Clear();
-    }
-    if (has_server_status()) {
-      if (server_status_ != NULL) server_status_->::floyd::CmdRequest_ServerStatus::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+void CmdRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-bool CmdRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+void CmdRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.forward_cmds_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.command_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.kv_ != nullptr);
+      _impl_.kv_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.user_ != nullptr);
+      _impl_.user_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.request_vote_ != nullptr);
+      _impl_.request_vote_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.append_entries_ != nullptr);
+      _impl_.append_entries_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.server_status_ != nullptr);
+      _impl_.server_status_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.write_batch_ != nullptr);
+      _impl_.write_batch_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.install_snapshot_ != nullptr);
+      _impl_.install_snapshot_->Clear();
+    }
+  }
+  _impl_.type_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .floyd.Type type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::floyd::Type_IsValid(value)) {
-            set_type(static_cast< ::floyd::Type >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::floyd::Type_IsValid(val))) {
+            _internal_set_type(static_cast<::floyd::Type>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_kv;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional .floyd.CmdRequest.Kv kv = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_kv:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_kv()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_user;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_kv(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .floyd.CmdRequest.User user = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_user:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_user()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_request_vote;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .floyd.CmdRequest.RequestVote request_vote = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_request_vote:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_request_vote()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_append_entries;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request_vote(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .floyd.CmdRequest.AppendEntries append_entries = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_append_entries:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_append_entries()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_server_status;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_append_entries(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .floyd.CmdRequest.ServerStatus server_status = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_server_status:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_server_status()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_server_status(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.CmdRequest.WriteBatch write_batch = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_write_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.CmdRequest.InstallSnapshot install_snapshot = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_install_snapshot(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes command = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_command();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .floyd.CmdRequest forward_cmds = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_forward_cmds(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .floyd.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // optional .floyd.CmdRequest.Kv kv = 2;
-  if (has_kv()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->kv(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::kv(this),
+        _Internal::kv(this).GetCachedSize(), target, stream);
   }
 
   // optional .floyd.CmdRequest.User user = 3;
-  if (has_user()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->user(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::user(this),
+        _Internal::user(this).GetCachedSize(), target, stream);
   }
 
   // optional .floyd.CmdRequest.RequestVote request_vote = 4;
-  if (has_request_vote()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->request_vote(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::request_vote(this),
+        _Internal::request_vote(this).GetCachedSize(), target, stream);
   }
 
   // optional .floyd.CmdRequest.AppendEntries append_entries = 5;
-  if (has_append_entries()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->append_entries(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::append_entries(this),
+        _Internal::append_entries(this).GetCachedSize(), target, stream);
   }
 
   // optional .floyd.CmdRequest.ServerStatus server_status = 6;
-  if (has_server_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->server_status(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::server_status(this),
+        _Internal::server_status(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional .floyd.CmdRequest.WriteBatch write_batch = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::write_batch(this),
+        _Internal::write_batch(this).GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* CmdRequest::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .floyd.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
+  // optional .floyd.CmdRequest.InstallSnapshot install_snapshot = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::install_snapshot(this),
+        _Internal::install_snapshot(this).GetCachedSize(), target, stream);
   }
 
-  // optional .floyd.CmdRequest.Kv kv = 2;
-  if (has_kv()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->kv(), target);
+  // optional bytes command = 9;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_command(), target);
   }
 
-  // optional .floyd.CmdRequest.User user = 3;
-  if (has_user()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->user(), target);
+  // repeated .floyd.CmdRequest forward_cmds = 10;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_forward_cmds_size()); i < n; i++) {
+    const auto& repfield = this->_internal_forward_cmds(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // optional .floyd.CmdRequest.RequestVote request_vote = 4;
-  if (has_request_vote()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->request_vote(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdRequest)
+  return target;
+}
 
-  // optional .floyd.CmdRequest.AppendEntries append_entries = 5;
-  if (has_append_entries()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->append_entries(), target);
-  }
+size_t CmdRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdRequest)
+  size_t total_size = 0;
 
-  // optional .floyd.CmdRequest.ServerStatus server_status = 6;
-  if (has_server_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->server_status(), target);
+  // required .floyd.Type type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // repeated .floyd.CmdRequest forward_cmds = 10;
+  total_size += 1UL * this->_internal_forward_cmds_size();
+  for (const auto& msg : this->_impl_.forward_cmds_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  return target;
-}
 
-int CmdRequest::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .floyd.Type type = 1;
-    if (has_type()) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional bytes command = 9;
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_command());
     }
 
     // optional .floyd.CmdRequest.Kv kv = 2;
-    if (has_kv()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->kv());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.kv_);
     }
 
     // optional .floyd.CmdRequest.User user = 3;
-    if (has_user()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->user());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.user_);
     }
 
     // optional .floyd.CmdRequest.RequestVote request_vote = 4;
-    if (has_request_vote()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->request_vote());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.request_vote_);
     }
 
     // optional .floyd.CmdRequest.AppendEntries append_entries = 5;
-    if (has_append_entries()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->append_entries());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.append_entries_);
     }
 
     // optional .floyd.CmdRequest.ServerStatus server_status = 6;
-    if (has_server_status()) {
+    if (cached_has_bits & 0x00000020u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->server_status());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.server_status_);
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional .floyd.CmdRequest.WriteBatch write_batch = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.write_batch_);
+    }
+
+    // optional .floyd.CmdRequest.InstallSnapshot install_snapshot = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.install_snapshot_);
+    }
 
-void CmdRequest::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdRequest* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdRequest*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdRequest::MergeFrom(const CmdRequest& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdRequest::GetClassData() const { return &_class_data_; }
+
+
+void CmdRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdRequest*>(&to_msg);
+  auto& from = static_cast<const CmdRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.forward_cmds_.MergeFrom(from._impl_.forward_cmds_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_command(from._internal_command());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_kv()->::floyd::CmdRequest_Kv::MergeFrom(
+          from._internal_kv());
     }
-    if (from.has_kv()) {
-      mutable_kv()->::floyd::CmdRequest_Kv::MergeFrom(from.kv());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_user()->::floyd::CmdRequest_User::MergeFrom(
+          from._internal_user());
     }
-    if (from.has_user()) {
-      mutable_user()->::floyd::CmdRequest_User::MergeFrom(from.user());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_request_vote()->::floyd::CmdRequest_RequestVote::MergeFrom(
+          from._internal_request_vote());
     }
-    if (from.has_request_vote()) {
-      mutable_request_vote()->::floyd::CmdRequest_RequestVote::MergeFrom(from.request_vote());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_append_entries()->::floyd::CmdRequest_AppendEntries::MergeFrom(
+          from._internal_append_entries());
     }
-    if (from.has_append_entries()) {
-      mutable_append_entries()->::floyd::CmdRequest_AppendEntries::MergeFrom(from.append_entries());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_server_status()->::floyd::CmdRequest_ServerStatus::MergeFrom(
+          from._internal_server_status());
     }
-    if (from.has_server_status()) {
-      mutable_server_status()->::floyd::CmdRequest_ServerStatus::MergeFrom(from.server_status());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_write_batch()->::floyd::CmdRequest_WriteBatch::MergeFrom(
+          from._internal_write_batch());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_install_snapshot()->::floyd::CmdRequest_InstallSnapshot::MergeFrom(
+          from._internal_install_snapshot());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdRequest::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdRequest::CopyFrom(const CmdRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdRequest::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  if (has_kv()) {
-    if (!this->kv().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.forward_cmds_))
+    return false;
+  if (_internal_has_kv()) {
+    if (!_impl_.kv_->IsInitialized()) return false;
+  }
+  if (_internal_has_user()) {
+    if (!_impl_.user_->IsInitialized()) return false;
+  }
+  if (_internal_has_request_vote()) {
+    if (!_impl_.request_vote_->IsInitialized()) return false;
   }
-  if (has_user()) {
-    if (!this->user().IsInitialized()) return false;
+  if (_internal_has_append_entries()) {
+    if (!_impl_.append_entries_->IsInitialized()) return false;
   }
-  if (has_request_vote()) {
-    if (!this->request_vote().IsInitialized()) return false;
+  if (_internal_has_server_status()) {
+    if (!_impl_.server_status_->IsInitialized()) return false;
   }
-  if (has_append_entries()) {
-    if (!this->append_entries().IsInitialized()) return false;
+  if (_internal_has_write_batch()) {
+    if (!_impl_.write_batch_->IsInitialized()) return false;
   }
-  if (has_server_status()) {
-    if (!this->server_status().IsInitialized()) return false;
+  if (_internal_has_install_snapshot()) {
+    if (!_impl_.install_snapshot_->IsInitialized()) return false;
   }
   return true;
 }
 
-void CmdRequest::Swap(CmdRequest* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(kv_, other->kv_);
-    std::swap(user_, other->user_);
-    std::swap(request_vote_, other->request_vote_);
-    std::swap(append_entries_, other->append_entries_);
-    std::swap(server_status_, other->server_status_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdRequest::InternalSwap(CmdRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.forward_cmds_.InternalSwap(&other->_impl_.forward_cmds_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.command_, lhs_arena,
+      &other->_impl_.command_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdRequest, _impl_.type_)
+      + sizeof(CmdRequest::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(CmdRequest, _impl_.kv_)>(
+          reinterpret_cast<char*>(&_impl_.kv_),
+          reinterpret_cast<char*>(&other->_impl_.kv_));
 }
 
-::google::protobuf::Metadata CmdRequest::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdRequest_descriptor_;
-  metadata.reflection = CmdRequest_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[11]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int CmdResponse_Kv::kValueFieldNumber;
-#endif  // !_MSC_VER
-
-CmdResponse_Kv::CmdResponse_Kv()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CmdResponse_Kv::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_Kv>()._impl_._has_bits_);
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-void CmdResponse_Kv::InitAsDefaultInstance() {
+CmdResponse_Kv::CmdResponse_Kv(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdResponse.Kv)
 }
-
 CmdResponse_Kv::CmdResponse_Kv(const CmdResponse_Kv& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdResponse_Kv::SharedCtor() {
-  _cached_size_ = 0;
-  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_Kv* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdResponse.Kv)
+}
+
+inline void CmdResponse_Kv::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CmdResponse_Kv::~CmdResponse_Kv() {
+  // @@protoc_insertion_point(destructor:floyd.CmdResponse.Kv)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdResponse_Kv::SharedDtor() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
-  }
-  if (this != default_instance_) {
-  }
+inline void CmdResponse_Kv::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
 }
 
 void CmdResponse_Kv::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_Kv::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_Kv_descriptor_;
-}
-
-const CmdResponse_Kv& CmdResponse_Kv::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
-}
-
-CmdResponse_Kv* CmdResponse_Kv::default_instance_ = NULL;
-
-CmdResponse_Kv* CmdResponse_Kv::New() const {
-  return new CmdResponse_Kv;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdResponse_Kv::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_value()) {
-      if (value_ != &::google::protobuf::internal::kEmptyString) {
-        value_->clear();
-      }
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdResponse_Kv::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdResponse.Kv)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.value_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_Kv::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional bytes value = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_value()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdResponse_Kv::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional bytes value = 1;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      1, this->value(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* CmdResponse_Kv::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_Kv::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdResponse.Kv)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional bytes value = 1;
-  if (has_value()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->value(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_value(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdResponse.Kv)
   return target;
 }
 
-int CmdResponse_Kv::ByteSize() const {
-  int total_size = 0;
+size_t CmdResponse_Kv::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdResponse.Kv)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional bytes value = 1;
-    if (has_value()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->value());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  // optional bytes value = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void CmdResponse_Kv::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_Kv* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Kv*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_Kv::MergeFrom(const CmdResponse_Kv& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_value()) {
-      set_value(from.value());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_Kv::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_Kv::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_Kv::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_Kv::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_Kv*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_Kv&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdResponse.Kv)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void CmdResponse_Kv::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_has_value()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdResponse_Kv::CopyFrom(const CmdResponse_Kv& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdResponse.Kv)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdResponse_Kv::IsInitialized() const {
-
   return true;
 }
 
-void CmdResponse_Kv::Swap(CmdResponse_Kv* other) {
-  if (other != this) {
-    std::swap(value_, other->value_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdResponse_Kv::InternalSwap(CmdResponse_Kv* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata CmdResponse_Kv::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_Kv_descriptor_;
-  metadata.reflection = CmdResponse_Kv_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_Kv::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[12]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdResponse_Kvs::kKvFieldNumber;
-#endif  // !_MSC_VER
-
-CmdResponse_Kvs::CmdResponse_Kvs()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CmdResponse_Kvs::_Internal {
+ public:
+};
 
-void CmdResponse_Kvs::InitAsDefaultInstance() {
+CmdResponse_Kvs::CmdResponse_Kvs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdResponse.Kvs)
 }
-
 CmdResponse_Kvs::CmdResponse_Kvs(const CmdResponse_Kvs& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdResponse_Kvs::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_Kvs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kv_){from._impl_.kv_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdResponse.Kvs)
+}
+
+inline void CmdResponse_Kvs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.kv_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 CmdResponse_Kvs::~CmdResponse_Kvs() {
+  // @@protoc_insertion_point(destructor:floyd.CmdResponse.Kvs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdResponse_Kvs::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void CmdResponse_Kvs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.kv_.~RepeatedPtrField();
 }
 
 void CmdResponse_Kvs::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_Kvs::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_Kvs_descriptor_;
-}
-
-const CmdResponse_Kvs& CmdResponse_Kvs::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
-}
-
-CmdResponse_Kvs* CmdResponse_Kvs::default_instance_ = NULL;
-
-CmdResponse_Kvs* CmdResponse_Kvs::New() const {
-  return new CmdResponse_Kvs;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdResponse_Kvs::Clear() {
-  kv_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
+// @@protoc_insertion_point(message_clear_start:floyd.CmdResponse.Kvs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-bool CmdResponse_Kvs::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .floyd.CmdResponse.Kv kv = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_kv:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_kv()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_kv;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
+  _impl_.kv_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CmdResponse_Kvs::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // repeated .floyd.CmdResponse.Kv kv = 1;
-  for (int i = 0; i < this->kv_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->kv(i), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
+const char* CmdResponse_Kvs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .floyd.CmdResponse.Kv kv = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_kv(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_Kvs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdResponse.Kvs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-::google::protobuf::uint8* CmdResponse_Kvs::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
   // repeated .floyd.CmdResponse.Kv kv = 1;
-  for (int i = 0; i < this->kv_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->kv(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_kv_size()); i < n; i++) {
+    const auto& repfield = this->_internal_kv(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdResponse.Kvs)
   return target;
 }
 
-int CmdResponse_Kvs::ByteSize() const {
-  int total_size = 0;
+size_t CmdResponse_Kvs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdResponse.Kvs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .floyd.CmdResponse.Kv kv = 1;
-  total_size += 1 * this->kv_size();
-  for (int i = 0; i < this->kv_size(); i++) {
+  total_size += 1UL * this->_internal_kv_size();
+  for (const auto& msg : this->_impl_.kv_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->kv(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_Kvs::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_Kvs* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_Kvs*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_Kvs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_Kvs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_Kvs::GetClassData() const { return &_class_data_; }
 
-void CmdResponse_Kvs::MergeFrom(const CmdResponse_Kvs& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  kv_.MergeFrom(from.kv_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
 
-void CmdResponse_Kvs::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void CmdResponse_Kvs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_Kvs*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_Kvs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdResponse.Kvs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.kv_.MergeFrom(from._impl_.kv_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdResponse_Kvs::CopyFrom(const CmdResponse_Kvs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdResponse.Kvs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdResponse_Kvs::IsInitialized() const {
-
   return true;
 }
 
-void CmdResponse_Kvs::Swap(CmdResponse_Kvs* other) {
-  if (other != this) {
-    kv_.Swap(&other->kv_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdResponse_Kvs::InternalSwap(CmdResponse_Kvs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.kv_.InternalSwap(&other->_impl_.kv_);
 }
 
-::google::protobuf::Metadata CmdResponse_Kvs::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_Kvs_descriptor_;
-  metadata.reflection = CmdResponse_Kvs_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_Kvs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[13]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdResponse_RequestVoteResponse::kTermFieldNumber;
-const int CmdResponse_RequestVoteResponse::kVoteGrantedFieldNumber;
-#endif  // !_MSC_VER
-
-CmdResponse_RequestVoteResponse::CmdResponse_RequestVoteResponse()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CmdResponse_RequestVoteResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_RequestVoteResponse>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_vote_granted(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void CmdResponse_RequestVoteResponse::InitAsDefaultInstance() {
+CmdResponse_RequestVoteResponse::CmdResponse_RequestVoteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdResponse.RequestVoteResponse)
 }
-
 CmdResponse_RequestVoteResponse::CmdResponse_RequestVoteResponse(const CmdResponse_RequestVoteResponse& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdResponse_RequestVoteResponse::SharedCtor() {
-  _cached_size_ = 0;
-  term_ = GOOGLE_ULONGLONG(0);
-  vote_granted_ = false;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_RequestVoteResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.vote_granted_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.vote_granted_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.vote_granted_));
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdResponse.RequestVoteResponse)
+}
+
+inline void CmdResponse_RequestVoteResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){uint64_t{0u}}
+    , decltype(_impl_.vote_granted_){false}
+  };
 }
 
 CmdResponse_RequestVoteResponse::~CmdResponse_RequestVoteResponse() {
+  // @@protoc_insertion_point(destructor:floyd.CmdResponse.RequestVoteResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdResponse_RequestVoteResponse::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void CmdResponse_RequestVoteResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void CmdResponse_RequestVoteResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_RequestVoteResponse::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_RequestVoteResponse_descriptor_;
-}
-
-const CmdResponse_RequestVoteResponse& CmdResponse_RequestVoteResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
-}
-
-CmdResponse_RequestVoteResponse* CmdResponse_RequestVoteResponse::default_instance_ = NULL;
-
-CmdResponse_RequestVoteResponse* CmdResponse_RequestVoteResponse::New() const {
-  return new CmdResponse_RequestVoteResponse;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdResponse_RequestVoteResponse::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    term_ = GOOGLE_ULONGLONG(0);
-    vote_granted_ = false;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdResponse_RequestVoteResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdResponse.RequestVoteResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.vote_granted_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.vote_granted_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_RequestVoteResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint64 term = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &term_)));
-          set_has_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_vote_granted;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required bool vote_granted = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_vote_granted:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &vote_granted_)));
-          set_has_vote_granted();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdResponse_RequestVoteResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_vote_granted(&has_bits);
+          _impl_.vote_granted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_RequestVoteResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdResponse.RequestVoteResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint64 term = 1;
-  if (has_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->term(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_term(), target);
   }
 
   // required bool vote_granted = 2;
-  if (has_vote_granted()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->vote_granted(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_vote_granted(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdResponse.RequestVoteResponse)
+  return target;
 }
 
-::google::protobuf::uint8* CmdResponse_RequestVoteResponse::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint64 term = 1;
-  if (has_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->term(), target);
-  }
+size_t CmdResponse_RequestVoteResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.CmdResponse.RequestVoteResponse)
+  size_t total_size = 0;
 
-  // required bool vote_granted = 2;
-  if (has_vote_granted()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->vote_granted(), target);
+  if (_internal_has_term()) {
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_vote_granted()) {
+    // required bool vote_granted = 2;
+    total_size += 1 + 1;
   }
-  return target;
-}
 
-int CmdResponse_RequestVoteResponse::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t CmdResponse_RequestVoteResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdResponse.RequestVoteResponse)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required uint64 term = 1;
-    if (has_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->term());
-    }
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
 
     // required bool vote_granted = 2;
-    if (has_vote_granted()) {
-      total_size += 1 + 1;
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    total_size += 1 + 1;
 
-void CmdResponse_RequestVoteResponse::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_RequestVoteResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_RequestVoteResponse*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_RequestVoteResponse::MergeFrom(const CmdResponse_RequestVoteResponse& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_term()) {
-      set_term(from.term());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_RequestVoteResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_RequestVoteResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_RequestVoteResponse::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_RequestVoteResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_RequestVoteResponse*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_RequestVoteResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdResponse.RequestVoteResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.term_ = from._impl_.term_;
     }
-    if (from.has_vote_granted()) {
-      set_vote_granted(from.vote_granted());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.vote_granted_ = from._impl_.vote_granted_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdResponse_RequestVoteResponse::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdResponse_RequestVoteResponse::CopyFrom(const CmdResponse_RequestVoteResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdResponse.RequestVoteResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdResponse_RequestVoteResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdResponse_RequestVoteResponse::Swap(CmdResponse_RequestVoteResponse* other) {
-  if (other != this) {
-    std::swap(term_, other->term_);
-    std::swap(vote_granted_, other->vote_granted_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdResponse_RequestVoteResponse::InternalSwap(CmdResponse_RequestVoteResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_RequestVoteResponse, _impl_.vote_granted_)
+      + sizeof(CmdResponse_RequestVoteResponse::_impl_.vote_granted_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_RequestVoteResponse, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::google::protobuf::Metadata CmdResponse_RequestVoteResponse::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_RequestVoteResponse_descriptor_;
-  metadata.reflection = CmdResponse_RequestVoteResponse_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_RequestVoteResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[14]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdResponse_AppendEntriesResponse::kTermFieldNumber;
-const int CmdResponse_AppendEntriesResponse::kSuccessFieldNumber;
-const int CmdResponse_AppendEntriesResponse::kLastLogIndexFieldNumber;
-#endif  // !_MSC_VER
-
-CmdResponse_AppendEntriesResponse::CmdResponse_AppendEntriesResponse()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CmdResponse_AppendEntriesResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_AppendEntriesResponse>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_success(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_last_log_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000005) ^ 0x00000005) != 0;
+  }
+};
 
-void CmdResponse_AppendEntriesResponse::InitAsDefaultInstance() {
+CmdResponse_AppendEntriesResponse::CmdResponse_AppendEntriesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdResponse.AppendEntriesResponse)
 }
-
 CmdResponse_AppendEntriesResponse::CmdResponse_AppendEntriesResponse(const CmdResponse_AppendEntriesResponse& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdResponse_AppendEntriesResponse::SharedCtor() {
-  _cached_size_ = 0;
-  term_ = GOOGLE_ULONGLONG(0);
-  success_ = false;
-  last_log_index_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_AppendEntriesResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.last_log_index_){}
+    , decltype(_impl_.success_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.success_));
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdResponse.AppendEntriesResponse)
+}
+
+inline void CmdResponse_AppendEntriesResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){uint64_t{0u}}
+    , decltype(_impl_.last_log_index_){uint64_t{0u}}
+    , decltype(_impl_.success_){false}
+  };
 }
 
 CmdResponse_AppendEntriesResponse::~CmdResponse_AppendEntriesResponse() {
+  // @@protoc_insertion_point(destructor:floyd.CmdResponse.AppendEntriesResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdResponse_AppendEntriesResponse::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void CmdResponse_AppendEntriesResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void CmdResponse_AppendEntriesResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_AppendEntriesResponse::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_AppendEntriesResponse_descriptor_;
-}
-
-const CmdResponse_AppendEntriesResponse& CmdResponse_AppendEntriesResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
-}
-
-CmdResponse_AppendEntriesResponse* CmdResponse_AppendEntriesResponse::default_instance_ = NULL;
-
-CmdResponse_AppendEntriesResponse* CmdResponse_AppendEntriesResponse::New() const {
-  return new CmdResponse_AppendEntriesResponse;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdResponse_AppendEntriesResponse::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    term_ = GOOGLE_ULONGLONG(0);
-    success_ = false;
-    last_log_index_ = GOOGLE_ULONGLONG(0);
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdResponse_AppendEntriesResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdResponse.AppendEntriesResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.success_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.success_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_AppendEntriesResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint64 term = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &term_)));
-          set_has_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_success;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required bool success = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_success:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-          set_has_success();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_last_log_index;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_success(&has_bits);
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint64 last_log_index = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_last_log_index:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &last_log_index_)));
-          set_has_last_log_index();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CmdResponse_AppendEntriesResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_last_log_index(&has_bits);
+          _impl_.last_log_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_AppendEntriesResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdResponse.AppendEntriesResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint64 term = 1;
-  if (has_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->term(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_term(), target);
   }
 
   // required bool success = 2;
-  if (has_success()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->success(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
   }
 
   // optional uint64 last_log_index = 3;
-  if (has_last_log_index()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->last_log_index(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_last_log_index(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdResponse.AppendEntriesResponse)
+  return target;
 }
 
-::google::protobuf::uint8* CmdResponse_AppendEntriesResponse::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint64 term = 1;
-  if (has_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->term(), target);
-  }
+size_t CmdResponse_AppendEntriesResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.CmdResponse.AppendEntriesResponse)
+  size_t total_size = 0;
 
-  // required bool success = 2;
-  if (has_success()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->success(), target);
+  if (_internal_has_term()) {
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
   }
 
-  // optional uint64 last_log_index = 3;
-  if (has_last_log_index()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->last_log_index(), target);
+  if (_internal_has_success()) {
+    // required bool success = 2;
+    total_size += 1 + 1;
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t CmdResponse_AppendEntriesResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdResponse.AppendEntriesResponse)
+  size_t total_size = 0;
 
-int CmdResponse_AppendEntriesResponse::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000005) ^ 0x00000005) == 0) {  // All required fields are present.
     // required uint64 term = 1;
-    if (has_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->term());
-    }
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
 
     // required bool success = 2;
-    if (has_success()) {
-      total_size += 1 + 1;
-    }
+    total_size += 1 + 1;
 
-    // optional uint64 last_log_index = 3;
-    if (has_last_log_index()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->last_log_index());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void CmdResponse_AppendEntriesResponse::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_AppendEntriesResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_AppendEntriesResponse*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // optional uint64 last_log_index = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_log_index());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_AppendEntriesResponse::MergeFrom(const CmdResponse_AppendEntriesResponse& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_term()) {
-      set_term(from.term());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_AppendEntriesResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_AppendEntriesResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_AppendEntriesResponse::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_AppendEntriesResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_AppendEntriesResponse*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_AppendEntriesResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdResponse.AppendEntriesResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.term_ = from._impl_.term_;
     }
-    if (from.has_success()) {
-      set_success(from.success());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.last_log_index_ = from._impl_.last_log_index_;
     }
-    if (from.has_last_log_index()) {
-      set_last_log_index(from.last_log_index());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.success_ = from._impl_.success_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdResponse_AppendEntriesResponse::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdResponse_AppendEntriesResponse::CopyFrom(const CmdResponse_AppendEntriesResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdResponse.AppendEntriesResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdResponse_AppendEntriesResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdResponse_AppendEntriesResponse::Swap(CmdResponse_AppendEntriesResponse* other) {
-  if (other != this) {
-    std::swap(term_, other->term_);
-    std::swap(success_, other->success_);
-    std::swap(last_log_index_, other->last_log_index_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdResponse_AppendEntriesResponse::InternalSwap(CmdResponse_AppendEntriesResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_AppendEntriesResponse, _impl_.success_)
+      + sizeof(CmdResponse_AppendEntriesResponse::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_AppendEntriesResponse, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::google::protobuf::Metadata CmdResponse_AppendEntriesResponse::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_AppendEntriesResponse_descriptor_;
-  metadata.reflection = CmdResponse_AppendEntriesResponse_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_AppendEntriesResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[15]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#ifndef _MSC_VER
-const int CmdResponse_ServerStatus::kTermFieldNumber;
-const int CmdResponse_ServerStatus::kCommitIndexFieldNumber;
-const int CmdResponse_ServerStatus::kRoleFieldNumber;
-const int CmdResponse_ServerStatus::kLeaderIpFieldNumber;
-const int CmdResponse_ServerStatus::kLeaderPortFieldNumber;
-const int CmdResponse_ServerStatus::kVotedForIpFieldNumber;
-const int CmdResponse_ServerStatus::kVotedForPortFieldNumber;
-const int CmdResponse_ServerStatus::kLastLogTermFieldNumber;
-const int CmdResponse_ServerStatus::kLastLogIndexFieldNumber;
-const int CmdResponse_ServerStatus::kLastAppliedFieldNumber;
-#endif  // !_MSC_VER
-
-CmdResponse_ServerStatus::CmdResponse_ServerStatus()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CmdResponse_ServerStatus::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_ServerStatus>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_commit_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_role(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_leader_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_leader_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_voted_for_ip(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_voted_for_port(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_last_log_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_last_log_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_last_applied(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000019) ^ 0x00000019) != 0;
+  }
+};
 
-void CmdResponse_ServerStatus::InitAsDefaultInstance() {
+CmdResponse_ServerStatus::CmdResponse_ServerStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdResponse.ServerStatus)
 }
-
 CmdResponse_ServerStatus::CmdResponse_ServerStatus(const CmdResponse_ServerStatus& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CmdResponse_ServerStatus::SharedCtor() {
-  _cached_size_ = 0;
-  term_ = GOOGLE_ULONGLONG(0);
-  commit_index_ = GOOGLE_ULONGLONG(0);
-  role_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  leader_ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  leader_port_ = 0;
-  voted_for_ip_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  voted_for_port_ = 0;
-  last_log_term_ = GOOGLE_ULONGLONG(0);
-  last_log_index_ = GOOGLE_ULONGLONG(0);
-  last_applied_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_ServerStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.role_){}
+    , decltype(_impl_.leader_ip_){}
+    , decltype(_impl_.voted_for_ip_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.commit_index_){}
+    , decltype(_impl_.leader_port_){}
+    , decltype(_impl_.voted_for_port_){}
+    , decltype(_impl_.last_log_term_){}
+    , decltype(_impl_.last_log_index_){}
+    , decltype(_impl_.last_applied_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.role_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.role_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_role()) {
+    _this->_impl_.role_.Set(from._internal_role(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.leader_ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_leader_ip()) {
+    _this->_impl_.leader_ip_.Set(from._internal_leader_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.voted_for_ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.voted_for_ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_voted_for_ip()) {
+    _this->_impl_.voted_for_ip_.Set(from._internal_voted_for_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.last_applied_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.last_applied_));
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdResponse.ServerStatus)
+}
+
+inline void CmdResponse_ServerStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.role_){}
+    , decltype(_impl_.leader_ip_){}
+    , decltype(_impl_.voted_for_ip_){}
+    , decltype(_impl_.term_){uint64_t{0u}}
+    , decltype(_impl_.commit_index_){uint64_t{0u}}
+    , decltype(_impl_.leader_port_){0}
+    , decltype(_impl_.voted_for_port_){0}
+    , decltype(_impl_.last_log_term_){uint64_t{0u}}
+    , decltype(_impl_.last_log_index_){uint64_t{0u}}
+    , decltype(_impl_.last_applied_){uint64_t{0u}}
+  };
+  _impl_.role_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.role_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.leader_ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leader_ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.voted_for_ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.voted_for_ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CmdResponse_ServerStatus::~CmdResponse_ServerStatus() {
+  // @@protoc_insertion_point(destructor:floyd.CmdResponse.ServerStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CmdResponse_ServerStatus::SharedDtor() {
-  if (role_ != &::google::protobuf::internal::kEmptyString) {
-    delete role_;
-  }
-  if (leader_ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete leader_ip_;
-  }
-  if (voted_for_ip_ != &::google::protobuf::internal::kEmptyString) {
-    delete voted_for_ip_;
-  }
-  if (this != default_instance_) {
-  }
+inline void CmdResponse_ServerStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.role_.Destroy();
+  _impl_.leader_ip_.Destroy();
+  _impl_.voted_for_ip_.Destroy();
 }
 
 void CmdResponse_ServerStatus::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CmdResponse_ServerStatus::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_ServerStatus_descriptor_;
-}
-
-const CmdResponse_ServerStatus& CmdResponse_ServerStatus::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
-}
-
-CmdResponse_ServerStatus* CmdResponse_ServerStatus::default_instance_ = NULL;
-
-CmdResponse_ServerStatus* CmdResponse_ServerStatus::New() const {
-  return new CmdResponse_ServerStatus;
+  _impl_._cached_size_.Set(size);
 }
 
 void CmdResponse_ServerStatus::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    term_ = GOOGLE_ULONGLONG(0);
-    commit_index_ = GOOGLE_ULONGLONG(0);
-    if (has_role()) {
-      if (role_ != &::google::protobuf::internal::kEmptyString) {
-        role_->clear();
-      }
-    }
-    if (has_leader_ip()) {
-      if (leader_ip_ != &::google::protobuf::internal::kEmptyString) {
-        leader_ip_->clear();
-      }
-    }
-    leader_port_ = 0;
-    if (has_voted_for_ip()) {
-      if (voted_for_ip_ != &::google::protobuf::internal::kEmptyString) {
-        voted_for_ip_->clear();
-      }
-    }
-    voted_for_port_ = 0;
-    last_log_term_ = GOOGLE_ULONGLONG(0);
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    last_log_index_ = GOOGLE_ULONGLONG(0);
-    last_applied_ = GOOGLE_ULONGLONG(0);
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CmdResponse_ServerStatus::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint64 term = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &term_)));
-          set_has_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_commit_index;
-        break;
-      }
-
-      // required uint64 commit_index = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_commit_index:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &commit_index_)));
-          set_has_commit_index();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_role;
-        break;
-      }
-
-      // required bytes role = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_role:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_role()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_leader_ip;
-        break;
-      }
-
-      // optional bytes leader_ip = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_leader_ip:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_leader_ip()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(40)) goto parse_leader_port;
-        break;
-      }
-
-      // optional int32 leader_port = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_leader_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &leader_port_)));
-          set_has_leader_port();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_voted_for_ip;
-        break;
-      }
-
-      // optional bytes voted_for_ip = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_voted_for_ip:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_voted_for_ip()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(56)) goto parse_voted_for_port;
-        break;
-      }
-
-      // optional int32 voted_for_port = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_voted_for_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &voted_for_port_)));
-          set_has_voted_for_port();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(64)) goto parse_last_log_term;
-        break;
-      }
-
-      // optional uint64 last_log_term = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_last_log_term:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &last_log_term_)));
-          set_has_last_log_term();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(72)) goto parse_last_log_index;
-        break;
-      }
-
-      // optional uint64 last_log_index = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_last_log_index:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &last_log_index_)));
-          set_has_last_log_index();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(80)) goto parse_last_applied;
-        break;
-      }
+// @@protoc_insertion_point(message_clear_start:floyd.CmdResponse.ServerStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-      // optional uint64 last_applied = 10;
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_last_applied:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &last_applied_)));
-          set_has_last_applied();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.role_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.leader_ip_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.voted_for_ip_.ClearNonDefaultToEmpty();
     }
   }
-  return true;
-#undef DO_
-}
-
-void CmdResponse_ServerStatus::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required uint64 term = 1;
-  if (has_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->term(), output);
-  }
-
-  // required uint64 commit_index = 2;
-  if (has_commit_index()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->commit_index(), output);
-  }
-
-  // required bytes role = 3;
-  if (has_role()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      3, this->role(), output);
-  }
-
-  // optional bytes leader_ip = 4;
-  if (has_leader_ip()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      4, this->leader_ip(), output);
-  }
-
-  // optional int32 leader_port = 5;
-  if (has_leader_port()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->leader_port(), output);
-  }
-
-  // optional bytes voted_for_ip = 6;
-  if (has_voted_for_ip()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      6, this->voted_for_ip(), output);
-  }
-
-  // optional int32 voted_for_port = 7;
-  if (has_voted_for_port()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->voted_for_port(), output);
-  }
-
-  // optional uint64 last_log_term = 8;
-  if (has_last_log_term()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(8, this->last_log_term(), output);
-  }
-
-  // optional uint64 last_log_index = 9;
-  if (has_last_log_index()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(9, this->last_log_index(), output);
-  }
-
-  // optional uint64 last_applied = 10;
-  if (has_last_applied()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(10, this->last_applied(), output);
+  if (cached_has_bits & 0x000000f8u) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.last_log_term_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.last_log_term_));
   }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.last_log_index_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.last_applied_) -
+        reinterpret_cast<char*>(&_impl_.last_log_index_)) + sizeof(_impl_.last_applied_));
   }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-::google::protobuf::uint8* CmdResponse_ServerStatus::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+const char* CmdResponse_ServerStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 commit_index = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_commit_index(&has_bits);
+          _impl_.commit_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes role = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_role();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes leader_ip = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_leader_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 leader_port = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_leader_port(&has_bits);
+          _impl_.leader_port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes voted_for_ip = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_voted_for_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 voted_for_port = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_voted_for_port(&has_bits);
+          _impl_.voted_for_port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 last_log_term = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_last_log_term(&has_bits);
+          _impl_.last_log_term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 last_log_index = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_last_log_index(&has_bits);
+          _impl_.last_log_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 last_applied = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_last_applied(&has_bits);
+          _impl_.last_applied_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_ServerStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdResponse.ServerStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint64 term = 1;
-  if (has_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->term(), target);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_term(), target);
   }
 
   // required uint64 commit_index = 2;
-  if (has_commit_index()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->commit_index(), target);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_commit_index(), target);
   }
 
   // required bytes role = 3;
-  if (has_role()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->role(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_role(), target);
   }
 
   // optional bytes leader_ip = 4;
-  if (has_leader_ip()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->leader_ip(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_leader_ip(), target);
   }
 
   // optional int32 leader_port = 5;
-  if (has_leader_port()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->leader_port(), target);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_leader_port(), target);
   }
 
   // optional bytes voted_for_ip = 6;
-  if (has_voted_for_ip()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        6, this->voted_for_ip(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_voted_for_ip(), target);
   }
 
   // optional int32 voted_for_port = 7;
-  if (has_voted_for_port()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->voted_for_port(), target);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_voted_for_port(), target);
   }
 
   // optional uint64 last_log_term = 8;
-  if (has_last_log_term()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(8, this->last_log_term(), target);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_last_log_term(), target);
   }
 
   // optional uint64 last_log_index = 9;
-  if (has_last_log_index()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(9, this->last_log_index(), target);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_last_log_index(), target);
   }
 
   // optional uint64 last_applied = 10;
-  if (has_last_applied()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(10, this->last_applied(), target);
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_last_applied(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdResponse.ServerStatus)
   return target;
 }
 
-int CmdResponse_ServerStatus::ByteSize() const {
-  int total_size = 0;
+size_t CmdResponse_ServerStatus::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.CmdResponse.ServerStatus)
+  size_t total_size = 0;
+
+  if (_internal_has_role()) {
+    // required bytes role = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_role());
+  }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (_internal_has_term()) {
     // required uint64 term = 1;
-    if (has_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->term());
-    }
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
+  }
 
+  if (_internal_has_commit_index()) {
     // required uint64 commit_index = 2;
-    if (has_commit_index()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->commit_index());
-    }
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_commit_index());
+  }
+
+  return total_size;
+}
+size_t CmdResponse_ServerStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdResponse.ServerStatus)
+  size_t total_size = 0;
 
+  if (((_impl_._has_bits_[0] & 0x00000019) ^ 0x00000019) == 0) {  // All required fields are present.
     // required bytes role = 3;
-    if (has_role()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->role());
-    }
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_role());
 
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
+
+    // required uint64 commit_index = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_commit_index());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
     // optional bytes leader_ip = 4;
-    if (has_leader_ip()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->leader_ip());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_leader_ip());
     }
 
-    // optional int32 leader_port = 5;
-    if (has_leader_port()) {
+    // optional bytes voted_for_ip = 6;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->leader_port());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_voted_for_ip());
     }
 
-    // optional bytes voted_for_ip = 6;
-    if (has_voted_for_ip()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->voted_for_ip());
+  }
+  if (cached_has_bits & 0x000000e0u) {
+    // optional int32 leader_port = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leader_port());
     }
 
     // optional int32 voted_for_port = 7;
-    if (has_voted_for_port()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->voted_for_port());
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_voted_for_port());
     }
 
     // optional uint64 last_log_term = 8;
-    if (has_last_log_term()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->last_log_term());
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_log_term());
     }
 
   }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+  if (cached_has_bits & 0x00000300u) {
     // optional uint64 last_log_index = 9;
-    if (has_last_log_index()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->last_log_index());
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_log_index());
     }
 
     // optional uint64 last_applied = 10;
-    if (has_last_applied()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->last_applied());
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_last_applied());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse_ServerStatus::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse_ServerStatus* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse_ServerStatus*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_ServerStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_ServerStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_ServerStatus::GetClassData() const { return &_class_data_; }
+
 
-void CmdResponse_ServerStatus::MergeFrom(const CmdResponse_ServerStatus& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_term()) {
-      set_term(from.term());
+void CmdResponse_ServerStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_ServerStatus*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_ServerStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdResponse.ServerStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_role(from._internal_role());
     }
-    if (from.has_commit_index()) {
-      set_commit_index(from.commit_index());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_leader_ip(from._internal_leader_ip());
     }
-    if (from.has_role()) {
-      set_role(from.role());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_voted_for_ip(from._internal_voted_for_ip());
     }
-    if (from.has_leader_ip()) {
-      set_leader_ip(from.leader_ip());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.term_ = from._impl_.term_;
     }
-    if (from.has_leader_port()) {
-      set_leader_port(from.leader_port());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.commit_index_ = from._impl_.commit_index_;
     }
-    if (from.has_voted_for_ip()) {
-      set_voted_for_ip(from.voted_for_ip());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.leader_port_ = from._impl_.leader_port_;
     }
-    if (from.has_voted_for_port()) {
-      set_voted_for_port(from.voted_for_port());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.voted_for_port_ = from._impl_.voted_for_port_;
     }
-    if (from.has_last_log_term()) {
-      set_last_log_term(from.last_log_term());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.last_log_term_ = from._impl_.last_log_term_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_last_log_index()) {
-      set_last_log_index(from.last_log_index());
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.last_log_index_ = from._impl_.last_log_index_;
     }
-    if (from.has_last_applied()) {
-      set_last_applied(from.last_applied());
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.last_applied_ = from._impl_.last_applied_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdResponse_ServerStatus::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdResponse_ServerStatus::CopyFrom(const CmdResponse_ServerStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdResponse.ServerStatus)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdResponse_ServerStatus::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CmdResponse_ServerStatus::Swap(CmdResponse_ServerStatus* other) {
-  if (other != this) {
-    std::swap(term_, other->term_);
-    std::swap(commit_index_, other->commit_index_);
-    std::swap(role_, other->role_);
-    std::swap(leader_ip_, other->leader_ip_);
-    std::swap(leader_port_, other->leader_port_);
-    std::swap(voted_for_ip_, other->voted_for_ip_);
-    std::swap(voted_for_port_, other->voted_for_port_);
-    std::swap(last_log_term_, other->last_log_term_);
-    std::swap(last_log_index_, other->last_log_index_);
-    std::swap(last_applied_, other->last_applied_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdResponse_ServerStatus::InternalSwap(CmdResponse_ServerStatus* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.role_, lhs_arena,
+      &other->_impl_.role_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.leader_ip_, lhs_arena,
+      &other->_impl_.leader_ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.voted_for_ip_, lhs_arena,
+      &other->_impl_.voted_for_ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_ServerStatus, _impl_.last_applied_)
+      + sizeof(CmdResponse_ServerStatus::_impl_.last_applied_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_ServerStatus, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_ServerStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[16]);
 }
 
-::google::protobuf::Metadata CmdResponse_ServerStatus::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_ServerStatus_descriptor_;
-  metadata.reflection = CmdResponse_ServerStatus_reflection_;
-  return metadata;
+// ===================================================================
+
+class CmdResponse_ReadIndexResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_ReadIndexResponse>()._impl_._has_bits_);
+  static void set_has_read_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+CmdResponse_ReadIndexResponse::CmdResponse_ReadIndexResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdResponse.ReadIndexResponse)
+}
+CmdResponse_ReadIndexResponse::CmdResponse_ReadIndexResponse(const CmdResponse_ReadIndexResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_ReadIndexResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.read_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.read_index_ = from._impl_.read_index_;
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdResponse.ReadIndexResponse)
+}
+
+inline void CmdResponse_ReadIndexResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.read_index_){uint64_t{0u}}
+  };
+}
+
+CmdResponse_ReadIndexResponse::~CmdResponse_ReadIndexResponse() {
+  // @@protoc_insertion_point(destructor:floyd.CmdResponse.ReadIndexResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
+inline void CmdResponse_ReadIndexResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CmdResponse_ReadIndexResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CmdResponse_ReadIndexResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdResponse.ReadIndexResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.read_index_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse_ReadIndexResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 read_index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_read_index(&has_bits);
+          _impl_.read_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_ReadIndexResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdResponse.ReadIndexResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 read_index = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_read_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdResponse.ReadIndexResponse)
+  return target;
+}
 
-// -------------------------------------------------------------------
+size_t CmdResponse_ReadIndexResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdResponse.ReadIndexResponse)
+  size_t total_size = 0;
 
-#ifndef _MSC_VER
-const int CmdResponse::kTypeFieldNumber;
-const int CmdResponse::kCodeFieldNumber;
-const int CmdResponse::kMsgFieldNumber;
-const int CmdResponse::kKvFieldNumber;
-const int CmdResponse::kKvsFieldNumber;
-const int CmdResponse::kRequestVoteResFieldNumber;
-const int CmdResponse::kAppendEntriesResFieldNumber;
-const int CmdResponse::kServerStatusFieldNumber;
-#endif  // !_MSC_VER
+  // required uint64 read_index = 1;
+  if (_internal_has_read_index()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_read_index());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-CmdResponse::CmdResponse()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse::InitAsDefaultInstance() {
-  kv_ = const_cast< ::floyd::CmdResponse_Kv*>(&::floyd::CmdResponse_Kv::default_instance());
-  kvs_ = const_cast< ::floyd::CmdResponse_Kvs*>(&::floyd::CmdResponse_Kvs::default_instance());
-  request_vote_res_ = const_cast< ::floyd::CmdResponse_RequestVoteResponse*>(&::floyd::CmdResponse_RequestVoteResponse::default_instance());
-  append_entries_res_ = const_cast< ::floyd::CmdResponse_AppendEntriesResponse*>(&::floyd::CmdResponse_AppendEntriesResponse::default_instance());
-  server_status_ = const_cast< ::floyd::CmdResponse_ServerStatus*>(&::floyd::CmdResponse_ServerStatus::default_instance());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_ReadIndexResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_ReadIndexResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_ReadIndexResponse::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse_ReadIndexResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_ReadIndexResponse*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_ReadIndexResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdResponse.ReadIndexResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_read_index()) {
+    _this->_internal_set_read_index(from._internal_read_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-CmdResponse::CmdResponse(const CmdResponse& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
+void CmdResponse_ReadIndexResponse::CopyFrom(const CmdResponse_ReadIndexResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdResponse.ReadIndexResponse)
+  if (&from == this) return;
+  Clear();
   MergeFrom(from);
 }
 
-void CmdResponse::SharedCtor() {
-  _cached_size_ = 0;
-  type_ = 0;
-  code_ = 0;
-  msg_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  kv_ = NULL;
-  kvs_ = NULL;
-  request_vote_res_ = NULL;
-  append_entries_res_ = NULL;
-  server_status_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool CmdResponse_ReadIndexResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
 }
 
-CmdResponse::~CmdResponse() {
-  SharedDtor();
+void CmdResponse_ReadIndexResponse::InternalSwap(CmdResponse_ReadIndexResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.read_index_, other->_impl_.read_index_);
 }
 
-void CmdResponse::SharedDtor() {
-  if (msg_ != &::google::protobuf::internal::kEmptyString) {
-    delete msg_;
-  }
-  if (this != default_instance_) {
-    delete kv_;
-    delete kvs_;
-    delete request_vote_res_;
-    delete append_entries_res_;
-    delete server_status_;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_ReadIndexResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[17]);
+}
+
+// ===================================================================
+
+class CmdResponse_InstallSnapshotResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse_InstallSnapshotResponse>()._impl_._has_bits_);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_success(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+CmdResponse_InstallSnapshotResponse::CmdResponse_InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdResponse.InstallSnapshotResponse)
+}
+CmdResponse_InstallSnapshotResponse::CmdResponse_InstallSnapshotResponse(const CmdResponse_InstallSnapshotResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse_InstallSnapshotResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.success_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.success_));
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdResponse.InstallSnapshotResponse)
+}
+
+inline void CmdResponse_InstallSnapshotResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){uint64_t{0u}}
+    , decltype(_impl_.success_){false}
+  };
+}
+
+CmdResponse_InstallSnapshotResponse::~CmdResponse_InstallSnapshotResponse() {
+  // @@protoc_insertion_point(destructor:floyd.CmdResponse.InstallSnapshotResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-void CmdResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+inline void CmdResponse_InstallSnapshotResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
-const ::google::protobuf::Descriptor* CmdResponse::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CmdResponse_descriptor_;
+
+void CmdResponse_InstallSnapshotResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-const CmdResponse& CmdResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_floyd_2eproto();
-  return *default_instance_;
+void CmdResponse_InstallSnapshotResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdResponse.InstallSnapshotResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.term_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.success_) -
+        reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.success_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-CmdResponse* CmdResponse::default_instance_ = NULL;
+const char* CmdResponse_InstallSnapshotResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_term(&has_bits);
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool success = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_success(&has_bits);
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse_InstallSnapshotResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdResponse.InstallSnapshotResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 term = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_term(), target);
+  }
+
+  // required bool success = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
+  }
 
-CmdResponse* CmdResponse::New() const {
-  return new CmdResponse;
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdResponse.InstallSnapshotResponse)
+  return target;
 }
 
-void CmdResponse::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    type_ = 0;
-    code_ = 0;
-    if (has_msg()) {
-      if (msg_ != &::google::protobuf::internal::kEmptyString) {
-        msg_->clear();
-      }
-    }
-    if (has_kv()) {
-      if (kv_ != NULL) kv_->::floyd::CmdResponse_Kv::Clear();
-    }
-    if (has_kvs()) {
-      if (kvs_ != NULL) kvs_->::floyd::CmdResponse_Kvs::Clear();
-    }
-    if (has_request_vote_res()) {
-      if (request_vote_res_ != NULL) request_vote_res_->::floyd::CmdResponse_RequestVoteResponse::Clear();
-    }
-    if (has_append_entries_res()) {
-      if (append_entries_res_ != NULL) append_entries_res_->::floyd::CmdResponse_AppendEntriesResponse::Clear();
-    }
-    if (has_server_status()) {
-      if (server_status_ != NULL) server_status_->::floyd::CmdResponse_ServerStatus::Clear();
-    }
+size_t CmdResponse_InstallSnapshotResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:floyd.CmdResponse.InstallSnapshotResponse)
+  size_t total_size = 0;
+
+  if (_internal_has_term()) {
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
+  }
+
+  if (_internal_has_success()) {
+    // required bool success = 2;
+    total_size += 1 + 1;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+
+  return total_size;
 }
+size_t CmdResponse_InstallSnapshotResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdResponse.InstallSnapshotResponse)
+  size_t total_size = 0;
 
-bool CmdResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required .floyd.Type type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::floyd::Type_IsValid(value)) {
-            set_type(static_cast< ::floyd::Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(1, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_code;
-        break;
-      }
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 term = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_term());
 
-      // optional .floyd.StatusCode code = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_code:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::floyd::StatusCode_IsValid(value)) {
-            set_code(static_cast< ::floyd::StatusCode >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(2, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_msg;
-        break;
-      }
+    // required bool success = 2;
+    total_size += 1 + 1;
 
-      // optional bytes msg = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_msg:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_msg()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_kv;
-        break;
-      }
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-      // optional .floyd.CmdResponse.Kv kv = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_kv:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_kv()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_kvs;
-        break;
-      }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-      // optional .floyd.CmdResponse.Kvs kvs = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_kvs:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_kvs()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_request_vote_res;
-        break;
-      }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse_InstallSnapshotResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse_InstallSnapshotResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse_InstallSnapshotResponse::GetClassData() const { return &_class_data_; }
 
-      // optional .floyd.CmdResponse.RequestVoteResponse request_vote_res = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_request_vote_res:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_request_vote_res()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_append_entries_res;
-        break;
-      }
 
-      // optional .floyd.CmdResponse.AppendEntriesResponse append_entries_res = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_append_entries_res:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_append_entries_res()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(66)) goto parse_server_status;
-        break;
-      }
+void CmdResponse_InstallSnapshotResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse_InstallSnapshotResponse*>(&to_msg);
+  auto& from = static_cast<const CmdResponse_InstallSnapshotResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdResponse.InstallSnapshotResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // optional .floyd.CmdResponse.ServerStatus server_status = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_server_status:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_server_status()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.term_ = from._impl_.term_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.success_ = from._impl_.success_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CmdResponse_InstallSnapshotResponse::CopyFrom(const CmdResponse_InstallSnapshotResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdResponse.InstallSnapshotResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CmdResponse_InstallSnapshotResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
-#undef DO_
 }
 
-void CmdResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required .floyd.Type type = 1;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
-  }
+void CmdResponse_InstallSnapshotResponse::InternalSwap(CmdResponse_InstallSnapshotResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse_InstallSnapshotResponse, _impl_.success_)
+      + sizeof(CmdResponse_InstallSnapshotResponse::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse_InstallSnapshotResponse, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
 
-  // optional .floyd.StatusCode code = 2;
-  if (has_code()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->code(), output);
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse_InstallSnapshotResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[18]);
+}
 
-  // optional bytes msg = 3;
-  if (has_msg()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      3, this->msg(), output);
-  }
+// ===================================================================
 
-  // optional .floyd.CmdResponse.Kv kv = 4;
-  if (has_kv()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->kv(), output);
+class CmdResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CmdResponse>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
   }
-
-  // optional .floyd.CmdResponse.Kvs kvs = 5;
-  if (has_kvs()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->kvs(), output);
+  static void set_has_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
   }
-
-  // optional .floyd.CmdResponse.RequestVoteResponse request_vote_res = 6;
-  if (has_request_vote_res()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->request_vote_res(), output);
+  static void set_has_msg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-
-  // optional .floyd.CmdResponse.AppendEntriesResponse append_entries_res = 7;
-  if (has_append_entries_res()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->append_entries_res(), output);
+  static const ::floyd::CmdResponse_Kv& kv(const CmdResponse* msg);
+  static void set_has_kv(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-
-  // optional .floyd.CmdResponse.ServerStatus server_status = 8;
-  if (has_server_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->server_status(), output);
+  static const ::floyd::CmdResponse_Kvs& kvs(const CmdResponse* msg);
+  static void set_has_kvs(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::floyd::CmdResponse_RequestVoteResponse& request_vote_res(const CmdResponse* msg);
+  static void set_has_request_vote_res(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::floyd::CmdResponse_AppendEntriesResponse& append_entries_res(const CmdResponse* msg);
+  static void set_has_append_entries_res(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::floyd::CmdResponse_ServerStatus& server_status(const CmdResponse* msg);
+  static void set_has_server_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::floyd::CmdResponse_ReadIndexResponse& read_index_res(const CmdResponse* msg);
+  static void set_has_read_index_res(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::floyd::CmdResponse_InstallSnapshotResponse& install_snapshot_res(const CmdResponse* msg);
+  static void set_has_install_snapshot_res(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
   }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000100) ^ 0x00000100) != 0;
+  }
+};
+
+const ::floyd::CmdResponse_Kv&
+CmdResponse::_Internal::kv(const CmdResponse* msg) {
+  return *msg->_impl_.kv_;
+}
+const ::floyd::CmdResponse_Kvs&
+CmdResponse::_Internal::kvs(const CmdResponse* msg) {
+  return *msg->_impl_.kvs_;
+}
+const ::floyd::CmdResponse_RequestVoteResponse&
+CmdResponse::_Internal::request_vote_res(const CmdResponse* msg) {
+  return *msg->_impl_.request_vote_res_;
+}
+const ::floyd::CmdResponse_AppendEntriesResponse&
+CmdResponse::_Internal::append_entries_res(const CmdResponse* msg) {
+  return *msg->_impl_.append_entries_res_;
+}
+const ::floyd::CmdResponse_ServerStatus&
+CmdResponse::_Internal::server_status(const CmdResponse* msg) {
+  return *msg->_impl_.server_status_;
+}
+const ::floyd::CmdResponse_ReadIndexResponse&
+CmdResponse::_Internal::read_index_res(const CmdResponse* msg) {
+  return *msg->_impl_.read_index_res_;
+}
+const ::floyd::CmdResponse_InstallSnapshotResponse&
+CmdResponse::_Internal::install_snapshot_res(const CmdResponse* msg) {
+  return *msg->_impl_.install_snapshot_res_;
+}
+CmdResponse::CmdResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:floyd.CmdResponse)
+}
+CmdResponse::CmdResponse(const CmdResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CmdResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.forward_res_){from._impl_.forward_res_}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.kv_){nullptr}
+    , decltype(_impl_.kvs_){nullptr}
+    , decltype(_impl_.request_vote_res_){nullptr}
+    , decltype(_impl_.append_entries_res_){nullptr}
+    , decltype(_impl_.server_status_){nullptr}
+    , decltype(_impl_.read_index_res_){nullptr}
+    , decltype(_impl_.install_snapshot_res_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.code_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_msg()) {
+    _this->_impl_.msg_.Set(from._internal_msg(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_kv()) {
+    _this->_impl_.kv_ = new ::floyd::CmdResponse_Kv(*from._impl_.kv_);
+  }
+  if (from._internal_has_kvs()) {
+    _this->_impl_.kvs_ = new ::floyd::CmdResponse_Kvs(*from._impl_.kvs_);
+  }
+  if (from._internal_has_request_vote_res()) {
+    _this->_impl_.request_vote_res_ = new ::floyd::CmdResponse_RequestVoteResponse(*from._impl_.request_vote_res_);
+  }
+  if (from._internal_has_append_entries_res()) {
+    _this->_impl_.append_entries_res_ = new ::floyd::CmdResponse_AppendEntriesResponse(*from._impl_.append_entries_res_);
+  }
+  if (from._internal_has_server_status()) {
+    _this->_impl_.server_status_ = new ::floyd::CmdResponse_ServerStatus(*from._impl_.server_status_);
+  }
+  if (from._internal_has_read_index_res()) {
+    _this->_impl_.read_index_res_ = new ::floyd::CmdResponse_ReadIndexResponse(*from._impl_.read_index_res_);
+  }
+  if (from._internal_has_install_snapshot_res()) {
+    _this->_impl_.install_snapshot_res_ = new ::floyd::CmdResponse_InstallSnapshotResponse(*from._impl_.install_snapshot_res_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.code_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.code_));
+  // @@protoc_insertion_point(copy_constructor:floyd.CmdResponse)
+}
+
+inline void CmdResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.forward_res_){arena}
+    , decltype(_impl_.msg_){}
+    , decltype(_impl_.kv_){nullptr}
+    , decltype(_impl_.kvs_){nullptr}
+    , decltype(_impl_.request_vote_res_){nullptr}
+    , decltype(_impl_.append_entries_res_){nullptr}
+    , decltype(_impl_.server_status_){nullptr}
+    , decltype(_impl_.read_index_res_){nullptr}
+    , decltype(_impl_.install_snapshot_res_){nullptr}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.code_){0}
+  };
+  _impl_.msg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+CmdResponse::~CmdResponse() {
+  // @@protoc_insertion_point(destructor:floyd.CmdResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void CmdResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.forward_res_.~RepeatedPtrField();
+  _impl_.msg_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.kv_;
+  if (this != internal_default_instance()) delete _impl_.kvs_;
+  if (this != internal_default_instance()) delete _impl_.request_vote_res_;
+  if (this != internal_default_instance()) delete _impl_.append_entries_res_;
+  if (this != internal_default_instance()) delete _impl_.server_status_;
+  if (this != internal_default_instance()) delete _impl_.read_index_res_;
+  if (this != internal_default_instance()) delete _impl_.install_snapshot_res_;
+}
+
+void CmdResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-::google::protobuf::uint8* CmdResponse::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+void CmdResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:floyd.CmdResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.forward_res_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.msg_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.kv_ != nullptr);
+      _impl_.kv_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.kvs_ != nullptr);
+      _impl_.kvs_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.request_vote_res_ != nullptr);
+      _impl_.request_vote_res_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.append_entries_res_ != nullptr);
+      _impl_.append_entries_res_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.server_status_ != nullptr);
+      _impl_.server_status_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.read_index_res_ != nullptr);
+      _impl_.read_index_res_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.install_snapshot_res_ != nullptr);
+      _impl_.install_snapshot_res_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.code_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.code_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CmdResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .floyd.Type type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::floyd::Type_IsValid(val))) {
+            _internal_set_type(static_cast<::floyd::Type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.StatusCode code = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::floyd::StatusCode_IsValid(val))) {
+            _internal_set_code(static_cast<::floyd::StatusCode>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes msg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_msg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.CmdResponse.Kv kv = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_kv(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.CmdResponse.Kvs kvs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_kvs(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.CmdResponse.RequestVoteResponse request_vote_res = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request_vote_res(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.CmdResponse.AppendEntriesResponse append_entries_res = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_append_entries_res(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.CmdResponse.ServerStatus server_status = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_server_status(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.CmdResponse.ReadIndexResponse read_index_res = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_read_index_res(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .floyd.CmdResponse.InstallSnapshotResponse install_snapshot_res = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_install_snapshot_res(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .floyd.CmdResponse forward_res = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_forward_res(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CmdResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:floyd.CmdResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .floyd.Type type = 1;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // optional .floyd.StatusCode code = 2;
-  if (has_code()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->code(), target);
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_code(), target);
   }
 
   // optional bytes msg = 3;
-  if (has_msg()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->msg(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_msg(), target);
   }
 
   // optional .floyd.CmdResponse.Kv kv = 4;
-  if (has_kv()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->kv(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::kv(this),
+        _Internal::kv(this).GetCachedSize(), target, stream);
   }
 
   // optional .floyd.CmdResponse.Kvs kvs = 5;
-  if (has_kvs()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->kvs(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::kvs(this),
+        _Internal::kvs(this).GetCachedSize(), target, stream);
   }
 
   // optional .floyd.CmdResponse.RequestVoteResponse request_vote_res = 6;
-  if (has_request_vote_res()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->request_vote_res(), target);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::request_vote_res(this),
+        _Internal::request_vote_res(this).GetCachedSize(), target, stream);
   }
 
   // optional .floyd.CmdResponse.AppendEntriesResponse append_entries_res = 7;
-  if (has_append_entries_res()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        7, this->append_entries_res(), target);
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::append_entries_res(this),
+        _Internal::append_entries_res(this).GetCachedSize(), target, stream);
   }
 
   // optional .floyd.CmdResponse.ServerStatus server_status = 8;
-  if (has_server_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        8, this->server_status(), target);
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::server_status(this),
+        _Internal::server_status(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .floyd.CmdResponse.ReadIndexResponse read_index_res = 9;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::read_index_res(this),
+        _Internal::read_index_res(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .floyd.CmdResponse.InstallSnapshotResponse install_snapshot_res = 10;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::install_snapshot_res(this),
+        _Internal::install_snapshot_res(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .floyd.CmdResponse forward_res = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_forward_res_size()); i < n; i++) {
+    const auto& repfield = this->_internal_forward_res(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:floyd.CmdResponse)
   return target;
 }
 
-int CmdResponse::ByteSize() const {
-  int total_size = 0;
+size_t CmdResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:floyd.CmdResponse)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .floyd.Type type = 1;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
+  // required .floyd.Type type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    // optional .floyd.StatusCode code = 2;
-    if (has_code()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->code());
-    }
+  // repeated .floyd.CmdResponse forward_res = 11;
+  total_size += 1UL * this->_internal_forward_res_size();
+  for (const auto& msg : this->_impl_.forward_res_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
     // optional bytes msg = 3;
-    if (has_msg()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->msg());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_msg());
     }
 
     // optional .floyd.CmdResponse.Kv kv = 4;
-    if (has_kv()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->kv());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.kv_);
     }
 
     // optional .floyd.CmdResponse.Kvs kvs = 5;
-    if (has_kvs()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->kvs());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.kvs_);
     }
 
     // optional .floyd.CmdResponse.RequestVoteResponse request_vote_res = 6;
-    if (has_request_vote_res()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->request_vote_res());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.request_vote_res_);
     }
 
     // optional .floyd.CmdResponse.AppendEntriesResponse append_entries_res = 7;
-    if (has_append_entries_res()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->append_entries_res());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.append_entries_res_);
     }
 
     // optional .floyd.CmdResponse.ServerStatus server_status = 8;
-    if (has_server_status()) {
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.server_status_);
+    }
+
+    // optional .floyd.CmdResponse.ReadIndexResponse read_index_res = 9;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.read_index_res_);
+    }
+
+    // optional .floyd.CmdResponse.InstallSnapshotResponse install_snapshot_res = 10;
+    if (cached_has_bits & 0x00000080u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->server_status());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.install_snapshot_res_);
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // optional .floyd.StatusCode code = 2;
+  if (cached_has_bits & 0x00000200u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_code());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void CmdResponse::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CmdResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CmdResponse*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CmdResponse::MergeFrom(const CmdResponse& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_type()) {
-      set_type(from.type());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CmdResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CmdResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CmdResponse::GetClassData() const { return &_class_data_; }
+
+
+void CmdResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CmdResponse*>(&to_msg);
+  auto& from = static_cast<const CmdResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:floyd.CmdResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.forward_res_.MergeFrom(from._impl_.forward_res_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_msg(from._internal_msg());
     }
-    if (from.has_code()) {
-      set_code(from.code());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_kv()->::floyd::CmdResponse_Kv::MergeFrom(
+          from._internal_kv());
     }
-    if (from.has_msg()) {
-      set_msg(from.msg());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_kvs()->::floyd::CmdResponse_Kvs::MergeFrom(
+          from._internal_kvs());
     }
-    if (from.has_kv()) {
-      mutable_kv()->::floyd::CmdResponse_Kv::MergeFrom(from.kv());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_request_vote_res()->::floyd::CmdResponse_RequestVoteResponse::MergeFrom(
+          from._internal_request_vote_res());
     }
-    if (from.has_kvs()) {
-      mutable_kvs()->::floyd::CmdResponse_Kvs::MergeFrom(from.kvs());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_append_entries_res()->::floyd::CmdResponse_AppendEntriesResponse::MergeFrom(
+          from._internal_append_entries_res());
     }
-    if (from.has_request_vote_res()) {
-      mutable_request_vote_res()->::floyd::CmdResponse_RequestVoteResponse::MergeFrom(from.request_vote_res());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_server_status()->::floyd::CmdResponse_ServerStatus::MergeFrom(
+          from._internal_server_status());
     }
-    if (from.has_append_entries_res()) {
-      mutable_append_entries_res()->::floyd::CmdResponse_AppendEntriesResponse::MergeFrom(from.append_entries_res());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_read_index_res()->::floyd::CmdResponse_ReadIndexResponse::MergeFrom(
+          from._internal_read_index_res());
     }
-    if (from.has_server_status()) {
-      mutable_server_status()->::floyd::CmdResponse_ServerStatus::MergeFrom(from.server_status());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_install_snapshot_res()->::floyd::CmdResponse_InstallSnapshotResponse::MergeFrom(
+          from._internal_install_snapshot_res());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CmdResponse::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.code_ = from._impl_.code_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CmdResponse::CopyFrom(const CmdResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:floyd.CmdResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CmdResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  if (has_request_vote_res()) {
-    if (!this->request_vote_res().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.forward_res_))
+    return false;
+  if (_internal_has_request_vote_res()) {
+    if (!_impl_.request_vote_res_->IsInitialized()) return false;
+  }
+  if (_internal_has_append_entries_res()) {
+    if (!_impl_.append_entries_res_->IsInitialized()) return false;
   }
-  if (has_append_entries_res()) {
-    if (!this->append_entries_res().IsInitialized()) return false;
+  if (_internal_has_server_status()) {
+    if (!_impl_.server_status_->IsInitialized()) return false;
   }
-  if (has_server_status()) {
-    if (!this->server_status().IsInitialized()) return false;
+  if (_internal_has_read_index_res()) {
+    if (!_impl_.read_index_res_->IsInitialized()) return false;
+  }
+  if (_internal_has_install_snapshot_res()) {
+    if (!_impl_.install_snapshot_res_->IsInitialized()) return false;
   }
   return true;
 }
 
-void CmdResponse::Swap(CmdResponse* other) {
-  if (other != this) {
-    std::swap(type_, other->type_);
-    std::swap(code_, other->code_);
-    std::swap(msg_, other->msg_);
-    std::swap(kv_, other->kv_);
-    std::swap(kvs_, other->kvs_);
-    std::swap(request_vote_res_, other->request_vote_res_);
-    std::swap(append_entries_res_, other->append_entries_res_);
-    std::swap(server_status_, other->server_status_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CmdResponse::InternalSwap(CmdResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.forward_res_.InternalSwap(&other->_impl_.forward_res_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.msg_, lhs_arena,
+      &other->_impl_.msg_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CmdResponse, _impl_.code_)
+      + sizeof(CmdResponse::_impl_.code_)
+      - PROTOBUF_FIELD_OFFSET(CmdResponse, _impl_.kv_)>(
+          reinterpret_cast<char*>(&_impl_.kv_),
+          reinterpret_cast<char*>(&other->_impl_.kv_));
 }
 
-::google::protobuf::Metadata CmdResponse::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CmdResponse_descriptor_;
-  metadata.reflection = CmdResponse_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CmdResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_floyd_2eproto_getter, &descriptor_table_floyd_2eproto_once,
+      file_level_metadata_floyd_2eproto[19]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace floyd
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::floyd::Entry_Operation*
+Arena::CreateMaybeMessage< ::floyd::Entry_Operation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::Entry_Operation >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::Entry*
+Arena::CreateMaybeMessage< ::floyd::Entry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::Entry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::KvCommand*
+Arena::CreateMaybeMessage< ::floyd::KvCommand >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::KvCommand >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::HardState*
+Arena::CreateMaybeMessage< ::floyd::HardState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::HardState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdRequest_Kv*
+Arena::CreateMaybeMessage< ::floyd::CmdRequest_Kv >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdRequest_Kv >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdRequest_User*
+Arena::CreateMaybeMessage< ::floyd::CmdRequest_User >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdRequest_User >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdRequest_RequestVote*
+Arena::CreateMaybeMessage< ::floyd::CmdRequest_RequestVote >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdRequest_RequestVote >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdRequest_AppendEntries*
+Arena::CreateMaybeMessage< ::floyd::CmdRequest_AppendEntries >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdRequest_AppendEntries >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdRequest_ServerStatus*
+Arena::CreateMaybeMessage< ::floyd::CmdRequest_ServerStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdRequest_ServerStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdRequest_WriteBatch*
+Arena::CreateMaybeMessage< ::floyd::CmdRequest_WriteBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdRequest_WriteBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdRequest_InstallSnapshot*
+Arena::CreateMaybeMessage< ::floyd::CmdRequest_InstallSnapshot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdRequest_InstallSnapshot >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdRequest*
+Arena::CreateMaybeMessage< ::floyd::CmdRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdResponse_Kv*
+Arena::CreateMaybeMessage< ::floyd::CmdResponse_Kv >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdResponse_Kv >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdResponse_Kvs*
+Arena::CreateMaybeMessage< ::floyd::CmdResponse_Kvs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdResponse_Kvs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdResponse_RequestVoteResponse*
+Arena::CreateMaybeMessage< ::floyd::CmdResponse_RequestVoteResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdResponse_RequestVoteResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdResponse_AppendEntriesResponse*
+Arena::CreateMaybeMessage< ::floyd::CmdResponse_AppendEntriesResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdResponse_AppendEntriesResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdResponse_ServerStatus*
+Arena::CreateMaybeMessage< ::floyd::CmdResponse_ServerStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdResponse_ServerStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdResponse_ReadIndexResponse*
+Arena::CreateMaybeMessage< ::floyd::CmdResponse_ReadIndexResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdResponse_ReadIndexResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdResponse_InstallSnapshotResponse*
+Arena::CreateMaybeMessage< ::floyd::CmdResponse_InstallSnapshotResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdResponse_InstallSnapshotResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::floyd::CmdResponse*
+Arena::CreateMaybeMessage< ::floyd::CmdResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::floyd::CmdResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>